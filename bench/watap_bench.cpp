@@ -0,0 +1,55 @@
+/***
+ * Standard implementation benchmark runner.
+ *
+ * Benchmarks are run from repository root directory (example modules are loaded from 'example' directory),
+ * benchmark names may be passed as arguments to run them only.
+ ***/
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "watap_bench.h"
+
+using namespace watap::common_types;
+
+/* Example module loading function.
+ * ARGUMENTS:
+ *   - module file name (relative to 'example' directory):
+ *       std::string_view FileName;
+ * RETURNS:
+ *   (std::vector<UINT8>) Module binary, empty if file can't be read;
+ */
+std::vector<UINT8> watap::bench::LoadExample( std::string_view FileName )
+{
+  std::ifstream File(std::format("example/{}", FileName), std::ios::binary);
+
+  return std::vector<UINT8>(std::istreambuf_iterator<CHAR>(File), std::istreambuf_iterator<CHAR>());
+} /* End of 'watap::bench::LoadExample' function */
+
+INT main( INT ArgumentCount, CHAR **Arguments )
+{
+  const std::pair<std::string_view, watap::bench::bench_function> Benchmarks[]
+  {
+    {"branch_table", watap::bench::BenchBranchTable},
+    {"immediate",    watap::bench::BenchImmediate},
+  };
+  INT FailCount = 0;
+
+  for (const auto &[Name, Bench] : Benchmarks)
+  {
+    if (ArgumentCount > 1 && std::find(Arguments + 1, Arguments + ArgumentCount, Name) == Arguments + ArgumentCount)
+      continue;
+
+    std::cout << std::format("{}:\n", Name);
+    if (!Bench())
+    {
+      std::cout << std::format("{}: INVALID RESULTS\n", Name);
+      FailCount++;
+    }
+  }
+
+  return FailCount == 0 ? 0 : 1;
+}
+
+/* END OF 'watap_bench.cpp' FILE */
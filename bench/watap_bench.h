@@ -0,0 +1,44 @@
+/***
+ * Standard implementation benchmark set declaration.
+ ***/
+
+#ifndef __watap_bench_h_
+#define __watap_bench_h_
+
+#include <vector>
+
+#include "watap.h"
+
+/* Project namespace // Benchmark namespace */
+namespace watap::bench
+{
+  /* Benchmark function (results are printed by benchmark itself), returns TRUE if benchmark results are valid */
+  using bench_function = BOOL (*)( VOID );
+
+  /* Example module loading function.
+   * ARGUMENTS:
+   *   - module file name (relative to 'example' directory):
+   *       std::string_view FileName;
+   * RETURNS:
+   *   (std::vector<UINT8>) Module binary, empty if file can't be read;
+   */
+  std::vector<UINT8> LoadExample( std::string_view FileName );
+
+  /* 'br_table' lowering benchmark.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if every lowering and dispatch type gives reference result, FALSE otherwise;
+   */
+  BOOL BenchBranchTable( VOID );
+
+  /* Instruction immediate decoding benchmark.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if both decodings give the same immediates for every module, FALSE otherwise;
+   */
+  BOOL BenchImmediate( VOID );
+} /* end of 'watap::bench' namespace */
+
+#endif // !defined(__watap_bench_h_)
+
+/* END OF 'watap_bench.h' FILE */
@@ -0,0 +1,80 @@
+/***
+ * 'br_table' lowering benchmark.
+ *
+ * 'example/state_machine.wasm' (256-way 'br_table' state machine) 'run(N)' is timed with every
+ * 'br_table' lowering and interpreter dispatch type (stack bytecode, tier up is disabled).
+ * Best of 'RunCount' calls is printed in nanoseconds per loop iteration.
+ ***/
+
+#include <chrono>
+
+#include "watap_bench.h"
+
+/* Project namespace // Benchmark namespace */
+namespace watap::bench
+{
+  /* 'br_table' lowering benchmark.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if every lowering and dispatch type gives reference result, FALSE otherwise;
+   */
+  BOOL BenchBranchTable( VOID )
+  {
+    const UINT32 IterationCount = 1'000'000;
+    const UINT32 Expected = 228'999'271; // run(1000000) reference result
+    const UINT32 RunCount = 5;
+    const std::vector<UINT8> Module = LoadExample("state_machine.wasm");
+    INT FailCount = 0;
+
+    if (Module.empty())
+    {
+      std::cout << "  can't read 'example/state_machine.wasm'\n";
+      return FALSE;
+    }
+
+    std::cout << std::format("  run({}), best of {} runs, ns per loop iteration:\n", IterationCount, RunCount);
+    std::cout << "  | lowering    | switch   | threaded |\n";
+    std::cout << "  |-------------|----------|----------|\n";
+    for (impl::standard::branch_table_lowering Lowering : {impl::standard::branch_table_lowering::eJumpTable, impl::standard::branch_table_lowering::eLinearScan})
+    {
+      std::cout << std::format("  | {:<11} |", Lowering == impl::standard::branch_table_lowering::eJumpTable ? "jump table" : "linear scan");
+      for (impl::standard::dispatch_type Dispatch : {impl::standard::dispatch_type::eSwitch, impl::standard::dispatch_type::eThreaded})
+      {
+        auto Wasm = impl::standard::Create(impl::standard::settings {
+          .Dispatch = Dispatch,
+          .Bytecode = impl::standard::bytecode_type::eStack,
+          .BranchTable = Lowering,
+          .TierUpCallCount = 0,
+          .TierUpBackEdgeCount = 0,
+        });
+        auto ModuleSource = Wasm->CreateSource(source_info { std::span<const UINT8>(Module) });
+        auto Runtime = Wasm->CreateInstance(instance_info {
+          .ModuleSource = ModuleSource,
+          .ImportTable = nullptr,
+        });
+        auto Run = Runtime->GetExport<UINT32 ( UINT32 )>("run");
+        DOUBLE BestTime = std::numeric_limits<DOUBLE>::infinity();
+
+        for (UINT32 i = 0; i < RunCount; i++)
+        {
+          const auto StartTime = std::chrono::steady_clock::now();
+          const std::optional<UINT32> Result = Run(IterationCount);
+          const DOUBLE Time = std::chrono::duration<DOUBLE, std::nano>(std::chrono::steady_clock::now() - StartTime).count();
+
+          BestTime = std::min(BestTime, Time / IterationCount);
+          FailCount += Result != Expected;
+        }
+        std::cout << std::format(" {:<8.1f} |", BestTime);
+
+        Wasm->DestroyInstance(Runtime);
+        Wasm->DestroySource(ModuleSource);
+        impl::standard::Destroy(Wasm);
+      }
+      std::cout << "\n";
+    }
+
+    return FailCount == 0;
+  } /* End of 'BenchBranchTable' function */
+} /* end of 'watap::bench' namespace */
+
+/* END OF 'watap_bench_branch_table.cpp' FILE */
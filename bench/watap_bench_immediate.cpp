@@ -0,0 +1,496 @@
+/***
+ * Instruction immediate decoding benchmark.
+ *
+ * Every 32 and 64 bit immediate of module stack bytecode (without optimization and fusion) is decoded
+ * slot by slot (16 bit slots are assembled by shifts) and by 'ReadImmediate' (single load). Best of
+ * 'RunCount' runs is printed in nanoseconds per immediate, with code size of immediate pool variant
+ * (16 bit pool index in code, naturally aligned value in per-function pool).
+ *
+ * Modules are example ones and generated ones (random i32/i64/f64 constants, memory accesses,
+ * 'br_if' and calls, generator is seeded, so generated modules are the same on every run).
+ *
+ * Benchmark reads compiled bytecode of source, so it's built as standard implementation part.
+ ***/
+
+#define WATAP_IMPL_STANDARD
+
+#include <chrono>
+#include <random>
+
+#include "watap_bench.h"
+#include "impl/standard/watap_impl_standard_exec.h"
+
+/* Project namespace // Benchmark namespace */
+namespace watap::bench
+{
+  /* Decoded immediate representation structure */
+  struct immediate
+  {
+    UINT32 Slot;       // Index of immediate first slot in concatenated bytecode of all functions
+    BOOL Is64 = FALSE; // Is immediate 64 bit one
+  }; /* End of 'immediate' structure */
+
+  /* Immediate decoding function pointer (function is called by pointer, so it isn't inlined to timing loop) */
+  using decode_function = UINT64 (*)( const impl::standard::compiled_instruction *Code, const std::vector<immediate> &Immediates );
+
+  /* Slot by slot immediate decoding function.
+   * ARGUMENTS:
+   *   - bytecode of all functions:
+   *       const impl::standard::compiled_instruction *Code;
+   *   - immediates to decode:
+   *       const std::vector<immediate> &Immediates;
+   * RETURNS:
+   *   (UINT64) Sum of immediates;
+   */
+  static UINT64 DecodeBySlots( const impl::standard::compiled_instruction *Code, const std::vector<immediate> &Immediates )
+  {
+    UINT64 Sum = 0;
+
+    for (const immediate &Immediate : Immediates)
+    {
+      const SIZE_T Ip = Immediate.Slot;
+      const UINT32 Low = static_cast<UINT32>(Code[Ip].InstructionID) | static_cast<UINT32>(Code[Ip + 1].InstructionID) << 16;
+
+      if (Immediate.Is64)
+        Sum += static_cast<UINT64>(Low) | static_cast<UINT64>(static_cast<UINT32>(Code[Ip + 2].InstructionID) | static_cast<UINT32>(Code[Ip + 3].InstructionID) << 16) << 32;
+      else
+        Sum += Low;
+    }
+    return Sum;
+  } /* End of 'DecodeBySlots' function */
+
+  /* Single load immediate decoding function.
+   * ARGUMENTS:
+   *   - bytecode of all functions:
+   *       const impl::standard::compiled_instruction *Code;
+   *   - immediates to decode:
+   *       const std::vector<immediate> &Immediates;
+   * RETURNS:
+   *   (UINT64) Sum of immediates;
+   */
+  static UINT64 DecodeByLoad( const impl::standard::compiled_instruction *Code, const std::vector<immediate> &Immediates )
+  {
+    UINT64 Sum = 0;
+
+    for (const immediate &Immediate : Immediates)
+      if (Immediate.Is64)
+        Sum += impl::standard::ReadImmediate<UINT64>(Code + Immediate.Slot);
+      else
+        Sum += impl::standard::ReadImmediate<UINT32>(Code + Immediate.Slot);
+    return Sum;
+  } /* End of 'DecodeByLoad' function */
+
+  /* Random module generator representation class */
+  class module_generator
+  {
+    std::mt19937_64 Random {1}; // Random number generator (seeded, its sequence is defined by standard)
+    std::vector<UINT8> Body;    // Body of generated function
+    UINT32 FunctionIndex = 0;   // Index of generated function (functions call previous ones only)
+
+    /* Random number getting function.
+     * ARGUMENTS:
+     *   - count of numbers to choose from:
+     *       UINT64 Count;
+     * RETURNS:
+     *   (UINT64) Random number in [0, Count) range;
+     */
+    UINT64 Next( UINT64 Count )
+    {
+      return Random() % Count;
+    } /* End of 'Next' function */
+
+    /* Instruction writing function.
+     * ARGUMENTS:
+     *   - instruction:
+     *       bin::instruction Instruction;
+     * RETURNS: None.
+     */
+    VOID Write( bin::instruction Instruction )
+    {
+      Body.push_back(static_cast<UINT8>(Instruction));
+    } /* End of 'Write' function */
+
+    /* Unsigned LEB128 number writing function.
+     * ARGUMENTS:
+     *   - output:
+     *       std::vector<UINT8> &Output;
+     *   - number:
+     *       UINT64 Number;
+     * RETURNS: None.
+     */
+    static VOID WriteUnsigned( std::vector<UINT8> &Output, UINT64 Number )
+    {
+      do
+      {
+        const UINT8 Byte = Number & 0x7F;
+
+        Number >>= 7;
+        Output.push_back(Byte | (Number != 0 ? 0x80 : 0x00));
+      } while (Number != 0);
+    } /* End of 'WriteUnsigned' function */
+
+    /* Signed LEB128 number writing function.
+     * ARGUMENTS:
+     *   - number:
+     *       INT64 Number;
+     * RETURNS: None.
+     */
+    VOID WriteSigned( INT64 Number )
+    {
+      for (;;)
+      {
+        const UINT8 Byte = Number & 0x7F;
+
+        Number >>= 7;
+        if ((Number == 0 && (Byte & 0x40) == 0) || (Number == -1 && (Byte & 0x40) != 0))
+        {
+          Body.push_back(Byte);
+          return;
+        }
+        Body.push_back(Byte | 0x80);
+      }
+    } /* End of 'WriteSigned' function */
+
+    /* Memory access instruction writing function.
+     * ARGUMENTS:
+     *   - instruction:
+     *       bin::instruction Instruction;
+     *   - alignment (power of 2):
+     *       UINT32 Alignment;
+     * RETURNS: None.
+     */
+    VOID WriteMemoryAccess( bin::instruction Instruction, UINT32 Alignment )
+    {
+      Write(Instruction);
+      WriteUnsigned(Body, Alignment);
+      WriteUnsigned(Body, Next(4000) & ~((1ULL << Alignment) - 1));
+    } /* End of 'WriteMemoryAccess' function */
+
+    /* i32 expression writing function.
+     * ARGUMENTS:
+     *   - maximal expression depth:
+     *       UINT32 Depth;
+     * RETURNS: None.
+     */
+    VOID WriteI32( UINT32 Depth )
+    {
+      const UINT64 Kind = Next(20);
+
+      if (Depth == 0 || Kind < 6)
+        switch (Next(3))
+        {
+        case 0:
+          Write(bin::instruction::eI32Const);
+          WriteSigned(static_cast<INT32>(Random()));
+          break;
+        case 1:
+          Write(bin::instruction::eI32Const);
+          WriteSigned(static_cast<INT32>(Next(101)));
+          break;
+        default:
+          Write(bin::instruction::eLocalGet);
+          WriteUnsigned(Body, Next(3));
+          break;
+        }
+      else if (Kind < 9)
+      {
+        WriteI32(Depth - 1);
+        WriteMemoryAccess(bin::instruction::eI32Load, 2);
+      }
+      else if (Kind < 11)
+      {
+        WriteI64(Depth - 1);
+        Write(bin::instruction::eI32WrapI64);
+      }
+      else if (Kind < 12)
+      {
+        WriteF64(Depth - 1);
+        Write(bin::instruction::eI32TruncF64U);
+      }
+      else
+      {
+        const bin::instruction Operations[] {bin::instruction::eI32Add, bin::instruction::eI32Sub, bin::instruction::eI32Mul,
+          bin::instruction::eI32And, bin::instruction::eI32Or, bin::instruction::eI32Xor};
+
+        WriteI32(Depth - 1);
+        WriteI32(Depth - 1);
+        Write(Operations[Next(std::size(Operations))]);
+      }
+    } /* End of 'WriteI32' function */
+
+    /* i64 expression writing function.
+     * ARGUMENTS:
+     *   - maximal expression depth:
+     *       UINT32 Depth;
+     * RETURNS: None.
+     */
+    VOID WriteI64( UINT32 Depth )
+    {
+      const UINT64 Kind = Next(10);
+
+      if (Depth == 0 || Kind < 4)
+      {
+        Write(bin::instruction::eI64Const);
+        WriteSigned(static_cast<INT64>(Random()));
+      }
+      else if (Kind < 5)
+      {
+        WriteI32(Depth - 1);
+        WriteMemoryAccess(bin::instruction::eI64Load, 3);
+      }
+      else
+      {
+        const bin::instruction Operations[] {bin::instruction::eI64Add, bin::instruction::eI64Sub, bin::instruction::eI64Mul,
+          bin::instruction::eI64And, bin::instruction::eI64Or, bin::instruction::eI64Xor};
+
+        WriteI64(Depth - 1);
+        WriteI64(Depth - 1);
+        Write(Operations[Next(std::size(Operations))]);
+      }
+    } /* End of 'WriteI64' function */
+
+    /* f64 expression writing function.
+     * ARGUMENTS:
+     *   - maximal expression depth:
+     *       UINT32 Depth;
+     * RETURNS: None.
+     */
+    VOID WriteF64( UINT32 Depth )
+    {
+      if (Depth == 0 || Next(10) < 4)
+      {
+        const DOUBLE Value = static_cast<DOUBLE>(static_cast<INT64>(Next(2'000'000'000))) / 1000.0 - 1e6;
+        UINT8 Bytes[sizeof(DOUBLE)];
+
+        std::memcpy(Bytes, &Value, sizeof(DOUBLE));
+        Write(bin::instruction::eF64Const);
+        Body.insert(Body.end(), std::begin(Bytes), std::end(Bytes));
+      }
+      else
+      {
+        const bin::instruction Operations[] {bin::instruction::eF64Add, bin::instruction::eF64Sub, bin::instruction::eF64Mul};
+
+        WriteF64(Depth - 1);
+        WriteF64(Depth - 1);
+        Write(Operations[Next(std::size(Operations))]);
+      }
+    } /* End of 'WriteF64' function */
+
+    /* Statement writing function.
+     * ARGUMENTS: None.
+     * RETURNS: None.
+     */
+    VOID WriteStatement( VOID )
+    {
+      const UINT64 Kind = Next(20);
+
+      if (Kind < 8)
+      {
+        WriteI32(3);
+        Write(bin::instruction::eLocalSet);
+        WriteUnsigned(Body, Next(3));
+      }
+      else if (Kind < 12)
+      {
+        Write(bin::instruction::eI32Const);
+        WriteSigned(static_cast<INT32>(Next(4000) & ~3ULL));
+        WriteI32(2);
+        WriteMemoryAccess(bin::instruction::eI32Store, 2);
+      }
+      else if (Kind < 15)
+      {
+        // (block (br_if 0 (i32 expression)) (local.set 1 (i32 expression)))
+        Write(bin::instruction::eBlock);
+        Body.push_back(0x40);
+        WriteI32(2);
+        Write(bin::instruction::eBrIf);
+        WriteUnsigned(Body, 0);
+        WriteI32(2);
+        Write(bin::instruction::eLocalSet);
+        WriteUnsigned(Body, 1);
+        Write(bin::instruction::eExpressionEnd);
+      }
+      else if (Kind < 18 || FunctionIndex == 0)
+      {
+        WriteI64(3);
+        Write(bin::instruction::eDrop);
+      }
+      else
+      {
+        WriteI32(1);
+        Write(bin::instruction::eCall);
+        WriteUnsigned(Body, Next(FunctionIndex));
+        Write(bin::instruction::eDrop);
+      }
+    } /* End of 'WriteStatement' function */
+
+    /* Section writing function.
+     * ARGUMENTS:
+     *   - output:
+     *       std::vector<UINT8> &Output;
+     *   - section identifier:
+     *       bin::section_id Id;
+     *   - count of section entries:
+     *       UINT32 Count;
+     *   - section entries:
+     *       const std::vector<UINT8> &Entries;
+     * RETURNS: None.
+     */
+    static VOID WriteSection( std::vector<UINT8> &Output, bin::section_id Id, UINT32 Count, const std::vector<UINT8> &Entries )
+    {
+      std::vector<UINT8> Contents;
+
+      WriteUnsigned(Contents, Count);
+      Contents.insert(Contents.end(), Entries.begin(), Entries.end());
+      Output.push_back(static_cast<UINT8>(Id));
+      WriteUnsigned(Output, Contents.size());
+      Output.insert(Output.end(), Contents.begin(), Contents.end());
+    } /* End of 'WriteSection' function */
+
+  public:
+    /* Module generation function.
+     * ARGUMENTS:
+     *   - count of functions:
+     *       UINT32 FunctionCount;
+     * RETURNS:
+     *   (std::vector<UINT8>) Module binary (every function is (param i32) (result i32) with 2 i32 locals, module has 1 memory page);
+     */
+    std::vector<UINT8> Generate( UINT32 FunctionCount )
+    {
+      const UINT8 I32 = static_cast<UINT8>(bin::value_type::eI32);
+      std::vector<UINT8> Module {0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00};
+      std::vector<UINT8> Functions, Codes;
+
+      for (FunctionIndex = 0; FunctionIndex < FunctionCount; FunctionIndex++)
+      {
+        Body = {0x01, 0x02, I32};
+        for (UINT64 i = 0, StatementCount = 5 + Next(26); i < StatementCount; i++)
+          WriteStatement();
+        Write(bin::instruction::eLocalGet);
+        WriteUnsigned(Body, 0);
+        Write(bin::instruction::eExpressionEnd);
+
+        WriteUnsigned(Functions, 0);
+        WriteUnsigned(Codes, Body.size());
+        Codes.insert(Codes.end(), Body.begin(), Body.end());
+      }
+
+      WriteSection(Module, bin::section_id::eType, 1, {0x60, 0x01, I32, 0x01, I32});
+      WriteSection(Module, bin::section_id::eFunction, FunctionCount, Functions);
+      WriteSection(Module, bin::section_id::eMemory, 1, {0x00, 0x01});
+      WriteSection(Module, bin::section_id::eCode, FunctionCount, Codes);
+      return Module;
+    } /* End of 'Generate' function */
+  }; /* End of 'module_generator' class */
+
+  /* Instruction immediate decoding benchmark.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if both decodings give the same immediates for every module, FALSE otherwise;
+   */
+  BOOL BenchImmediate( VOID )
+  {
+    const UINT32 RunCount = 15;
+    const SIZE_T DecodeCount = 4'000'000; // Count of immediates decoded by single run
+    const std::pair<std::string, std::vector<UINT8>> Modules[]
+    {
+      {"example/math.wasm",          LoadExample("math.wasm")},
+      {"example/state_machine.wasm", LoadExample("state_machine.wasm")},
+      {"example/type_test.wasm",     LoadExample("type_test.wasm")},
+      {"generated 200 functions",    module_generator().Generate(200)},
+      {"generated 2000 functions",   module_generator().Generate(2000)},
+    };
+    INT FailCount = 0;
+
+    std::cout << std::format("  {:<26} {:>7} {:>10} {:>10} {:>7} {:>7} {:>10} {:>9} {:>9}\n",
+      "module", "instrs", "functions", "code bytes", "imm32", "imm64", "pool bytes", "slots ns", "load ns");
+    for (const auto &[Name, Module] : Modules)
+    {
+      if (Module.empty())
+      {
+        std::cout << std::format("  can't read '{}'\n", Name);
+        FailCount++;
+        continue;
+      }
+
+      auto Wasm = impl::standard::Create(impl::standard::settings {
+        .Bytecode = impl::standard::bytecode_type::eStack,
+        .Optimization = FALSE,
+        .Fusion = FALSE,
+        .TierUpCallCount = 0,
+        .TierUpBackEdgeCount = 0,
+        .InlineBudget = 0,
+      });
+      auto ModuleSource = dynamic_cast<impl::standard::source_impl *>(Wasm->CreateSource(source_info { std::span<const UINT8>(Module) }));
+      std::vector<impl::standard::compiled_instruction> Code;
+      std::vector<immediate> Immediates;
+      SIZE_T InstructionCount = 0, FunctionCount = 0, Immediate32Count = 0, Immediate64Count = 0;
+
+      for (UINT32 FunctionIndex = 0; ModuleSource != nullptr && FunctionIndex < ModuleSource->Functions.size(); FunctionIndex++)
+      {
+        const impl::standard::compiled_function_data *Function = ModuleSource->GetFunction(FunctionIndex);
+
+        if (Function == nullptr)
+          continue;
+
+        const UINT32 Base = static_cast<UINT32>(Code.size());
+
+        FunctionCount++;
+        Code.insert(Code.end(), Function->Instructions.begin(), Function->Instructions.end());
+        for (SIZE_T Ip = 0; Ip < Function->Instructions.size(); Ip += impl::standard::GetCompiledInstructionLength(Function->Instructions[Ip]))
+        {
+          const bin::instruction Instruction = Function->Instructions[Ip].Instruction;
+          const SIZE_T Length = impl::standard::GetCompiledInstructionLength(Function->Instructions[Ip]);
+
+          InstructionCount++;
+          if (Instruction == bin::instruction::eI64Const || Instruction == bin::instruction::eF64Const)
+            Immediates.push_back({static_cast<UINT32>(Base + Ip + 1), TRUE});
+          else
+            // 'br_table' has two 32 bit immediates (first target index and target count)
+            for (SIZE_T Slot = 1; Slot + 1 < Length; Slot += 2)
+              Immediates.push_back({static_cast<UINT32>(Base + Ip + Slot)});
+        }
+      }
+      for (const immediate &Immediate : Immediates)
+        (Immediate.Is64 ? Immediate64Count : Immediate32Count)++;
+
+      // Pool variant replaces 2 (32 bit) or 4 (64 bit) immediate slots with single index slot and adds pool entry
+      const SIZE_T PoolBytes = (Code.size() - Immediate32Count - 3 * Immediate64Count) * sizeof(impl::standard::compiled_instruction)
+        + Immediate32Count * sizeof(UINT32) + Immediate64Count * sizeof(UINT64);
+      const SIZE_T RepeatCount = std::max<SIZE_T>(1, DecodeCount / std::max<SIZE_T>(1, Immediates.size()));
+      decode_function volatile DecodeFunctions[] {DecodeBySlots, DecodeByLoad};
+      DOUBLE BestTimes[] {std::numeric_limits<DOUBLE>::infinity(), std::numeric_limits<DOUBLE>::infinity()};
+      UINT64 Sums[] {0, 0};
+
+      for (UINT32 i = 0; i < RunCount && !Immediates.empty(); i++)
+        for (SIZE_T Decoder = 0; Decoder < std::size(DecodeFunctions); Decoder++)
+        {
+          const auto StartTime = std::chrono::steady_clock::now();
+
+          Sums[Decoder] = 0;
+          for (SIZE_T j = 0; j < RepeatCount; j++)
+            Sums[Decoder] += DecodeFunctions[Decoder](Code.data(), Immediates);
+
+          const DOUBLE Time = std::chrono::duration<DOUBLE, std::nano>(std::chrono::steady_clock::now() - StartTime).count();
+
+          BestTimes[Decoder] = std::min(BestTimes[Decoder], Time / (RepeatCount * Immediates.size()));
+        }
+
+      std::cout << std::format("  {:<26} {:>7} {:>10} {:>10} {:>7} {:>7} {:>10} {:>9.2f} {:>9.2f}\n", Name, InstructionCount, FunctionCount,
+        Code.size() * sizeof(impl::standard::compiled_instruction), Immediate32Count, Immediate64Count, PoolBytes, BestTimes[0], BestTimes[1]);
+      if (ModuleSource == nullptr || Sums[0] != Sums[1])
+      {
+        std::cout << std::format("  {}: {}\n", Name, ModuleSource == nullptr ? "module isn't loaded" : "decoded immediates mismatch");
+        FailCount++;
+      }
+
+      if (ModuleSource != nullptr)
+        Wasm->DestroySource(ModuleSource);
+      impl::standard::Destroy(Wasm);
+    }
+
+    return FailCount == 0;
+  } /* End of 'BenchImmediate' function */
+} /* end of 'watap::bench' namespace */
+
+/* END OF 'watap_bench_immediate.cpp' FILE */
@@ -0,0 +1,1551 @@
+;; 256-way 'br_table' state machine (interpreter/parser dispatch loop pattern)
+(module
+  (func $run (param $n i32) (result i32) (local $s i32) (local $acc i32)
+    (loop $top
+      (if (i32.eqz (local.get $n))
+        (then (return (local.get $acc)))
+      )
+      (local.set $n (i32.sub (local.get $n) (i32.const 1)))
+      (block $s255
+      (block $s254
+      (block $s253
+      (block $s252
+      (block $s251
+      (block $s250
+      (block $s249
+      (block $s248
+      (block $s247
+      (block $s246
+      (block $s245
+      (block $s244
+      (block $s243
+      (block $s242
+      (block $s241
+      (block $s240
+      (block $s239
+      (block $s238
+      (block $s237
+      (block $s236
+      (block $s235
+      (block $s234
+      (block $s233
+      (block $s232
+      (block $s231
+      (block $s230
+      (block $s229
+      (block $s228
+      (block $s227
+      (block $s226
+      (block $s225
+      (block $s224
+      (block $s223
+      (block $s222
+      (block $s221
+      (block $s220
+      (block $s219
+      (block $s218
+      (block $s217
+      (block $s216
+      (block $s215
+      (block $s214
+      (block $s213
+      (block $s212
+      (block $s211
+      (block $s210
+      (block $s209
+      (block $s208
+      (block $s207
+      (block $s206
+      (block $s205
+      (block $s204
+      (block $s203
+      (block $s202
+      (block $s201
+      (block $s200
+      (block $s199
+      (block $s198
+      (block $s197
+      (block $s196
+      (block $s195
+      (block $s194
+      (block $s193
+      (block $s192
+      (block $s191
+      (block $s190
+      (block $s189
+      (block $s188
+      (block $s187
+      (block $s186
+      (block $s185
+      (block $s184
+      (block $s183
+      (block $s182
+      (block $s181
+      (block $s180
+      (block $s179
+      (block $s178
+      (block $s177
+      (block $s176
+      (block $s175
+      (block $s174
+      (block $s173
+      (block $s172
+      (block $s171
+      (block $s170
+      (block $s169
+      (block $s168
+      (block $s167
+      (block $s166
+      (block $s165
+      (block $s164
+      (block $s163
+      (block $s162
+      (block $s161
+      (block $s160
+      (block $s159
+      (block $s158
+      (block $s157
+      (block $s156
+      (block $s155
+      (block $s154
+      (block $s153
+      (block $s152
+      (block $s151
+      (block $s150
+      (block $s149
+      (block $s148
+      (block $s147
+      (block $s146
+      (block $s145
+      (block $s144
+      (block $s143
+      (block $s142
+      (block $s141
+      (block $s140
+      (block $s139
+      (block $s138
+      (block $s137
+      (block $s136
+      (block $s135
+      (block $s134
+      (block $s133
+      (block $s132
+      (block $s131
+      (block $s130
+      (block $s129
+      (block $s128
+      (block $s127
+      (block $s126
+      (block $s125
+      (block $s124
+      (block $s123
+      (block $s122
+      (block $s121
+      (block $s120
+      (block $s119
+      (block $s118
+      (block $s117
+      (block $s116
+      (block $s115
+      (block $s114
+      (block $s113
+      (block $s112
+      (block $s111
+      (block $s110
+      (block $s109
+      (block $s108
+      (block $s107
+      (block $s106
+      (block $s105
+      (block $s104
+      (block $s103
+      (block $s102
+      (block $s101
+      (block $s100
+      (block $s99
+      (block $s98
+      (block $s97
+      (block $s96
+      (block $s95
+      (block $s94
+      (block $s93
+      (block $s92
+      (block $s91
+      (block $s90
+      (block $s89
+      (block $s88
+      (block $s87
+      (block $s86
+      (block $s85
+      (block $s84
+      (block $s83
+      (block $s82
+      (block $s81
+      (block $s80
+      (block $s79
+      (block $s78
+      (block $s77
+      (block $s76
+      (block $s75
+      (block $s74
+      (block $s73
+      (block $s72
+      (block $s71
+      (block $s70
+      (block $s69
+      (block $s68
+      (block $s67
+      (block $s66
+      (block $s65
+      (block $s64
+      (block $s63
+      (block $s62
+      (block $s61
+      (block $s60
+      (block $s59
+      (block $s58
+      (block $s57
+      (block $s56
+      (block $s55
+      (block $s54
+      (block $s53
+      (block $s52
+      (block $s51
+      (block $s50
+      (block $s49
+      (block $s48
+      (block $s47
+      (block $s46
+      (block $s45
+      (block $s44
+      (block $s43
+      (block $s42
+      (block $s41
+      (block $s40
+      (block $s39
+      (block $s38
+      (block $s37
+      (block $s36
+      (block $s35
+      (block $s34
+      (block $s33
+      (block $s32
+      (block $s31
+      (block $s30
+      (block $s29
+      (block $s28
+      (block $s27
+      (block $s26
+      (block $s25
+      (block $s24
+      (block $s23
+      (block $s22
+      (block $s21
+      (block $s20
+      (block $s19
+      (block $s18
+      (block $s17
+      (block $s16
+      (block $s15
+      (block $s14
+      (block $s13
+      (block $s12
+      (block $s11
+      (block $s10
+      (block $s9
+      (block $s8
+      (block $s7
+      (block $s6
+      (block $s5
+      (block $s4
+      (block $s3
+      (block $s2
+      (block $s1
+      (block $s0
+        (br_table $s0 $s1 $s2 $s3 $s4 $s5 $s6 $s7 $s8 $s9 $s10 $s11 $s12 $s13 $s14 $s15 $s16 $s17 $s18 $s19 $s20 $s21 $s22 $s23 $s24 $s25 $s26 $s27 $s28 $s29 $s30 $s31 $s32 $s33 $s34 $s35 $s36 $s37 $s38 $s39 $s40 $s41 $s42 $s43 $s44 $s45 $s46 $s47 $s48 $s49 $s50 $s51 $s52 $s53 $s54 $s55 $s56 $s57 $s58 $s59 $s60 $s61 $s62 $s63 $s64 $s65 $s66 $s67 $s68 $s69 $s70 $s71 $s72 $s73 $s74 $s75 $s76 $s77 $s78 $s79 $s80 $s81 $s82 $s83 $s84 $s85 $s86 $s87 $s88 $s89 $s90 $s91 $s92 $s93 $s94 $s95 $s96 $s97 $s98 $s99 $s100 $s101 $s102 $s103 $s104 $s105 $s106 $s107 $s108 $s109 $s110 $s111 $s112 $s113 $s114 $s115 $s116 $s117 $s118 $s119 $s120 $s121 $s122 $s123 $s124 $s125 $s126 $s127 $s128 $s129 $s130 $s131 $s132 $s133 $s134 $s135 $s136 $s137 $s138 $s139 $s140 $s141 $s142 $s143 $s144 $s145 $s146 $s147 $s148 $s149 $s150 $s151 $s152 $s153 $s154 $s155 $s156 $s157 $s158 $s159 $s160 $s161 $s162 $s163 $s164 $s165 $s166 $s167 $s168 $s169 $s170 $s171 $s172 $s173 $s174 $s175 $s176 $s177 $s178 $s179 $s180 $s181 $s182 $s183 $s184 $s185 $s186 $s187 $s188 $s189 $s190 $s191 $s192 $s193 $s194 $s195 $s196 $s197 $s198 $s199 $s200 $s201 $s202 $s203 $s204 $s205 $s206 $s207 $s208 $s209 $s210 $s211 $s212 $s213 $s214 $s215 $s216 $s217 $s218 $s219 $s220 $s221 $s222 $s223 $s224 $s225 $s226 $s227 $s228 $s229 $s230 $s231 $s232 $s233 $s234 $s235 $s236 $s237 $s238 $s239 $s240 $s241 $s242 $s243 $s244 $s245 $s246 $s247 $s248 $s249 $s250 $s251 $s252 $s253 $s254 $s255 (local.get $s))
+      )
+      ;; state 0
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 0)))
+      (br $top)
+      )
+      ;; state 1
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 8)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 1)))
+      (br $top)
+      )
+      ;; state 2
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 15)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 2)))
+      (br $top)
+      )
+      ;; state 3
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 22)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 3)))
+      (br $top)
+      )
+      ;; state 4
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 29)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 4)))
+      (br $top)
+      )
+      ;; state 5
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 36)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 5)))
+      (br $top)
+      )
+      ;; state 6
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 43)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 6)))
+      (br $top)
+      )
+      ;; state 7
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 50)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 7)))
+      (br $top)
+      )
+      ;; state 8
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 57)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 8)))
+      (br $top)
+      )
+      ;; state 9
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 64)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 9)))
+      (br $top)
+      )
+      ;; state 10
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 71)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 10)))
+      (br $top)
+      )
+      ;; state 11
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 78)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 11)))
+      (br $top)
+      )
+      ;; state 12
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 85)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 12)))
+      (br $top)
+      )
+      ;; state 13
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 92)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 13)))
+      (br $top)
+      )
+      ;; state 14
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 99)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 14)))
+      (br $top)
+      )
+      ;; state 15
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 106)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 15)))
+      (br $top)
+      )
+      ;; state 16
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 113)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 16)))
+      (br $top)
+      )
+      ;; state 17
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 120)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 17)))
+      (br $top)
+      )
+      ;; state 18
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 127)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 18)))
+      (br $top)
+      )
+      ;; state 19
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 134)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 19)))
+      (br $top)
+      )
+      ;; state 20
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 141)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 20)))
+      (br $top)
+      )
+      ;; state 21
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 148)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 21)))
+      (br $top)
+      )
+      ;; state 22
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 155)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 22)))
+      (br $top)
+      )
+      ;; state 23
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 162)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 23)))
+      (br $top)
+      )
+      ;; state 24
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 169)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 24)))
+      (br $top)
+      )
+      ;; state 25
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 176)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 25)))
+      (br $top)
+      )
+      ;; state 26
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 183)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 26)))
+      (br $top)
+      )
+      ;; state 27
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 190)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 27)))
+      (br $top)
+      )
+      ;; state 28
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 197)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 28)))
+      (br $top)
+      )
+      ;; state 29
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 204)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 29)))
+      (br $top)
+      )
+      ;; state 30
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 211)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 30)))
+      (br $top)
+      )
+      ;; state 31
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 218)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 31)))
+      (br $top)
+      )
+      ;; state 32
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 225)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 32)))
+      (br $top)
+      )
+      ;; state 33
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 232)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 33)))
+      (br $top)
+      )
+      ;; state 34
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 239)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 34)))
+      (br $top)
+      )
+      ;; state 35
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 246)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 35)))
+      (br $top)
+      )
+      ;; state 36
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 253)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 36)))
+      (br $top)
+      )
+      ;; state 37
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 260)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 37)))
+      (br $top)
+      )
+      ;; state 38
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 267)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 38)))
+      (br $top)
+      )
+      ;; state 39
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 274)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 39)))
+      (br $top)
+      )
+      ;; state 40
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 281)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 40)))
+      (br $top)
+      )
+      ;; state 41
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 288)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 41)))
+      (br $top)
+      )
+      ;; state 42
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 295)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 42)))
+      (br $top)
+      )
+      ;; state 43
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 302)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 43)))
+      (br $top)
+      )
+      ;; state 44
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 309)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 44)))
+      (br $top)
+      )
+      ;; state 45
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 316)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 45)))
+      (br $top)
+      )
+      ;; state 46
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 323)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 46)))
+      (br $top)
+      )
+      ;; state 47
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 330)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 47)))
+      (br $top)
+      )
+      ;; state 48
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 337)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 48)))
+      (br $top)
+      )
+      ;; state 49
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 344)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 49)))
+      (br $top)
+      )
+      ;; state 50
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 351)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 50)))
+      (br $top)
+      )
+      ;; state 51
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 358)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 51)))
+      (br $top)
+      )
+      ;; state 52
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 365)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 52)))
+      (br $top)
+      )
+      ;; state 53
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 372)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 53)))
+      (br $top)
+      )
+      ;; state 54
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 379)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 54)))
+      (br $top)
+      )
+      ;; state 55
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 386)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 55)))
+      (br $top)
+      )
+      ;; state 56
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 393)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 56)))
+      (br $top)
+      )
+      ;; state 57
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 400)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 57)))
+      (br $top)
+      )
+      ;; state 58
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 407)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 58)))
+      (br $top)
+      )
+      ;; state 59
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 414)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 59)))
+      (br $top)
+      )
+      ;; state 60
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 421)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 60)))
+      (br $top)
+      )
+      ;; state 61
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 428)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 61)))
+      (br $top)
+      )
+      ;; state 62
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 435)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 62)))
+      (br $top)
+      )
+      ;; state 63
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 442)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 63)))
+      (br $top)
+      )
+      ;; state 64
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 449)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 64)))
+      (br $top)
+      )
+      ;; state 65
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 456)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 65)))
+      (br $top)
+      )
+      ;; state 66
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 463)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 66)))
+      (br $top)
+      )
+      ;; state 67
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 470)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 67)))
+      (br $top)
+      )
+      ;; state 68
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 477)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 68)))
+      (br $top)
+      )
+      ;; state 69
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 484)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 69)))
+      (br $top)
+      )
+      ;; state 70
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 491)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 70)))
+      (br $top)
+      )
+      ;; state 71
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 498)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 71)))
+      (br $top)
+      )
+      ;; state 72
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 505)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 72)))
+      (br $top)
+      )
+      ;; state 73
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 512)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 73)))
+      (br $top)
+      )
+      ;; state 74
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 519)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 74)))
+      (br $top)
+      )
+      ;; state 75
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 526)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 75)))
+      (br $top)
+      )
+      ;; state 76
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 533)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 76)))
+      (br $top)
+      )
+      ;; state 77
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 540)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 77)))
+      (br $top)
+      )
+      ;; state 78
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 547)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 78)))
+      (br $top)
+      )
+      ;; state 79
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 554)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 79)))
+      (br $top)
+      )
+      ;; state 80
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 561)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 80)))
+      (br $top)
+      )
+      ;; state 81
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 568)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 81)))
+      (br $top)
+      )
+      ;; state 82
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 575)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 82)))
+      (br $top)
+      )
+      ;; state 83
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 582)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 83)))
+      (br $top)
+      )
+      ;; state 84
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 589)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 84)))
+      (br $top)
+      )
+      ;; state 85
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 596)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 85)))
+      (br $top)
+      )
+      ;; state 86
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 603)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 86)))
+      (br $top)
+      )
+      ;; state 87
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 610)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 87)))
+      (br $top)
+      )
+      ;; state 88
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 617)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 88)))
+      (br $top)
+      )
+      ;; state 89
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 624)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 89)))
+      (br $top)
+      )
+      ;; state 90
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 631)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 90)))
+      (br $top)
+      )
+      ;; state 91
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 638)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 91)))
+      (br $top)
+      )
+      ;; state 92
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 645)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 92)))
+      (br $top)
+      )
+      ;; state 93
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 652)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 93)))
+      (br $top)
+      )
+      ;; state 94
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 659)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 94)))
+      (br $top)
+      )
+      ;; state 95
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 666)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 95)))
+      (br $top)
+      )
+      ;; state 96
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 673)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 96)))
+      (br $top)
+      )
+      ;; state 97
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 680)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 97)))
+      (br $top)
+      )
+      ;; state 98
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 687)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 98)))
+      (br $top)
+      )
+      ;; state 99
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 694)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 99)))
+      (br $top)
+      )
+      ;; state 100
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 701)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 100)))
+      (br $top)
+      )
+      ;; state 101
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 708)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 101)))
+      (br $top)
+      )
+      ;; state 102
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 715)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 102)))
+      (br $top)
+      )
+      ;; state 103
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 722)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 103)))
+      (br $top)
+      )
+      ;; state 104
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 729)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 104)))
+      (br $top)
+      )
+      ;; state 105
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 736)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 105)))
+      (br $top)
+      )
+      ;; state 106
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 743)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 106)))
+      (br $top)
+      )
+      ;; state 107
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 750)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 107)))
+      (br $top)
+      )
+      ;; state 108
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 757)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 108)))
+      (br $top)
+      )
+      ;; state 109
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 764)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 109)))
+      (br $top)
+      )
+      ;; state 110
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 771)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 110)))
+      (br $top)
+      )
+      ;; state 111
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 778)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 111)))
+      (br $top)
+      )
+      ;; state 112
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 785)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 112)))
+      (br $top)
+      )
+      ;; state 113
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 792)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 113)))
+      (br $top)
+      )
+      ;; state 114
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 799)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 114)))
+      (br $top)
+      )
+      ;; state 115
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 806)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 115)))
+      (br $top)
+      )
+      ;; state 116
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 813)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 116)))
+      (br $top)
+      )
+      ;; state 117
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 820)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 117)))
+      (br $top)
+      )
+      ;; state 118
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 827)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 118)))
+      (br $top)
+      )
+      ;; state 119
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 834)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 119)))
+      (br $top)
+      )
+      ;; state 120
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 841)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 120)))
+      (br $top)
+      )
+      ;; state 121
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 848)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 121)))
+      (br $top)
+      )
+      ;; state 122
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 855)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 122)))
+      (br $top)
+      )
+      ;; state 123
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 862)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 123)))
+      (br $top)
+      )
+      ;; state 124
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 869)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 124)))
+      (br $top)
+      )
+      ;; state 125
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 876)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 125)))
+      (br $top)
+      )
+      ;; state 126
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 883)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 126)))
+      (br $top)
+      )
+      ;; state 127
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 890)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 127)))
+      (br $top)
+      )
+      ;; state 128
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 897)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 128)))
+      (br $top)
+      )
+      ;; state 129
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 904)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 129)))
+      (br $top)
+      )
+      ;; state 130
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 911)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 130)))
+      (br $top)
+      )
+      ;; state 131
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 918)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 131)))
+      (br $top)
+      )
+      ;; state 132
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 925)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 132)))
+      (br $top)
+      )
+      ;; state 133
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 932)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 133)))
+      (br $top)
+      )
+      ;; state 134
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 939)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 134)))
+      (br $top)
+      )
+      ;; state 135
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 946)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 135)))
+      (br $top)
+      )
+      ;; state 136
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 953)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 136)))
+      (br $top)
+      )
+      ;; state 137
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 960)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 137)))
+      (br $top)
+      )
+      ;; state 138
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 967)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 138)))
+      (br $top)
+      )
+      ;; state 139
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 974)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 139)))
+      (br $top)
+      )
+      ;; state 140
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 981)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 140)))
+      (br $top)
+      )
+      ;; state 141
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 988)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 141)))
+      (br $top)
+      )
+      ;; state 142
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 995)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 142)))
+      (br $top)
+      )
+      ;; state 143
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1002)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 143)))
+      (br $top)
+      )
+      ;; state 144
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1009)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 144)))
+      (br $top)
+      )
+      ;; state 145
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1016)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 145)))
+      (br $top)
+      )
+      ;; state 146
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1023)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 146)))
+      (br $top)
+      )
+      ;; state 147
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1030)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 147)))
+      (br $top)
+      )
+      ;; state 148
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1037)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 148)))
+      (br $top)
+      )
+      ;; state 149
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1044)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 149)))
+      (br $top)
+      )
+      ;; state 150
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1051)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 150)))
+      (br $top)
+      )
+      ;; state 151
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1058)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 151)))
+      (br $top)
+      )
+      ;; state 152
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1065)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 152)))
+      (br $top)
+      )
+      ;; state 153
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1072)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 153)))
+      (br $top)
+      )
+      ;; state 154
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1079)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 154)))
+      (br $top)
+      )
+      ;; state 155
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1086)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 155)))
+      (br $top)
+      )
+      ;; state 156
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1093)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 156)))
+      (br $top)
+      )
+      ;; state 157
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1100)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 157)))
+      (br $top)
+      )
+      ;; state 158
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1107)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 158)))
+      (br $top)
+      )
+      ;; state 159
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1114)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 159)))
+      (br $top)
+      )
+      ;; state 160
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1121)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 160)))
+      (br $top)
+      )
+      ;; state 161
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1128)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 161)))
+      (br $top)
+      )
+      ;; state 162
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1135)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 162)))
+      (br $top)
+      )
+      ;; state 163
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1142)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 163)))
+      (br $top)
+      )
+      ;; state 164
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1149)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 164)))
+      (br $top)
+      )
+      ;; state 165
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1156)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 165)))
+      (br $top)
+      )
+      ;; state 166
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1163)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 166)))
+      (br $top)
+      )
+      ;; state 167
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1170)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 167)))
+      (br $top)
+      )
+      ;; state 168
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1177)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 168)))
+      (br $top)
+      )
+      ;; state 169
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1184)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 169)))
+      (br $top)
+      )
+      ;; state 170
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1191)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 170)))
+      (br $top)
+      )
+      ;; state 171
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1198)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 171)))
+      (br $top)
+      )
+      ;; state 172
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1205)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 172)))
+      (br $top)
+      )
+      ;; state 173
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1212)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 173)))
+      (br $top)
+      )
+      ;; state 174
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1219)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 174)))
+      (br $top)
+      )
+      ;; state 175
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1226)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 175)))
+      (br $top)
+      )
+      ;; state 176
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1233)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 176)))
+      (br $top)
+      )
+      ;; state 177
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1240)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 177)))
+      (br $top)
+      )
+      ;; state 178
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1247)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 178)))
+      (br $top)
+      )
+      ;; state 179
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1254)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 179)))
+      (br $top)
+      )
+      ;; state 180
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1261)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 180)))
+      (br $top)
+      )
+      ;; state 181
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1268)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 181)))
+      (br $top)
+      )
+      ;; state 182
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1275)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 182)))
+      (br $top)
+      )
+      ;; state 183
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1282)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 183)))
+      (br $top)
+      )
+      ;; state 184
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1289)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 184)))
+      (br $top)
+      )
+      ;; state 185
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1296)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 185)))
+      (br $top)
+      )
+      ;; state 186
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1303)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 186)))
+      (br $top)
+      )
+      ;; state 187
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1310)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 187)))
+      (br $top)
+      )
+      ;; state 188
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1317)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 188)))
+      (br $top)
+      )
+      ;; state 189
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1324)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 189)))
+      (br $top)
+      )
+      ;; state 190
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1331)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 190)))
+      (br $top)
+      )
+      ;; state 191
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1338)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 191)))
+      (br $top)
+      )
+      ;; state 192
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1345)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 192)))
+      (br $top)
+      )
+      ;; state 193
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1352)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 193)))
+      (br $top)
+      )
+      ;; state 194
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1359)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 194)))
+      (br $top)
+      )
+      ;; state 195
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1366)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 195)))
+      (br $top)
+      )
+      ;; state 196
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1373)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 196)))
+      (br $top)
+      )
+      ;; state 197
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1380)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 197)))
+      (br $top)
+      )
+      ;; state 198
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1387)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 198)))
+      (br $top)
+      )
+      ;; state 199
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1394)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 199)))
+      (br $top)
+      )
+      ;; state 200
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1401)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 200)))
+      (br $top)
+      )
+      ;; state 201
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1408)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 201)))
+      (br $top)
+      )
+      ;; state 202
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1415)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 202)))
+      (br $top)
+      )
+      ;; state 203
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1422)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 203)))
+      (br $top)
+      )
+      ;; state 204
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1429)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 204)))
+      (br $top)
+      )
+      ;; state 205
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1436)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 205)))
+      (br $top)
+      )
+      ;; state 206
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1443)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 206)))
+      (br $top)
+      )
+      ;; state 207
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1450)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 207)))
+      (br $top)
+      )
+      ;; state 208
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1457)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 208)))
+      (br $top)
+      )
+      ;; state 209
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1464)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 209)))
+      (br $top)
+      )
+      ;; state 210
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1471)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 210)))
+      (br $top)
+      )
+      ;; state 211
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1478)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 211)))
+      (br $top)
+      )
+      ;; state 212
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1485)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 212)))
+      (br $top)
+      )
+      ;; state 213
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1492)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 213)))
+      (br $top)
+      )
+      ;; state 214
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1499)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 214)))
+      (br $top)
+      )
+      ;; state 215
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1506)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 215)))
+      (br $top)
+      )
+      ;; state 216
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1513)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 216)))
+      (br $top)
+      )
+      ;; state 217
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1520)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 217)))
+      (br $top)
+      )
+      ;; state 218
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1527)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 218)))
+      (br $top)
+      )
+      ;; state 219
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1534)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 219)))
+      (br $top)
+      )
+      ;; state 220
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1541)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 220)))
+      (br $top)
+      )
+      ;; state 221
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1548)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 221)))
+      (br $top)
+      )
+      ;; state 222
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1555)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 222)))
+      (br $top)
+      )
+      ;; state 223
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1562)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 223)))
+      (br $top)
+      )
+      ;; state 224
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1569)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 224)))
+      (br $top)
+      )
+      ;; state 225
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1576)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 225)))
+      (br $top)
+      )
+      ;; state 226
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1583)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 226)))
+      (br $top)
+      )
+      ;; state 227
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1590)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 227)))
+      (br $top)
+      )
+      ;; state 228
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1597)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 228)))
+      (br $top)
+      )
+      ;; state 229
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1604)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 229)))
+      (br $top)
+      )
+      ;; state 230
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1611)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 230)))
+      (br $top)
+      )
+      ;; state 231
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1618)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 231)))
+      (br $top)
+      )
+      ;; state 232
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1625)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 232)))
+      (br $top)
+      )
+      ;; state 233
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1632)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 233)))
+      (br $top)
+      )
+      ;; state 234
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1639)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 234)))
+      (br $top)
+      )
+      ;; state 235
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1646)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 235)))
+      (br $top)
+      )
+      ;; state 236
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1653)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 236)))
+      (br $top)
+      )
+      ;; state 237
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1660)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 237)))
+      (br $top)
+      )
+      ;; state 238
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1667)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 238)))
+      (br $top)
+      )
+      ;; state 239
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1674)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 239)))
+      (br $top)
+      )
+      ;; state 240
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1681)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 240)))
+      (br $top)
+      )
+      ;; state 241
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1688)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 241)))
+      (br $top)
+      )
+      ;; state 242
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1695)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 242)))
+      (br $top)
+      )
+      ;; state 243
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1702)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 243)))
+      (br $top)
+      )
+      ;; state 244
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1709)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 244)))
+      (br $top)
+      )
+      ;; state 245
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1716)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 245)))
+      (br $top)
+      )
+      ;; state 246
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1723)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 246)))
+      (br $top)
+      )
+      ;; state 247
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1730)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 247)))
+      (br $top)
+      )
+      ;; state 248
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1737)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 248)))
+      (br $top)
+      )
+      ;; state 249
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1744)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 249)))
+      (br $top)
+      )
+      ;; state 250
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1751)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 250)))
+      (br $top)
+      )
+      ;; state 251
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1758)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 251)))
+      (br $top)
+      )
+      ;; state 252
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1765)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 252)))
+      (br $top)
+      )
+      ;; state 253
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1772)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 253)))
+      (br $top)
+      )
+      ;; state 254
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1779)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 254)))
+      (br $top)
+      )
+      ;; state 255
+      (local.set $s (i32.and (i32.add (i32.mul (local.get $s) (i32.const 13)) (i32.const 1786)) (i32.const 255)))
+      (local.set $acc (i32.add (local.get $acc) (i32.const 255)))
+      (br $top)
+    )
+    (local.get $acc)
+  )
+
+  (export "run" (func $run))
+)
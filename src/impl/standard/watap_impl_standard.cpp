@@ -5,13 +5,15 @@
 namespace watap::impl::standard
 {
   /* Interface create function.
-   * ARGUMENTS: None.
+   * ARGUMENTS:
+   *   - implementation settings:
+   *       const settings &Settings;
    * RETURNS:
    *   (interface *) Created interface pointer;
    */
-  interface * Create( VOID )
+  interface * Create( const settings &Settings )
   {
-    return new interface_impl();
+    return new interface_impl(Settings);
   } /* End of 'Create' function */
 
   /* Interface create function.
@@ -8,12 +8,85 @@
 /* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
 namespace watap::impl::standard
 {
+  /* Interpreter instruction dispatch technique representation enumeration */
+  enum class dispatch_type : UINT8
+  {
+    eSwitch,   // Plain 'switch' over instruction stream
+    eThreaded, // Direct-threaded code, handler addresses are resolved once during function linking
+  }; /* End of 'dispatch_type' enumeration */
+
+  /* Compiled function bytecode format representation enumeration */
+  enum class bytecode_type : UINT8
+  {
+    eStack,       // Validated WASM stack bytecode, operands are passed through evaluation stack
+    eRegister,    // Three-operand bytecode, operands are addressed by local frame slot
+    eCachedStack, // Stack bytecode, evaluation stack top value is kept in host register (handler variant is chosen by cached value type)
+    eNative,      // Host machine code, compiled by single pass baseline compiler (x86-64 Linux only, stack bytecode is kept on other platforms)
+  }; /* End of 'bytecode_type' enumeration */
+
+  /* 'br_table' instruction lowering representation enumeration */
+  enum class branch_table_lowering : UINT8
+  {
+    eJumpTable,  // Dense bounds-clamped table of branch targets, indexed by operand
+    eLinearScan, // Operand is compared with every label index ('br_if' chain)
+  }; /* End of 'branch_table_lowering' enumeration */
+
+  /* Linear memory address space reservation policy representation enumeration */
+  enum class memory_reservation : UINT8
+  {
+    eGuarded, // Whole address range native code can access is reserved, accesses out of memory hit guard pages and aren't checked by native code (x86-64 Linux only, 'eMaximum' is used on other platforms)
+    eMaximum, // Memory maximum size (declared by module) is reserved only, memory accesses are bounds checked (many instances may share address space)
+  }; /* End of 'memory_reservation' enumeration */
+
+  /* Superinstruction fusion statistics (instruction sequence frequencies of compiled stack bytecode) representation structure */
+  struct fusion_statistics
+  {
+    std::map<std::vector<UINT8>, UINT64> SequenceCounts; // Occurrence counts of every 2 and 3 instruction long sequence (keyed by opcodes)
+  }; /* End of 'fusion_statistics' structure */
+
+  /* Bytecode optimization report representation structure */
+  struct optimization_report
+  {
+    std::map<UINT32, SIZE_T> RemovedInstructionCounts; // Count of instructions removed by constant folding and peephole optimization (keyed by function index)
+    std::map<UINT32, std::vector<UINT32>> InlinedFunctions; // Indices of functions, calls of which are inlined, in inlining order (keyed by caller function index)
+  }; /* End of 'optimization_report' structure */
+
+  /* Standard implementation settings representation structure */
+  struct settings
+  {
+    dispatch_type Dispatch = dispatch_type::eThreaded; // Interpreter dispatch technique (falls back to 'eSwitch' if compiler doesn't support threaded code)
+    bytecode_type Bytecode = bytecode_type::eStack;    // Bytecode format of created sources (functions, that can't be lowered to registers, cached or compiled to native code, stay in stack format)
+    branch_table_lowering BranchTable = branch_table_lowering::eJumpTable; // 'br_table' instruction lowering
+    BOOL Optimization = TRUE;                          // Fold constants and remove redundant instructions of validated bytecode
+    optimization_report *OptimizationReport = nullptr; // Report to record count of instructions removed from every compiled function to, nullptr if not required
+    BOOL Fusion = TRUE;                                // Fuse frequent stack bytecode instruction sequences into superinstructions
+    fusion_statistics *FusionStatistics = nullptr;     // Statistics to record instruction sequences of every compiled stack bytecode function to (before fusion), nullptr if not required
+    UINT32 TierUpCallCount = 1000;                     // Count of calls, after which function is compiled by optimizing compiler (x86-64 Linux only), 0 disables call counting
+    UINT32 TierUpBackEdgeCount = 10000;                // Count of taken loop back edges, after which function is compiled by optimizing compiler, 0 disables back edge counting
+    UINT32 InlineBudget = 48;                          // Maximal size of function body (in bytes of WASM code), calls of which are inlined by compiler, 0 disables inlining
+    UINT32 CallStackDepth = 16384;                     // Maximal depth of guest calls (call stack of every instance is allocated once), deeper call traps
+    memory_reservation MemoryReservation = memory_reservation::eGuarded; // Linear memory address space reservation policy
+    UINT32 MemoryGrowthGranularity = 16;               // Count of pages, committed memory size is rounded up to by 'memory.grow' (guarded memory is committed exactly, as guard pages start at its end)
+  }; /* End of 'settings' structure */
+
+  /* Superinstruction table generation function.
+   * ARGUMENTS:
+   *   - stream to write table ('watap_impl_standard_fusion_table.h' file contents) to:
+   *       std::ostream &Stream;
+   *   - recorded instruction sequence statistics:
+   *       const fusion_statistics &Statistics;
+   * RETURNS: None.
+   */
+  VOID WriteFusionTable( std::ostream &Stream, const fusion_statistics &Statistics );
+
   /* Interface create function.
-   * ARGUMENTS: None.
+   * ARGUMENTS:
+   *   - implementation settings:
+   *       const settings &Settings = {};
    * RETURNS:
    *   (interface *) Created interface pointer;
    */
-  interface * Create( VOID );
+  interface * Create( const settings &Settings = {} );
 
   /* Interface create function.
    * ARGUMENTS:
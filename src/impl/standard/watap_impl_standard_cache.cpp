@@ -0,0 +1,555 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_interface.h"
+#include "watap_impl_standard_exec.h"
+
+#include <algorithm>
+
+/***
+ * Cached stack bytecode.
+ *
+ * Stack bytecode, which execution engine keeps evaluation stack top value in host register ('Tos')
+ * instead of evaluation stack memory. Value producing instructions put result into the register and
+ * consuming instructions take their top operand from it, so binary operation does a single memory
+ * load instead of two loads and a store.
+ *
+ * Every instruction is compiled with cache state, it's entered with (stored in instruction data upper bits):
+ *   0 - nothing is cached, all values are on evaluation stack;
+ *   1 - 32 bit value (i32, f32, reference) is cached;
+ *   2 - 64 bit value (i64, f64) is cached.
+ * Cache state is determined by types of values, instructions produce, so every handler is generated in
+ * three variants (one per state) from the same instruction lists. Producer, entered with value cached,
+ * spills it to evaluation stack first. Control transfers (calls, returns, branches) spill cached
+ * value too, so branch targets are always entered with nothing cached ('nop' spills cached value if
+ * target is entered by fallthrough).
+ ***/
+
+/* Cached operand popping macro (cached value if anything is cached, evaluation stack top value otherwise) */
+#define WATAP_STANDARD_CACHE_POP(STATE, TYPE) ((STATE) != 0 ? exec_util::FromCacheBits<TYPE>(Tos) : WATAP_STANDARD_STACK_POP(TYPE))
+
+/* Result caching macro */
+#define WATAP_STANDARD_CACHE_SET(TYPE, VALUE) (Tos = exec_util::ToCacheBits<TYPE>(static_cast<TYPE>(VALUE)))
+
+/* Cached value to evaluation stack spilling macro (cached value bits form evaluation stack slot) */
+#define WATAP_STANDARD_CACHE_SPILL(STATE)                                                                \
+{                                                                                                        \
+  if constexpr ((STATE) != 0)                                                                            \
+    WATAP_STANDARD_STACK_PUSH_SLOT(Tos);                                                                 \
+}
+
+/* Binary operation operands getting macro (right operand is the cached one) */
+#define WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE) \
+  const TYPE Rhs = WATAP_STANDARD_CACHE_POP(STATE, TYPE); const TYPE Lhs = WATAP_STANDARD_STACK_POP(TYPE);
+
+/***
+ * Cached stack bytecode instruction implementations (by 'WATAP_STANDARD_*_INSTRUCTIONS' list KIND)
+ ***/
+
+/* Cached binary operator and function implementation generation macros */
+#define WATAP_STANDARD_CACHE_OP_BINARY(STATE, TYPE, OP) { WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE) WATAP_STANDARD_CACHE_SET(TYPE, Lhs OP Rhs); }
+#define WATAP_STANDARD_CACHE_FN_BINARY(STATE, TYPE, FN) { WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE) WATAP_STANDARD_CACHE_SET(TYPE, FN(Lhs, Rhs)); }
+
+/* Cached shift and rotation implementation generation macros (shift count is taken by module of bit count) */
+#define WATAP_STANDARD_CACHE_SHIFT(STATE, TYPE, OP) { WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE) WATAP_STANDARD_CACHE_SET(TYPE, Lhs OP (Rhs & (sizeof(TYPE) * 8 - 1))); }
+#define WATAP_STANDARD_CACHE_ROTATE(STATE, TYPE, FN) { WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE) WATAP_STANDARD_CACHE_SET(TYPE, FN(Lhs, static_cast<INT>(Rhs & (sizeof(TYPE) * 8 - 1)))); }
+
+/* Cached comparison operator implementation generation macro */
+#define WATAP_STANDARD_CACHE_COMPARE(STATE, TYPE, OP) { WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE) WATAP_STANDARD_CACHE_SET(UINT32, Lhs OP Rhs); }
+
+/* Cached signed division implementation generation macro (traps on zero division and overflow) */
+#define WATAP_STANDARD_CACHE_DIV_S(STATE, TYPE)                                       \
+{                                                                                     \
+  WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE)                                          \
+  if (Rhs == 0 || (Rhs == -1 && Lhs == std::numeric_limits<TYPE>::min()))             \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_CACHE_SET(TYPE, Lhs / Rhs);                                          \
+}
+
+/* Cached signed remainder implementation generation macro (traps on zero division) */
+#define WATAP_STANDARD_CACHE_REM_S(STATE, TYPE)                                       \
+{                                                                                     \
+  WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE)                                          \
+  if (Rhs == 0)                                                                       \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_CACHE_SET(TYPE, Rhs == -1 ? 0 : Lhs % Rhs);                          \
+}
+
+/* Cached unsigned division/remainder implementation generation macro (traps on zero division) */
+#define WATAP_STANDARD_CACHE_DIV_U(STATE, TYPE, OP)                                   \
+{                                                                                     \
+  WATAP_STANDARD_CACHE_OPERANDS(STATE, TYPE)                                          \
+  if (Rhs == 0)                                                                       \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_CACHE_SET(TYPE, Lhs OP Rhs);                                         \
+}
+
+/* Cached unary function, 'equal to zero', integer extend and conversion implementation generation macros */
+#define WATAP_STANDARD_CACHE_FN_UNARY(STATE, TYPE, FN) { WATAP_STANDARD_CACHE_SET(TYPE, FN(WATAP_STANDARD_CACHE_POP(STATE, TYPE))); }
+#define WATAP_STANDARD_CACHE_EQZ(STATE, TYPE) { WATAP_STANDARD_CACHE_SET(UINT32, WATAP_STANDARD_CACHE_POP(STATE, TYPE) == 0); }
+#define WATAP_STANDARD_CACHE_I_EXTEND(STATE, BASE, SUB) { WATAP_STANDARD_CACHE_SET(BASE, static_cast<SUB>(WATAP_STANDARD_CACHE_POP(STATE, BASE))); }
+#define WATAP_STANDARD_CACHE_CAST(STATE, FROM, TO) { WATAP_STANDARD_CACHE_SET(TO, WATAP_STANDARD_CACHE_POP(STATE, FROM)); }
+
+/* Cached floating point to integer truncation implementation generation macro (traps on unrepresentable result) */
+#define WATAP_STANDARD_CACHE_TRUNC(STATE, FROM, TO)                                   \
+{                                                                                     \
+  const FROM Value = WATAP_STANDARD_CACHE_POP(STATE, FROM);                           \
+  if (!exec_util::IsTruncatable<TO>(Value))                                           \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_CACHE_SET(TO, Value);                                                \
+}
+
+/* Cached heap loading with builtin conversion implementaion function */
+#define WATAP_STANDARD_CACHE_LOAD(STATE, TYPE, FROM)                                                      \
+{                                                                                                         \
+  const UINT64 Address = static_cast<UINT64>(WATAP_STANDARD_CACHE_POP(STATE, UINT32)) + WATAP_STANDARD_IMM_U32(1); \
+  if (Address + sizeof(FROM) > Heap.Size())                                                               \
+    WATAP_STANDARD_TRAP();                                                                                \
+  FROM Value;                                                                                             \
+  std::memcpy(&Value, Heap.Data() + Address, sizeof(FROM));                                               \
+  WATAP_STANDARD_CACHE_SET(TYPE, Value);                                                                  \
+}
+
+/* Cached heap storing with builtin conversion implementaion function */
+#define WATAP_STANDARD_CACHE_STORE(STATE, TYPE, TO)                                                       \
+{                                                                                                         \
+  const TO Value = static_cast<TO>(WATAP_STANDARD_CACHE_POP(STATE, TYPE));                                \
+  const UINT64 Address = static_cast<UINT64>(WATAP_STANDARD_STACK_POP(UINT32)) + WATAP_STANDARD_IMM_U32(1); \
+  if (Address + sizeof(TO) > Heap.Size())                                                                 \
+    WATAP_STANDARD_TRAP();                                                                                \
+  std::memcpy(Heap.Data() + Address, &Value, sizeof(TO));                                                 \
+}
+
+/* Cached nop implementation macro (nop is used to spill cached value before branch target) */
+#define WATAP_STANDARD_CACHE_NOP(STATE, ...) WATAP_STANDARD_CACHE_SPILL(STATE)
+
+/* Cached value dropping implementation macro */
+#define WATAP_STANDARD_CACHE_DROP(STATE, ...)                                                            \
+{                                                                                                        \
+  if constexpr ((STATE) == 0)                                                                            \
+    EvaluationStack.Pop(sizeof(UINT64));                                                                 \
+}
+
+/* Cached value selection implementation macro (condition may be cached, selected value is left on evaluation stack) */
+#define WATAP_STANDARD_CACHE_SELECT(STATE, ...)                                                          \
+{                                                                                                        \
+  const UINT32 Condition = WATAP_STANDARD_CACHE_POP(STATE, UINT32);                                      \
+  UINT64 *Rhs = EvaluationStack.Pop<UINT64>(sizeof(UINT64));                                             \
+  if (Condition == 0)                                                                                    \
+    Rhs[-1] = *Rhs;                                                                                      \
+}
+
+/* Cached local variable access implementation macros (whole 8 byte local slot is cached) */
+#define WATAP_STANDARD_CACHE_LOCAL_GET(STATE, ...) { WATAP_STANDARD_CACHE_SPILL(STATE) Tos = Frame[WATAP_STANDARD_IMM_U16(1)]; }
+#define WATAP_STANDARD_CACHE_LOCAL_SET(STATE, ...)                                                       \
+{                                                                                                        \
+  if constexpr ((STATE) != 0)                                                                            \
+    Frame[WATAP_STANDARD_IMM_U16(1)] = Tos;                                                              \
+  else                                                                                                   \
+    Frame[WATAP_STANDARD_IMM_U16(1)] = *EvaluationStack.Pop<UINT64>(sizeof(UINT64));                     \
+}
+#define WATAP_STANDARD_CACHE_LOCAL_TEE(STATE, ...)                                                       \
+{                                                                                                        \
+  if constexpr ((STATE) != 0)                                                                            \
+    Frame[WATAP_STANDARD_IMM_U16(1)] = Tos;                                                              \
+  else                                                                                                   \
+    Frame[WATAP_STANDARD_IMM_U16(1)] = EvaluationStack.Get<UINT64>()[-1];                                \
+}
+
+/* Cached memory size query and growing implementation macros */
+#define WATAP_STANDARD_CACHE_MEMORY_SIZE(STATE, ...) { WATAP_STANDARD_CACHE_SPILL(STATE) WATAP_STANDARD_CACHE_SET(UINT32, Heap.Size() / 65536); }
+#define WATAP_STANDARD_CACHE_MEMORY_GROW(STATE, ...) { WATAP_STANDARD_CACHE_SET(UINT32, Instance->GrowMemory(WATAP_STANDARD_CACHE_POP(STATE, UINT32))); }
+
+/* Cached constant implementation macro (floating point constants are cached by bit pattern) */
+#define WATAP_STANDARD_CACHE_CONST(STATE, TYPE, BITS) { WATAP_STANDARD_CACHE_SPILL(STATE) Tos = WATAP_STANDARD_IMM_U##BITS(1); }
+
+/* Cached reference implementation macros (references are function index plus one, null reference is zero) */
+#define WATAP_STANDARD_CACHE_REF_NULL(STATE, ...) { WATAP_STANDARD_CACHE_SPILL(STATE) Tos = 0; }
+#define WATAP_STANDARD_CACHE_REF_FUNC(STATE, ...) { WATAP_STANDARD_CACHE_SPILL(STATE) Tos = WATAP_STANDARD_IMM_U32(1) + 1; }
+
+/* Cached control transfer implementation macros (calls and returns are implemented once, after cached value is spilled) */
+#define WATAP_STANDARD_CACHE_UNREACHABLE(STATE, ...) WATAP_STANDARD_TRAP();
+#define WATAP_STANDARD_CACHE_RETURN(STATE, ...) { WATAP_STANDARD_CACHE_SPILL(STATE) goto L_Return; }
+#define WATAP_STANDARD_CACHE_CALL(STATE, ...) { WATAP_STANDARD_CACHE_SPILL(STATE) goto L_Call; }
+#define WATAP_STANDARD_CACHE_RETURN_CALL(STATE, ...) { WATAP_STANDARD_CACHE_SPILL(STATE) goto L_ReturnCall; }
+#define WATAP_STANDARD_CACHE_IF(STATE, ...)                                                              \
+  if (WATAP_STANDARD_CACHE_POP(STATE, UINT32) == 0)                                                      \
+  {                                                                                                      \
+    const branch_target &Target = Targets[WATAP_STANDARD_IMM_U32(1)];                                    \
+                                                                                                         \
+    Ip = Target.Ip;                                                                                      \
+    WATAP_STANDARD_DISPATCH_TO(Target.Handler);                                                          \
+  }
+#define WATAP_STANDARD_CACHE_BR(STATE, ...) { WATAP_STANDARD_CACHE_SPILL(STATE) WATAP_STANDARD_STACK_BRANCH(Targets[WATAP_STANDARD_IMM_U32(1)]) }
+#define WATAP_STANDARD_CACHE_BR_IF(STATE, ...)                                                           \
+  if (WATAP_STANDARD_CACHE_POP(STATE, UINT32) != 0)                                                      \
+    WATAP_STANDARD_STACK_BRANCH(Targets[WATAP_STANDARD_IMM_U32(1)])
+#define WATAP_STANDARD_CACHE_BR_TABLE(STATE, ...)                                                        \
+{                                                                                                        \
+  /* Out of range index selects default target */                                                        \
+  const UINT32 Index = WATAP_STANDARD_CACHE_POP(STATE, UINT32);                                          \
+  WATAP_STANDARD_STACK_BRANCH(Targets[WATAP_STANDARD_IMM_U32(1) + std::min(Index, WATAP_STANDARD_IMM_U32(3))]) \
+}
+
+/* List of control transfer instructions supported by cached stack bytecode execution engine */
+#define WATAP_STANDARD_CACHE_CONTROL_INSTRUCTIONS(X) \
+  X(eUnreachable, UNREACHABLE) X(eReturn, RETURN) X(eCall, CALL) X(eReturnCall, RETURN_CALL) X(eIf, IF) X(eBr, BR) X(eBrIf, BR_IF) X(eBrTable, BR_TABLE)
+
+/* Cached stack bytecode handler label and 'case' label macro */
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+#  define WATAP_STANDARD_CACHE_OP(NAME, STATE) case static_cast<UINT32>(bin::instruction::NAME) | (STATE) << 8: L_##NAME##_##STATE:
+#else // defined(WATAP_STANDARD_THREADED_DISPATCH)
+#  define WATAP_STANDARD_CACHE_OP(NAME, STATE) case static_cast<UINT32>(bin::instruction::NAME) | (STATE) << 8:
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+/* Cached stack bytecode quickened instruction handler label and 'case' label macro */
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+#  define WATAP_STANDARD_CACHE_QUICKENED_OP(NAME, STATE) case static_cast<UINT32>(quickened_instruction::NAME) | (STATE) << 8: L_##NAME##_##STATE:
+#else // defined(WATAP_STANDARD_THREADED_DISPATCH)
+#  define WATAP_STANDARD_CACHE_QUICKENED_OP(NAME, STATE) case static_cast<UINT32>(quickened_instruction::NAME) | (STATE) << 8:
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+/* Cached stack bytecode direct call, host function call and tail call implementation macro (calls are implemented once, after cached value is spilled) */
+#define WATAP_STANDARD_CACHE_CALL_DIRECT(STATE)                                                                              \
+  WATAP_STANDARD_CACHE_QUICKENED_OP(eCallDirect, STATE) { WATAP_STANDARD_CACHE_SPILL(STATE) goto L_CallDirect; }             \
+  WATAP_STANDARD_CACHE_QUICKENED_OP(eReturnCallDirect, STATE) { WATAP_STANDARD_CACHE_SPILL(STATE) goto L_ReturnCallDirect; } \
+  WATAP_STANDARD_CACHE_QUICKENED_OP(eCallHost, STATE) { WATAP_STANDARD_CACHE_SPILL(STATE) goto L_CallHost; }
+
+/* Handler table direct call, host function call and tail call entry macro */
+#define WATAP_STANDARD_CACHE_CALL_DIRECT_HANDLER_TABLE_ENTRY(STATE)                                                    \
+  Table[static_cast<UINT32>(quickened_instruction::eCallDirect) | (STATE) << 8] = &&L_eCallDirect_##STATE;             \
+  Table[static_cast<UINT32>(quickened_instruction::eReturnCallDirect) | (STATE) << 8] = &&L_eReturnCallDirect_##STATE; \
+  Table[static_cast<UINT32>(quickened_instruction::eCallHost) | (STATE) << 8] = &&L_eCallHost_##STATE;
+
+/* Cached stack bytecode instruction list entry implementation macro */
+#define WATAP_STANDARD_CACHE_INSTRUCTION(STATE, NAME, KIND, ...) \
+  WATAP_STANDARD_CACHE_OP(NAME, STATE) WATAP_STANDARD_CACHE_##KIND(STATE, __VA_ARGS__) WATAP_STANDARD_NEXT(WATAP_STANDARD_STACK_LENGTH(NAME))
+
+/* Instruction list entry implementation macros for every cache state */
+#define WATAP_STANDARD_CACHE_INSTRUCTION_0(NAME, KIND, ...) WATAP_STANDARD_CACHE_INSTRUCTION(0, NAME, KIND, __VA_ARGS__)
+#define WATAP_STANDARD_CACHE_INSTRUCTION_1(NAME, KIND, ...) WATAP_STANDARD_CACHE_INSTRUCTION(1, NAME, KIND, __VA_ARGS__)
+#define WATAP_STANDARD_CACHE_INSTRUCTION_2(NAME, KIND, ...) WATAP_STANDARD_CACHE_INSTRUCTION(2, NAME, KIND, __VA_ARGS__)
+
+/* Instruction list entry implementations for every cache state macro */
+#define WATAP_STANDARD_CACHE_INSTRUCTIONS(LIST) \
+  LIST(WATAP_STANDARD_CACHE_INSTRUCTION_0)      \
+  LIST(WATAP_STANDARD_CACHE_INSTRUCTION_1)      \
+  LIST(WATAP_STANDARD_CACHE_INSTRUCTION_2)
+
+/* Handler table entry macros for every cache state */
+#define WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRY_0(NAME, ...) Table[static_cast<UINT32>(bin::instruction::NAME) | 0 << 8] = &&L_##NAME##_0;
+#define WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRY_1(NAME, ...) Table[static_cast<UINT32>(bin::instruction::NAME) | 1 << 8] = &&L_##NAME##_1;
+#define WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRY_2(NAME, ...) Table[static_cast<UINT32>(bin::instruction::NAME) | 2 << 8] = &&L_##NAME##_2;
+
+/* Handler table entries for every cache state macro */
+#define WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRIES(LIST) \
+  LIST(WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRY_0)       \
+  LIST(WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRY_1)       \
+  LIST(WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRY_2)
+
+/* Cache state, instruction leaves by list KIND (cache state is the result size in 4 byte units) */
+#define WATAP_STANDARD_CACHE_RESULT_EQZ(...)              1
+#define WATAP_STANDARD_CACHE_RESULT_COMPARE(...)          1
+#define WATAP_STANDARD_CACHE_RESULT_FN_UNARY(TYPE, ...)   (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_I_EXTEND(BASE, SUB)   (sizeof(BASE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_CAST(FROM, TO)        (sizeof(TO) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_TRUNC(FROM, TO)       (sizeof(TO) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_OP_BINARY(TYPE, ...)  (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_FN_BINARY(TYPE, ...)  (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_SHIFT(TYPE, ...)      (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_ROTATE(TYPE, ...)     (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_DIV_S(TYPE, ...)      (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_REM_S(TYPE, ...)      (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_DIV_U(TYPE, ...)      (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_LOAD(TYPE, FROM)      (sizeof(TYPE) / 4)
+#define WATAP_STANDARD_CACHE_RESULT_STORE(...)            0
+
+/* Instruction list entry to resulting cache state 'case' conversion macro */
+#define WATAP_STANDARD_CACHE_RESULT_CASE(NAME, KIND, ...) \
+  case bin::instruction::NAME: State = WATAP_STANDARD_CACHE_RESULT_##KIND(__VA_ARGS__); break;
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* Stack bytecode top of stack cache state assignment function.
+   * ARGUMENTS:
+   *   - function to assign cache states to (validated stack bytecode, not fused, linking isn't required):
+   *       compiled_function_data &Function;
+   * RETURNS:
+   *   (BOOL) TRUE if function is converted to cached stack bytecode, FALSE if it has values that can't be cached (function isn't changed then);
+   */
+  BOOL source_impl::CacheStackTop( compiled_function_data &Function ) const
+  {
+    // 128 bit locals can't be cached
+    if (std::ranges::any_of(Function.LocalSizes, []( UINT32 Size ) { return Size > sizeof(UINT64); }))
+      return FALSE;
+
+    const std::vector<compiled_instruction> &Code = Function.Instructions;
+    std::vector<compiled_instruction> Result; // Cached stack bytecode
+    std::vector<UINT32> OutputIps(Code.size() + 1, 0); // Cached stack bytecode indices of stack bytecode instructions
+    std::vector<BOOL> IsTarget(Code.size() + 1, FALSE);
+    UINT8 State = 0;                                   // Cache state of next instruction
+
+    for (const branch_target &Target : Function.BranchTargets)
+      IsTarget[Target.Ip] = TRUE;
+
+    for (SIZE_T Ip = 0; Ip < Code.size(); )
+    {
+      const compiled_instruction Instruction = Code[Ip];
+      const SIZE_T Length = GetCompiledInstructionLength(Instruction);
+
+      // Branch targets are entered with nothing cached
+      if (IsTarget[Ip])
+      {
+        if (State != 0)
+          Result.push_back(compiled_instruction {bin::instruction::eNop, static_cast<UINT8>(State << WATAP_STANDARD_CACHE_STATE_SHIFT)});
+        State = 0;
+      }
+
+      OutputIps[Ip] = static_cast<UINT32>(Result.size());
+      Result.push_back(compiled_instruction {Instruction.Instruction, static_cast<UINT8>(Instruction.InstructionData | State << WATAP_STANDARD_CACHE_STATE_SHIFT)});
+      Result.insert(Result.end(), Code.begin() + Ip + 1, Code.begin() + Ip + Length);
+
+      switch (Instruction.Instruction)
+      {
+      WATAP_STANDARD_NUMERIC_INSTRUCTIONS(WATAP_STANDARD_CACHE_RESULT_CASE)
+
+      case bin::instruction::eLocalGet   :
+        State = Instruction.InstructionData / 4;
+        break;
+
+      case bin::instruction::eLocalTee   :
+        break;
+
+      case bin::instruction::eI64Const   :
+      case bin::instruction::eF64Const   :
+        State = 2;
+        break;
+
+      case bin::instruction::eI32Const   :
+      case bin::instruction::eF32Const   :
+      case bin::instruction::eMemorySize :
+      case bin::instruction::eMemoryGrow :
+      case bin::instruction::eRefNull    :
+      case bin::instruction::eRefFunc    :
+        State = 1;
+        break;
+
+      case bin::instruction::eNop        :
+      case bin::instruction::eDrop       :
+      case bin::instruction::eSelect     :
+      case bin::instruction::eLocalSet   :
+      case bin::instruction::eUnreachable:
+      case bin::instruction::eReturn     :
+      case bin::instruction::eCall       :
+      case bin::instruction::eReturnCall :
+      case bin::instruction::eIf         :
+      case bin::instruction::eBr         :
+      case bin::instruction::eBrIf       :
+      case bin::instruction::eBrTable    :
+        State = 0;
+        break;
+
+      default:
+        return FALSE;
+      }
+
+      Ip += Length;
+    }
+    OutputIps[Code.size()] = static_cast<UINT32>(Result.size());
+
+    for (branch_target &Target : Function.BranchTargets)
+      Target.Ip = OutputIps[Target.Ip];
+    Function.Instructions = std::move(Result);
+    Function.Bytecode = bytecode_type::eCachedStack;
+    return TRUE;
+  } /* End of 'CacheStackTop' function */
+
+  /* Cached stack bytecode function execution function (executes functions from call stack top until call stack shrinks below initial size).
+   * TEMPLATE ARGUMENTS:
+   *   - instruction dispatch technique:
+   *       dispatch_type DISPATCH;
+   * ARGUMENTS:
+   *   - instance to execute code of (nullptr if handler table requested only):
+   *       instance_impl *Instance;
+   *   - handler table (768 entries, indexed by instruction and cache state) output pointer, not nullptr only if requested:
+   *       const VOID *const **HandlerTable;
+   * RETURNS:
+   *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+   */
+  template <dispatch_type DISPATCH>
+    BOOL instance_impl::ExecuteCached( instance_impl *Instance, const VOID *const **HandlerTable )
+    {
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+      static const std::array<const VOID *, 768> Table = ({
+        std::array<const VOID *, 768> Table;
+        Table.fill(&&L_Invalid);
+        WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRIES(WATAP_STANDARD_CACHE_CONTROL_INSTRUCTIONS)
+        WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRIES(WATAP_STANDARD_STACK_SIMPLE_INSTRUCTIONS)
+        WATAP_STANDARD_CACHE_HANDLER_TABLE_ENTRIES(WATAP_STANDARD_NUMERIC_INSTRUCTIONS)
+        WATAP_STANDARD_CACHE_CALL_DIRECT_HANDLER_TABLE_ENTRY(0)
+        WATAP_STANDARD_CACHE_CALL_DIRECT_HANDLER_TABLE_ENTRY(1)
+        WATAP_STANDARD_CACHE_CALL_DIRECT_HANDLER_TABLE_ENTRY(2)
+        Table;
+      });
+      if (HandlerTable != nullptr)
+      {
+        *HandlerTable = Table.data();
+        return TRUE;
+      }
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+      const source_impl &Source = Instance->Source;
+      local_stack &EvaluationStack = Instance->EvaluationStack;
+      linear_memory &Heap = Instance->Heap;
+      fixed_stack<call> &CallStack = Instance->CallStack;
+      const SIZE_T RootDepth = CallStack.Size();
+
+      const compiled_function_data *Function;   // Current function
+      const compiled_instruction *Code;         // Current function code
+      const VOID *const *Handlers;              // Current function handlers
+      const branch_target *Targets;             // Current function branch targets
+      SIZE_T Ip;                                // Instruction pointer (index)
+      UINT64 *Frame;                            // Local variable frame (placed on evaluation stack below function values)
+      UINT64 Tos = 0;                           // Cached evaluation stack top value
+
+      // Execution state by call stack top loading
+      auto LoadState = [&]( VOID )
+        {
+          const call &Call = CallStack.Top();
+
+          Function = &std::get<compiled_function_data>(Source.Functions[Call.FunctionIndex]);
+          Code = Function->Instructions.data();
+          Handlers = Function->Handlers.data();
+          Targets = Function->BranchTargets.data();
+          Ip = Call.InstructionIndex;
+          Frame = EvaluationStack.At<UINT64>(Call.EvaluationStackBase) - Function->FrameSlotCount;
+        };
+
+      LoadState();
+
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+      if constexpr (DISPATCH == dispatch_type::eThreaded)
+        goto *Handlers[Ip];
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+      while (TRUE)
+      {
+        switch (WATAP_STANDARD_CACHE_HANDLER_INDEX(Code[Ip]))
+        {
+        WATAP_STANDARD_CACHE_INSTRUCTIONS(WATAP_STANDARD_CACHE_CONTROL_INSTRUCTIONS)
+        WATAP_STANDARD_CACHE_INSTRUCTIONS(WATAP_STANDARD_STACK_SIMPLE_INSTRUCTIONS)
+        WATAP_STANDARD_CACHE_INSTRUCTIONS(WATAP_STANDARD_NUMERIC_INSTRUCTIONS)
+
+        WATAP_STANDARD_CACHE_CALL_DIRECT(0)
+        WATAP_STANDARD_CACHE_CALL_DIRECT(1)
+        WATAP_STANDARD_CACHE_CALL_DIRECT(2)
+
+        L_Return:
+          {
+            UINT64 *Top = EvaluationStack.Get<UINT64>();
+
+            // Return value replaces frame (so it's left in the first argument slot of caller's view), the rest is popped
+            if (Function->ReturnSize != 0)
+              *Frame++ = Top[-1];
+            EvaluationStack.Pop((Top - Frame) * sizeof(UINT64));
+            CallStack.Pop();
+
+            if (CallStack.Size() < RootDepth)
+              return TRUE;
+            LoadState();
+            WATAP_STANDARD_NEXT(0)
+          }
+
+        L_Call:
+          // Callee is resolved by the first execution only, call continues as quickened one
+          if (!Instance->QuickenCall(const_cast<compiled_function_data &>(*Function), Ip))
+            WATAP_STANDARD_TRAP();
+
+        L_CallDirect:
+          {
+            const call_site &Site = Function->CallSites[WATAP_STANDARD_IMM_U32(1)];
+            const compiled_function_data *Callee = Site.Callee;
+
+            CallStack.Top().InstructionIndex = Ip + 3;
+            if (!Instance->PushCall(Site))
+              WATAP_STANDARD_TRAP();
+
+            // Callee of another bytecode format (or tiered up one) is executed by its own engine, result is left on evaluation stack
+            if (Callee->Bytecode != bytecode_type::eCachedStack || Callee->OptimizedEntry != nullptr)
+            {
+              if (!ExecuteTop<DISPATCH>(Instance, *Callee))
+                return FALSE;
+              LoadState();
+              WATAP_STANDARD_NEXT(0)
+            }
+
+            // Callee state is known, call stack top isn't looked up
+            Function = Callee;
+            Code = Function->Instructions.data();
+            Handlers = Function->Handlers.data();
+            Targets = Function->BranchTargets.data();
+            Ip = 0;
+            Frame = EvaluationStack.Get<UINT64>() - Function->FrameSlotCount;
+            WATAP_STANDARD_DISPATCH()
+          }
+
+        L_CallHost:
+          {
+            const compiled_function_data *Callee = Function->CallSites[WATAP_STANDARD_IMM_U32(1)].Callee;
+            const host_function &Host = Instance->FunctionImports[Callee->ImportIndex];
+
+            // Host function has no frame, its result replaces arguments (space for it is reserved with caller values)
+            Instance->CallHost(Host, EvaluationStack.Pop<UINT64>(Callee->ArgumentCount * sizeof(UINT64)));
+            if (Callee->ReturnSize != 0)
+              EvaluationStack.PushReserved(sizeof(UINT64));
+            WATAP_STANDARD_NEXT(3)
+          }
+
+        L_ReturnCall:
+          // Callee is resolved by the first execution only, tail call continues as quickened one
+          if (!Instance->QuickenCall(const_cast<compiled_function_data &>(*Function), Ip))
+            WATAP_STANDARD_TRAP();
+
+        L_ReturnCallDirect:
+          {
+            const call_site &Site = Function->CallSites[WATAP_STANDARD_IMM_U32(1)];
+            const compiled_function_data *Callee = Site.Callee;
+
+            Instance->PushTailCall(Site, Frame);
+
+            // Callee of another bytecode format (or tiered up one) is executed by its own engine, its result is the current call result
+            if (Callee->Bytecode != bytecode_type::eCachedStack || Callee->OptimizedEntry != nullptr)
+            {
+              if (!ExecuteTop<DISPATCH>(Instance, *Callee))
+                return FALSE;
+              if (CallStack.Size() < RootDepth)
+                return TRUE;
+              LoadState();
+              WATAP_STANDARD_NEXT(0)
+            }
+
+            Function = Callee;
+            Code = Function->Instructions.data();
+            Handlers = Function->Handlers.data();
+            Targets = Function->BranchTargets.data();
+            Ip = 0;
+            Frame = EvaluationStack.Get<UINT64>() - Function->FrameSlotCount;
+            WATAP_STANDARD_DISPATCH()
+          }
+
+        default:
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+        L_Invalid:
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+          // Compiler emitted instruction that isn't supported by execution engine
+          WATAP_STANDARD_TRAP();
+        }
+      }
+    } /* End of 'ExecuteCached' function */
+
+  /* Engine instantiations, engines are referenced from other bytecode format engines */
+  template BOOL instance_impl::ExecuteCached<dispatch_type::eSwitch>( instance_impl *, const VOID *const ** );
+  template BOOL instance_impl::ExecuteCached<dispatch_type::eThreaded>( instance_impl *, const VOID *const ** );
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_cache.cpp' FILE */
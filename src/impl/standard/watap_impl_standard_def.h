@@ -2,11 +2,26 @@
 #define __watap_impl_standard_def_h_
 
 #include "watap_impl_standard.h"
+#include "watap_impl_standard_fusion_table.h"
+#include "watap_impl_standard_memory.h"
+
+#include <algorithm>
+#include <memory>
 
 #ifndef WATAP_IMPL_STANDARD
 #  error This file shouldn't be included in global project tree
 #endif // defined(WATAP_IMPL_STANDARD)
 
+/* Superinstruction enumeration entry macro */
+#define WATAP_STANDARD_FUSED_ENUM_ENTRY(NAME, CODE, ...) NAME = CODE,
+
+/* Superinstruction first part instruction getting macro */
+#define WATAP_STANDARD_FUSED_FIRST_PART(NAME, ...) bin::instruction::NAME
+
+/* Superinstruction length (length of its first part) 'case' macro */
+#define WATAP_STANDARD_FUSED_LENGTH_CASE(NAME, CODE, FIRST, ...) \
+  case CODE: return GetCompiledInstructionLength(compiled_instruction { WATAP_STANDARD_FUSED_FIRST_PART FIRST });
+
 /* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
 namespace watap::impl::standard
 {
@@ -56,6 +71,20 @@ namespace watap::impl::standard
     } /* End of 'operator<=> function */
   }; /* End of 'import_name' structure */
 
+  /* Module import requirement representation structure */
+  struct import_requirement
+  {
+    import_name Name;       // Imported object name
+    import_element Element; // Imported object type
+  }; /* End of 'import_requirement' structure */
+
+  /* Import table implementation class */
+  class import_table_impl : public import_table
+  {
+  public:
+    std::map<import_name, host_function> Functions; // Host functions by import name
+  }; /* End of 'import_table_impl' class */
+
   /* Runtime instruction representation structure */
   union compiled_instruction
   {
@@ -73,6 +102,152 @@ namespace watap::impl::standard
     UINT16 InstructionID = 0; // Unique instruction identifier
   }; /* End of 'compiled_instruction' structure */
 
+  /* Superinstruction (stack bytecode instruction sequence executed by single dispatch) representation enumeration.
+   * Superinstruction replaces opcode of the first sequence instruction only, so immediates and
+   * following instructions of sequence stay in place and may be still executed (or jumped to) separately.
+   */
+  enum class fused_instruction : UINT8
+  {
+    WATAP_STANDARD_FUSED_PAIRS(WATAP_STANDARD_FUSED_ENUM_ENTRY)
+    WATAP_STANDARD_FUSED_TRIPLES(WATAP_STANDARD_FUSED_ENUM_ENTRY)
+  }; /* End of 'fused_instruction' enumeration */
+
+  /* Quickened instruction (stack bytecode instruction, rewritten in place by execution engine after its first execution) representation enumeration.
+   * Quickened instruction has the same length as the original one, so branch targets and instruction boundaries stay in place.
+   */
+  enum class quickened_instruction : UINT8
+  {
+    eCallDirect       = 0x16, // 'call' with resolved callee, immediate is index of call site of calling function
+    eReturnCallDirect = 0x17, // 'return_call' with resolved callee, immediate is index of call site of calling function
+    eCallHost         = 0x18, // 'call' of imported host function, immediate is index of call site of calling function
+  }; /* End of 'quickened_instruction' enumeration */
+
+  /* Implementation-only function formats (extend 'bytecode_type' of compiled function, can't be chosen by settings) representation enumeration */
+  enum class internal_bytecode_type : UINT8
+  {
+    eHost = 0x80, // Imported host function, called by its trampoline (frame is placed on evaluation stack)
+  }; /* End of 'internal_bytecode_type' enumeration */
+
+  /* Compiled instruction length (in instruction slots, immediates included) getting function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       compiled_instruction Instruction;
+   * RETURNS:
+   *   (SIZE_T) Count of slots occupied by instruction;
+   */
+  inline constexpr SIZE_T GetCompiledInstructionLength( compiled_instruction Instruction ) noexcept
+  {
+    switch (static_cast<UINT8>(Instruction.Instruction))
+    {
+    case static_cast<UINT8>(bin::instruction::eLocalGet):
+    case static_cast<UINT8>(bin::instruction::eLocalSet):
+    case static_cast<UINT8>(bin::instruction::eLocalTee):
+      return 2;
+
+    case static_cast<UINT8>(bin::instruction::eIf):
+    case static_cast<UINT8>(bin::instruction::eBr):
+    case static_cast<UINT8>(bin::instruction::eBrIf):
+    case static_cast<UINT8>(bin::instruction::eCall):
+    case static_cast<UINT8>(bin::instruction::eReturnCall):
+    case static_cast<UINT8>(quickened_instruction::eCallDirect):
+    case static_cast<UINT8>(quickened_instruction::eReturnCallDirect):
+    case static_cast<UINT8>(quickened_instruction::eCallHost):
+    case static_cast<UINT8>(bin::instruction::eRefFunc):
+    case static_cast<UINT8>(bin::instruction::eI32Const):
+    case static_cast<UINT8>(bin::instruction::eF32Const):
+    case static_cast<UINT8>(bin::instruction::eI32Load):
+    case static_cast<UINT8>(bin::instruction::eI64Load):
+    case static_cast<UINT8>(bin::instruction::eF32Load):
+    case static_cast<UINT8>(bin::instruction::eF64Load):
+    case static_cast<UINT8>(bin::instruction::eI32Load8S):
+    case static_cast<UINT8>(bin::instruction::eI32Load8U):
+    case static_cast<UINT8>(bin::instruction::eI32Load16S):
+    case static_cast<UINT8>(bin::instruction::eI32Load16U):
+    case static_cast<UINT8>(bin::instruction::eI64Load8S):
+    case static_cast<UINT8>(bin::instruction::eI64Load8U):
+    case static_cast<UINT8>(bin::instruction::eI64Load16S):
+    case static_cast<UINT8>(bin::instruction::eI64Load16U):
+    case static_cast<UINT8>(bin::instruction::eI64Load32S):
+    case static_cast<UINT8>(bin::instruction::eI64Load32U):
+    case static_cast<UINT8>(bin::instruction::eI32Store):
+    case static_cast<UINT8>(bin::instruction::eI64Store):
+    case static_cast<UINT8>(bin::instruction::eF32Store):
+    case static_cast<UINT8>(bin::instruction::eF64Store):
+    case static_cast<UINT8>(bin::instruction::eI32Store8):
+    case static_cast<UINT8>(bin::instruction::eI32Store16):
+    case static_cast<UINT8>(bin::instruction::eI64Store8):
+    case static_cast<UINT8>(bin::instruction::eI64Store16):
+    case static_cast<UINT8>(bin::instruction::eI64Store32):
+      return 3;
+
+    case static_cast<UINT8>(bin::instruction::eI64Const):
+    case static_cast<UINT8>(bin::instruction::eF64Const):
+    case static_cast<UINT8>(bin::instruction::eBrTable):
+      return 5;
+
+    // Data segment index is immediate of 'memory.init' and 'data.drop' only
+    case static_cast<UINT8>(bin::instruction::eSystem):
+      return Instruction.InstructionData == static_cast<UINT8>(bin::system_instruction::eMemoryInit)
+        || Instruction.InstructionData == static_cast<UINT8>(bin::system_instruction::eDataDrop) ? 3 : 1;
+
+    WATAP_STANDARD_FUSED_PAIRS(WATAP_STANDARD_FUSED_LENGTH_CASE)
+    WATAP_STANDARD_FUSED_TRIPLES(WATAP_STANDARD_FUSED_LENGTH_CASE)
+
+    default:
+      return 1;
+    }
+  } /* End of 'GetCompiledInstructionLength' function */
+
+  /* Branch target (precomputed label of structured control flow) representation structure */
+  struct branch_target
+  {
+    UINT32 Ip;                     // Index of instruction to continue execution from
+    UINT32 DropCount;              // Count of evaluation stack values to discard below kept ones
+    UINT32 KeepCount;              // Count of label values on evaluation stack top, that are moved to new stack top
+    const VOID *Handler = nullptr; // Direct-threaded handler address of target instruction (resolved during linking)
+  }; /* End of 'branch_target' structure */
+
+  class instance_impl;
+
+  /* Native code execution context (pointer to it is passed to native function and every runtime helper it calls) representation structure */
+  struct native_context
+  {
+    instance_impl *Instance; // Executing instance
+    UINT8 *HeapData;         // Linear memory data (updated by helpers, that may resize memory)
+    UINT64 HeapSize;         // Linear memory size in bytes
+    UINT64 Result;           // Optimized code return value
+    UINT32 *BackEdgeCount;   // Executed function loop back edge counter (baseline native code only)
+  }; /* End of 'native_context' structure */
+
+  /* Native function entry point (frame is function local frame, return value is stored to its first slot), returns FALSE on trap */
+  using native_entry = BOOL (*)( native_context *Context, UINT64 *Frame );
+
+  /* Validated stack bytecode, kept for optimizing compiler (bytecode format conversions and fusion rewrite function instructions) representation structure */
+  struct stack_bytecode
+  {
+    std::vector<compiled_instruction> Instructions; // Validated and optimized stack bytecode (not fused)
+    std::vector<branch_target> BranchTargets;       // Branch targets of stack bytecode
+    std::vector<bin::value_type> LocalTypes;        // Types of locals (arguments included)
+  }; /* End of 'stack_bytecode' structure */
+
+  /* On-stack replacement entry (optimized code variant, entered at loop header with locals of running call frame) representation structure */
+  struct osr_entry
+  {
+    UINT32 TargetIndex;               // Loop header branch target index
+    native_entry Entry;               // Entry point (frame is running call local frame), nullptr if loop can't be entered
+    std::shared_ptr<const VOID> Code; // Executable pages, entry code is placed in
+  }; /* End of 'osr_entry' structure */
+
+  struct compiled_function_data;
+
+  /* Resolved call site (quickened 'call' instruction side table entry) representation structure */
+  struct call_site
+  {
+    const compiled_function_data *Callee; // Called function (function storage isn't reallocated after module loading)
+    UINT32 FunctionIndex;                  // Called function index
+    SIZE_T FrameSize;                      // Size of callee frame part, pushed by call (in bytes)
+  }; /* End of 'call_site' structure */
+
   /* Compiled function data representation structure */
   struct compiled_function_data
   {
@@ -80,6 +255,20 @@ namespace watap::impl::standard
     UINT32 ArgumentCount;                           // Count of locals
     std::vector<UINT32> LocalSizes;                 // Sizes of arguments
     std::vector<compiled_instruction> Instructions; // Instruciton set
+    std::vector<const VOID *> Handlers;             // Direct-threaded handler addresses, parallel to Instructions (empty if threaded code isn't supported)
+    bytecode_type Bytecode = bytecode_type::eStack; // Instruction set format
+    UINT32 FrameSlotCount = 0;                      // Count of 8 byte local frame slots (locals, register bytecode operand slots)
+    UINT32 MaxStackHeight = 0;                      // Maximal count of function values on evaluation stack (stack bytecode only)
+    std::vector<branch_target> BranchTargets;       // Branch target side table, referenced by stack bytecode control transfer instructions
+    native_entry NativeEntry = nullptr;             // Native code entry point ('eNative' bytecode only)
+    std::shared_ptr<const VOID> NativeCode;         // Executable pages, native code is placed in (unmapped with the last function data copy)
+    std::shared_ptr<const stack_bytecode> StackBytecode; // Stack bytecode to compile by optimizing compiler (kept for on-stack replacement entries), nullptr if tier-up isn't enabled or function isn't supported
+    BOOL IsTieredUp = FALSE;                        // Is optimizing compilation attempted
+    native_entry OptimizedEntry = nullptr;          // Optimizing compiler output entry point (return value is stored to context), nullptr if function isn't tiered up
+    std::shared_ptr<const VOID> OptimizedCode;      // Executable pages, optimized code is placed in
+    std::vector<osr_entry> OsrEntries;              // On-stack replacement entries of loops, running calls of function tried to leave
+    std::vector<call_site> CallSites;               // Resolved call sites, referenced by quickened 'call' instructions
+    UINT32 ImportIndex = 0;                         // Index of function among instance function imports (host function only)
   }; /* End of 'compiled_function_data' structure */
 
   /* Raw function data representation structure */
@@ -113,6 +302,12 @@ namespace watap::impl::standard
     eInvalidFunctionTypeIndex,     // Invalid function type index
     eStackNotEmpty,                // Stack isn't empty at end of execution
     eWrongReturnValueType,         // Wrong type of value, that this function returns
+    eInvalidBlockType,             // Invalid block type
+    eInvalidLabelIndex,            // Branch label index is out of control frame stack
+    eNoOperandsForBranch,          // No values for branch label in stack
+    eUnexpectedElse,               // 'else' instruction outside of 'if' block
+    eUnbalancedBlocks,             // Count of 'end' instructions doesn't match count of blocks
+    eInvalidDataSegmentIndex,      // Invalid data segment index
     eUnsupportedFeature,           // Unsupported feature (Vector operations, system instructions, etc.)
   }; /* End of 'compile_status' enumeration */
 
@@ -143,20 +338,127 @@ namespace watap::impl::standard
      */
     compile_status CompileJIT( UINT32 FunctionIndex );
 
+    /* Inlined function code getting function (function is compiled first, so its code is validated).
+     * ARGUMENTS:
+     *   - called function index:
+     *       UINT32 FunctionIndex;
+     * RETURNS:
+     *   (const raw_function_data *) Function code, nullptr if function is too large or can't be compiled;
+     */
+    const raw_function_data * GetInlineBody( UINT32 FunctionIndex );
+
+    /* Stack bytecode constant folding and peephole optimization function.
+     * ARGUMENTS:
+     *   - function to optimize (validated stack bytecode, linking isn't required):
+     *       compiled_function_data &Function;
+     * RETURNS:
+     *   (SIZE_T) Count of instructions removed;
+     */
+    SIZE_T Optimize( compiled_function_data &Function ) const;
+
+    /* Stack bytecode to register bytecode lowering function.
+     * ARGUMENTS:
+     *   - function to lower (validated stack bytecode, linking isn't required):
+     *       compiled_function_data &Function;
+     * RETURNS:
+     *   (BOOL) TRUE if function is lowered, FALSE if function contains instructions register bytecode doesn't support (function isn't changed then);
+     */
+    BOOL LowerToRegisters( compiled_function_data &Function ) const;
+
+    /* Stack bytecode top of stack cache state assignment function.
+     * ARGUMENTS:
+     *   - function to assign cache states to (validated stack bytecode, not fused, linking isn't required):
+     *       compiled_function_data &Function;
+     * RETURNS:
+     *   (BOOL) TRUE if function is converted to cached stack bytecode, FALSE if it has values that can't be cached (function isn't changed then);
+     */
+    BOOL CacheStackTop( compiled_function_data &Function ) const;
+
+    /* Stack bytecode to native code compilation function.
+     * ARGUMENTS:
+     *   - function to compile (validated stack bytecode, not fused, linking isn't required):
+     *       compiled_function_data &Function;
+     * RETURNS:
+     *   (BOOL) TRUE if native code is emitted, FALSE if native code isn't supported by host or function (function isn't changed then);
+     */
+    BOOL CompileNative( compiled_function_data &Function ) const;
+
+    /* Stack bytecode instruction sequence statistics recording function.
+     * ARGUMENTS:
+     *   - function to record sequences of (stack bytecode, not fused):
+     *       const compiled_function_data &Function;
+     * RETURNS: None.
+     */
+    VOID RecordFusionStatistics( const compiled_function_data &Function ) const;
+
+    /* Stack bytecode superinstruction fusion function.
+     * ARGUMENTS:
+     *   - function to fuse instruction sequences of (validated stack bytecode, linking isn't required):
+     *       compiled_function_data &Function;
+     * RETURNS:
+     *   (SIZE_T) Count of superinstructions emitted;
+     */
+    SIZE_T Fuse( compiled_function_data &Function ) const;
+
+    /* Stack bytecode to optimized native code (SSA form based) compilation function.
+     * ARGUMENTS:
+     *   - function to compile (its stack bytecode copy is compiled):
+     *       const compiled_function_data &Function;
+     *   - loop header branch target index to enter code at (all locals are read from frame, operand stack must be empty at loop header),
+     *     ~0 to enter code at function start:
+     *       UINT32 OsrTarget;
+     * RETURNS:
+     *   (std::shared_ptr<const VOID>) Executable pages (entry point is at their start), nullptr if code isn't supported by host or function;
+     */
+    std::shared_ptr<const VOID> CompileOptimized( const compiled_function_data &Function, UINT32 OsrTarget = ~0U ) const;
+
   public:
 
-    std::map<import_name, import_element> Imports;              // Required import set
+    bytecode_type Bytecode;                    // Format of compiled function bytecode
+    branch_table_lowering BranchTable;         // 'br_table' instruction lowering
+    BOOL Optimization;                         // Is validated bytecode optimized
+    optimization_report *OptimizationReport;   // Report to record removed instruction counts to, nullptr if not required
+    BOOL Fusion;                               // Are superinstructions used in stack bytecode
+    fusion_statistics *FusionStatistics;       // Instruction sequence statistics to record compiled functions to, nullptr if not required
+    UINT32 TierUpCallCount;                    // Count of function calls, that triggers optimizing compilation, 0 if disabled
+    UINT32 TierUpBackEdgeCount;                // Count of taken loop back edges of function, that triggers optimizing compilation, 0 if disabled
+    UINT32 InlineBudget;                       // Maximal size of function body, calls of which are inlined, 0 if disabled
+    UINT32 InlineCompileDepth = 0;             // Count of running compilations of inlined callees (callees of them aren't compiled for inlining)
+    memory_reservation MemoryReservation;      // Linear memory address space reservation policy of instances (native code accesses aren't bounds checked, if memory is guarded)
+    UINT32 MemoryGrowthGranularity;            // Linear memory committed size granularity (in pages)
+
+    std::vector<import_requirement> Imports;                    // Required imports (in import section order)
+    UINT32 FunctionImportCount = 0;                             // Count of imported functions (they take the first function indices)
     std::map<std::string, export_element, std::less<>> Exports; // Export set
     std::optional<std::string>            Start;                // Start function name (optional)
 
     std::vector<function_signature> FunctionSignatures; // Function signature list
     std::vector<bin::table_type> Tables;                // Table set
+    bin::limits MemoryLimits { .Min = 1, .Max = 65536 }; // Linear memory size limits (in pages, single page memory is created for module without memory)
     std::vector<UINT32> FunctionSignatureIndices;       // Indices of function signatures
+    std::vector<data_segment> DataSegments;             // Data segments (in data section order)
+    memory_image MemoryImage;                           // Initial memory content image, active data segments are mapped from (not created if memory is initialized by copying)
 
     std::vector<std::variant<raw_function_data, compiled_function_data>> Functions; // Function lists
+    std::map<UINT32, raw_function_data> InlineBodies; // Code of compiled functions, small enough to be inlined (keyed by function index)
 
-    /* Source implementation constructor */
-    source_impl( VOID )
+    /* Source implementation constructor.
+     * ARGUMENTS:
+     *   - implementation settings:
+     *       const settings &Settings;
+     */
+    source_impl( const settings &Settings ) :
+      Bytecode(Settings.Bytecode),
+      BranchTable(Settings.BranchTable),
+      Optimization(Settings.Optimization),
+      OptimizationReport(Settings.OptimizationReport),
+      Fusion(Settings.Fusion),
+      FusionStatistics(Settings.FusionStatistics),
+      TierUpCallCount(Settings.TierUpCallCount),
+      TierUpBackEdgeCount(Settings.TierUpBackEdgeCount),
+      InlineBudget(Settings.InlineBudget),
+      MemoryReservation(Settings.MemoryReservation),
+      MemoryGrowthGranularity(Settings.MemoryGrowthGranularity)
     {
 
     } /* End of 'module_source' class */
@@ -174,11 +476,63 @@ namespace watap::impl::standard
         return nullptr;
       if (const compiled_function_data *FData = std::get_if<compiled_function_data>(&Functions[FunctionIndex]))
         return FData;
-      if (const_cast<source_impl *>(this)->CompileJIT(FunctionIndex) != jit_compile_status::eOk) // uugh
+      if (const_cast<source_impl *>(this)->CompileJIT(FunctionIndex) != compile_status::eOk) // uugh
         return nullptr;
       return &std::get<compiled_function_data>(Functions[FunctionIndex]);
     } /* End of 'GetFunction' function */
 
+    /* Function tier-up (compilation by optimizing compiler, executed by instance, when function counter reaches threshold) function.
+     * ARGUMENTS:
+     *   - compiled function index:
+     *       UINT32 FunctionIndex;
+     * RETURNS: None.
+     */
+    VOID TierUp( UINT32 FunctionIndex ) const
+    {
+      compiled_function_data &Function = std::get<compiled_function_data>(const_cast<source_impl *>(this)->Functions[FunctionIndex]);
+
+      // Compilation is attempted once, optimized code is used by the following calls
+      if (Function.StackBytecode == nullptr || Function.IsTieredUp)
+        return;
+      Function.IsTieredUp = TRUE;
+      Function.OptimizedCode = CompileOptimized(Function);
+      if (Function.OptimizedCode == nullptr)
+      {
+        // Loops of unsupported function can't be entered too
+        Function.StackBytecode.reset();
+        return;
+      }
+      Function.OptimizedEntry = reinterpret_cast<native_entry>(const_cast<VOID *>(Function.OptimizedCode.get()));
+    } /* End of 'TierUp' function */
+
+    /* Loop tier-up (function tier-up and on-stack replacement entry getting, executed by instance, when function back edge counter reaches threshold) function.
+     * ARGUMENTS:
+     *   - compiled function index:
+     *       UINT32 FunctionIndex;
+     *   - loop header branch target index:
+     *       UINT32 TargetIndex;
+     * RETURNS:
+     *   (native_entry) Optimized code entry at loop header, nullptr if running call continues execution of its engine;
+     */
+    native_entry TierUpLoop( UINT32 FunctionIndex, UINT32 TargetIndex ) const
+    {
+      compiled_function_data &Function = std::get<compiled_function_data>(const_cast<source_impl *>(this)->Functions[FunctionIndex]);
+
+      TierUp(FunctionIndex);
+      if (Function.StackBytecode == nullptr)
+        return nullptr;
+      for (const osr_entry &Osr : Function.OsrEntries)
+        if (Osr.TargetIndex == TargetIndex)
+          return Osr.Entry;
+
+      // Entry compilation is attempted once per loop
+      osr_entry &Osr = Function.OsrEntries.emplace_back(osr_entry { .TargetIndex = TargetIndex, .Entry = nullptr, .Code = CompileOptimized(Function, TargetIndex) });
+
+      if (Osr.Code != nullptr)
+        Osr.Entry = reinterpret_cast<native_entry>(const_cast<VOID *>(Osr.Code.get()));
+      return Osr.Entry;
+    } /* End of 'TierUpLoop' function */
+
     /* Exported function by name getting function.
      * ARGUMENTS:
      *   - funciton index:
@@ -250,10 +604,23 @@ namespace watap::impl::standard
       return_type * Push( SIZE_T FrameSize ) noexcept
       {
         if (Current + FrameSize > End)
-          Resize((End - Begin + 1) * 2);
+          Resize(std::max<SIZE_T>((End - Begin + 1) * 2, Current - Begin + FrameSize));
         return reinterpret_cast<return_type *>(Current += FrameSize);
       } /* End of 'Push' function */
 
+    /* Frame to reserved (by 'Reserve' call) stack space pushing function (stack capacity isn't checked).
+     * ARGUMENTS:
+     *   - frame size:
+     *       SIZE_T FrameSize;
+     * RETURNS:
+     *   (VOID *) Pointer to stack top with enough space below for previous FrameSize bytes not intersecting with another frame;
+     */
+    template <typename return_type = VOID>
+      return_type * PushReserved( SIZE_T FrameSize ) noexcept
+      {
+        return reinterpret_cast<return_type *>(Current += FrameSize);
+      } /* End of 'PushReserved' function */
+
     /* Frame from stack popping function.
      * ARGUMENTS:
      *   - frame size:
@@ -273,6 +640,31 @@ namespace watap::impl::standard
         return reinterpret_cast<return_type *>(Current);
       } /* End of 'Get' function */
 
+    /* Stack location getting function.
+     * ARGUMENTS:
+     *   - location offset from stack bottom (in bytes):
+     *       SIZE_T Offset;
+     * RETURNS:
+     *   (return_type *) Pointer to location (valid until stack is resized);
+     */
+    template <typename return_type = VOID>
+      return_type * At( SIZE_T Offset ) noexcept
+      {
+        return reinterpret_cast<return_type *>(Begin + Offset);
+      } /* End of 'At' function */
+
+    /* Stack space reservation function (pushes of reserved space don't move stack).
+     * ARGUMENTS:
+     *   - size of space to reserve above stack top:
+     *       SIZE_T Size;
+     * RETURNS: None.
+     */
+    VOID Reserve( SIZE_T Size ) noexcept
+    {
+      if (Current + Size > End)
+        Resize(std::max<SIZE_T>((End - Begin + 1) * 2, Current - Begin + Size));
+    } /* End of 'Reserve' function */
+
     /* Stack size getting function.
      * ARGUMENTS: None.
      * RETURNS:
@@ -300,6 +692,124 @@ namespace watap::impl::standard
     } /* End of '~local_stack' function */
   }; /* End of 'local_stack' structure */
 
+  /* Fixed capacity stack (storage is allocated once, so pushes and pops never allocate) class */
+  template <typename value_type>
+    class fixed_stack
+    {
+      std::unique_ptr<value_type[]> Values; // Stack storage
+      value_type *Current = nullptr;        // Current stack pointer (pointer to value after top one)
+      value_type *End = nullptr;            // Stack storage end
+
+    public:
+      /* Fixed capacity stack constructor.
+       * ARGUMENTS:
+       *   - maximal count of values on stack:
+       *       SIZE_T Capacity;
+       */
+      fixed_stack( SIZE_T Capacity ) :
+        Values(new value_type[Capacity]),
+        Current(Values.get()),
+        End(Values.get() + Capacity)
+      {
+      } /* End of 'fixed_stack' function */
+
+      /* Value to stack pushing function.
+       * ARGUMENTS:
+       *   - value to push:
+       *       const value_type &Value;
+       * RETURNS:
+       *   (BOOL) TRUE if value is pushed, FALSE if stack is full;
+       */
+      BOOL Push( const value_type &Value ) noexcept
+      {
+        if (Current == End)
+          return FALSE;
+        *Current++ = Value;
+        return TRUE;
+      } /* End of 'Push' function */
+
+      /* Top value popping function.
+       * ARGUMENTS: None.
+       * RETURNS: None.
+       */
+      VOID Pop( VOID ) noexcept
+      {
+        Current--;
+      } /* End of 'Pop' function */
+
+      /* Top value getting function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (value_type &) Top value reference;
+       */
+      value_type & Top( VOID ) noexcept
+      {
+        return Current[-1];
+      } /* End of 'Top' function */
+
+      /* Stack size getting function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (SIZE_T) Count of values on stack;
+       */
+      SIZE_T Size( VOID ) const noexcept
+      {
+        return Current - Values.get();
+      } /* End of 'Size' function */
+
+      /* Stack capacity getting function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (SIZE_T) Maximal count of values on stack;
+       */
+      SIZE_T Capacity( VOID ) const noexcept
+      {
+        return End - Values.get();
+      } /* End of 'Capacity' function */
+
+      /* Stack clearing function.
+       * ARGUMENTS: None.
+       * RETURNS: None.
+       */
+      VOID Drop( VOID ) noexcept
+      {
+        Current = Values.get();
+      } /* End of 'Drop' function */
+    }; /* End of 'fixed_stack' class */
+
+  /* Instance snapshot implementation class */
+  class snapshot_impl : public snapshot
+  {
+  public:
+    const source_impl &Source;                        // Module source, snapshot instance is created from
+    bin::limits MemoryLimits;                         // Linear memory limits (in pages, minimum is snapshot memory size)
+    memory_image MemoryImage;                         // Memory content image, instance memories are mapped from (not created if memory is initialized by copying)
+    std::vector<UINT8> Memory;                        // Memory content (without trailing zero bytes), copied to instance memories if image isn't created
+    std::vector<std::span<const UINT8>> DataSegments; // Data segments, available to 'memory.init' (active and dropped segments are empty)
+
+    /* Snapshot implementation constructor.
+     * ARGUMENTS:
+     *   - module source:
+     *       const source_impl &Source;
+     *   - instance memory content:
+     *       std::span<const UINT8> Memory;
+     *   - instance data segments:
+     *       std::vector<std::span<const UINT8>> DataSegments;
+     */
+    snapshot_impl( const source_impl &Source, std::span<const UINT8> Memory, std::vector<std::span<const UINT8>> DataSegments ) :
+      Source(Source),
+      MemoryLimits {static_cast<UINT32>(Memory.size() / linear_memory::PageSize), Source.MemoryLimits.Max},
+      DataSegments(std::move(DataSegments))
+    {
+      if (!MemoryImage.Create(Memory))
+      {
+        auto Last = std::ranges::find_if(Memory.rbegin(), Memory.rend(), []( UINT8 Byte ) { return Byte != 0; });
+
+        this->Memory.assign(Memory.begin(), Last.base());
+      }
+    } /* End of 'snapshot_impl' function */
+  }; /* End of 'snapshot_impl' class */
+
   /* Instance implementation function */
   class instance_impl : public instance
   {
@@ -310,14 +820,22 @@ namespace watap::impl::standard
     {
       UINT32 FunctionIndex;       // Function index
       SIZE_T InstructionIndex;    // Instruction index
-      SIZE_T LocalStackFrameSize; // Local stack frame size
+      SIZE_T LocalStackFrameSize; // Local stack frame size (0 for stack bytecode function, frame of which is placed on evaluation stack)
+      SIZE_T EvaluationStackBase; // Evaluation stack size at function start (stack bytecode function frame included)
     }; /* End of 'call' structure */
 
-    local_stack LocalStack;        // Stack of local variables / function parameters
-    local_stack EvaluationStack;   // Stack of evaluation
-    std::vector<UINT8> Heap;       // Memory heap
-    std::stack<call> CallStack;    // Call stack, holds pointers to functions
+    local_stack LocalStack;        // Stack of register bytecode and native code frames
+    local_stack EvaluationStack;   // Stack of evaluation (every value takes 8 byte slot), stack bytecode frames are placed on it below their values
+    linear_memory Heap;            // Linear memory (native code accesses beyond its size fault and trap, if it's guarded)
+    fixed_stack<call> CallStack;   // Call stack (of fixed depth, allocated once), holds pointers to functions
+    SIZE_T OptimizedCallDepth = 0; // Count of running optimized code calls of optimized callees (they aren't pushed to call stack, but count to its depth)
+    std::vector<host_function> FunctionImports; // Host functions, bound to module function imports (indexed by function import index)
+    std::vector<std::span<const UINT8>> DataSegments; // Data segments, available to 'memory.init' (active and dropped segments are empty)
     BOOL Trapped = FALSE;          // Is instance trapped
+    BOOL IsHostRunning = FALSE;    // Is imported host function running (instance calls are rejected then)
+    dispatch_type Dispatch;        // Instruction dispatch technique
+    std::vector<UINT32> CallCounts;     // Per-function call counters (tier-up)
+    std::vector<UINT32> BackEdgeCounts; // Per-function taken loop back edge counters (tier-up)
 
     /* Evaluation terminate function.
      * ARGUMENTS: None.
@@ -328,21 +846,471 @@ namespace watap::impl::standard
       Trapped = TRUE;
       LocalStack.Drop();
       EvaluationStack.Drop();
-      CallStack = std::stack<call>();
+      CallStack.Drop();
     } /* End of 'Trap' function */
 
+    /* Frame placement on evaluation stack checking function.
+     * ARGUMENTS:
+     *   - function:
+     *       const compiled_function_data &Function;
+     * RETURNS:
+     *   (BOOL) TRUE if function frame is placed on evaluation stack (arguments are the first frame slots), FALSE if it's placed on local stack;
+     */
+    static BOOL IsFrameOnEvaluationStack( const compiled_function_data &Function ) noexcept
+    {
+      return Function.Bytecode == bytecode_type::eStack || Function.Bytecode == bytecode_type::eCachedStack || IsHostFunction(Function);
+    } /* End of 'IsFrameOnEvaluationStack' function */
+
+    /* Imported host function checking function.
+     * ARGUMENTS:
+     *   - function:
+     *       const compiled_function_data &Function;
+     * RETURNS:
+     *   (BOOL) TRUE if function is imported host one, FALSE otherwise;
+     */
+    static BOOL IsHostFunction( const compiled_function_data &Function ) noexcept
+    {
+      return Function.Bytecode == static_cast<bytecode_type>(internal_bytecode_type::eHost);
+    } /* End of 'IsHostFunction' function */
+
+    /* Frame part, pushed by call, size getting function.
+     * ARGUMENTS:
+     *   - called function:
+     *       const compiled_function_data &Function;
+     * RETURNS:
+     *   (SIZE_T) Size of frame part in bytes (arguments, that are already on evaluation stack, excluded);
+     */
+    static SIZE_T GetCallFrameSize( const compiled_function_data &Function ) noexcept
+    {
+      if (IsFrameOnEvaluationStack(Function))
+        return (Function.FrameSlotCount - Function.ArgumentCount) * sizeof(UINT64);
+      return Function.FrameSlotCount * sizeof(UINT64);
+    } /* End of 'GetCallFrameSize' function */
+
+    /* Call frame getting function.
+     * ARGUMENTS:
+     *   - call:
+     *       const call &Call;
+     *   - called function:
+     *       const compiled_function_data &Function;
+     * RETURNS:
+     *   (UINT64 *) Frame (valid until stack, frame is placed on, is resized);
+     */
+    UINT64 * GetFrame( const call &Call, const compiled_function_data &Function ) noexcept
+    {
+      if (IsFrameOnEvaluationStack(Function))
+        return EvaluationStack.At<UINT64>(Call.EvaluationStackBase) - Function.FrameSlotCount;
+      return LocalStack.Get<UINT64>() - Function.FrameSlotCount;
+    } /* End of 'GetFrame' function */
+
+    /* Imported host function calling function (host function can't call instance back, as the call may move stacks, slots are placed on).
+     * ARGUMENTS:
+     *   - host function:
+     *       const host_function &Host;
+     *   - argument slots (result is written to the first slot):
+     *       UINT64 *Slots;
+     * RETURNS: None.
+     */
+    VOID CallHost( const host_function &Host, UINT64 *Slots )
+    {
+      IsHostRunning = TRUE;
+      Host.Trampoline(Host.Callable.get(), Slots);
+      IsHostRunning = FALSE;
+    } /* End of 'CallHost' function */
+
+    /* Value to evaluation stack pushing function (value takes single slot, slot bytes above value are zero).
+     * ARGUMENTS:
+     *   - value:
+     *       const VOID *Value;
+     *   - value size (nothing is pushed if 0):
+     *       SIZE_T Size;
+     * RETURNS: None.
+     */
+    VOID PushValue( const VOID *Value, SIZE_T Size ) noexcept
+    {
+      if (Size == 0)
+        return;
+
+      UINT64 *Slot = EvaluationStack.Push<UINT64>(sizeof(UINT64)) - 1;
+
+      *Slot = 0;
+      std::memcpy(Slot, Value, std::min<SIZE_T>(Size, sizeof(UINT64)));
+    } /* End of 'PushValue' function */
+
+    /* Value from evaluation stack popping function.
+     * ARGUMENTS:
+     *   - value:
+     *       VOID *Value;
+     *   - value size (nothing is popped if 0):
+     *       SIZE_T Size;
+     * RETURNS: None.
+     */
+    VOID PopValue( VOID *Value, SIZE_T Size ) noexcept
+    {
+      if (Size != 0)
+        std::memcpy(Value, EvaluationStack.Pop(sizeof(UINT64)), std::min<SIZE_T>(Size, sizeof(UINT64)));
+    } /* End of 'PopValue' function */
+
+    /* Call stack top call popping function (call frame is popped, result is pushed to evaluation stack).
+     * ARGUMENTS:
+     *   - called function:
+     *       const compiled_function_data &Function;
+     *   - call result (may be placed in popped frame):
+     *       const VOID *Result;
+     * RETURNS: None.
+     */
+    VOID PopCall( const compiled_function_data &Function, const VOID *Result ) noexcept
+    {
+      const call &Call = CallStack.Top();
+      UINT64 Value = 0;
+
+      std::memcpy(&Value, Result, std::min<SIZE_T>(Function.ReturnSize, sizeof(UINT64)));
+      if (IsFrameOnEvaluationStack(Function))
+        EvaluationStack.Pop(EvaluationStack.Size() - Call.EvaluationStackBase + Function.FrameSlotCount * sizeof(UINT64));
+      else
+        LocalStack.Pop(Call.LocalStackFrameSize);
+      CallStack.Pop();
+      PushValue(&Value, Function.ReturnSize);
+    } /* End of 'PopCall' function */
+
+    /* Function call frame pushing function (function arguments are consumed from evaluation stack).
+     * ARGUMENTS:
+     *   - index of function to call:
+     *       UINT32 FunctionIndex;
+     * RETURNS:
+     *   (const compiled_function_data *) Called function, nullptr if function can't be compiled or call stack is exhausted;
+     */
+    const compiled_function_data * PushCall( UINT32 FunctionIndex );
+
+    /* Resolved call site call frame pushing function (function arguments are consumed from evaluation stack).
+     * ARGUMENTS:
+     *   - call site to push frame of callee of:
+     *       const call_site &Site;
+     * RETURNS:
+     *   (BOOL) TRUE if frame is pushed, FALSE if call stack is exhausted;
+     */
+    BOOL PushCall( const call_site &Site );
+
+    /* Resolved call site tail call frame pushing function (call stack top stack bytecode call is replaced by callee one,
+     * callee arguments are consumed from evaluation stack, the rest caller values are dropped).
+     * ARGUMENTS:
+     *   - call site to push frame of callee of:
+     *       const call_site &Site;
+     *   - caller frame (placed on evaluation stack):
+     *       UINT64 *Frame;
+     * RETURNS: None.
+     */
+    VOID PushTailCall( const call_site &Site, UINT64 *Frame );
+
+    /* Stack bytecode 'call' or 'return_call' instruction quickening (callee resolution and instruction rewriting to 'eCallDirect' or 'eReturnCallDirect') function.
+     * ARGUMENTS:
+     *   - function, instruction is located in:
+     *       compiled_function_data &Function;
+     *   - 'call' or 'return_call' instruction index:
+     *       SIZE_T Ip;
+     * RETURNS:
+     *   (BOOL) TRUE if call is quickened, FALSE if callee can't be compiled;
+     */
+    BOOL QuickenCall( compiled_function_data &Function, SIZE_T Ip );
+
+    /* Function call counting function (function is tiered up when its call counter reaches threshold).
+     * ARGUMENTS:
+     *   - index of called function:
+     *       UINT32 FunctionIndex;
+     * RETURNS: None.
+     */
+    VOID CountCall( UINT32 FunctionIndex )
+    {
+      if (Source.TierUpCallCount != 0 && ++CallCounts[FunctionIndex] == Source.TierUpCallCount)
+        Source.TierUp(FunctionIndex);
+    } /* End of 'CountCall' function */
+
+    /* Call stack top function loop back edge counting function (function is tiered up when its back edge counter reaches threshold).
+     * ARGUMENTS:
+     *   - loop header branch target index:
+     *       UINT32 TargetIndex;
+     * RETURNS:
+     *   (native_entry) Optimized code entry at loop header to continue running call in, nullptr if call continues execution of its engine;
+     */
+    native_entry CountBackEdge( UINT32 TargetIndex )
+    {
+      if (Source.TierUpBackEdgeCount == 0 || ++BackEdgeCounts[CallStack.Top().FunctionIndex] != Source.TierUpBackEdgeCount)
+        return nullptr;
+      return TierUpLoop(TargetIndex);
+    } /* End of 'CountBackEdge' function */
+
+    /* Call stack top function loop tier-up (back edge counter reached threshold) function.
+     * ARGUMENTS:
+     *   - loop header branch target index:
+     *       UINT32 TargetIndex;
+     * RETURNS:
+     *   (native_entry) Optimized code entry at loop header to continue running call in, nullptr if call continues execution of its engine;
+     */
+    native_entry TierUpLoop( UINT32 TargetIndex )
+    {
+      const UINT32 FunctionIndex = CallStack.Top().FunctionIndex;
+
+      // Counter is restarted, so calls, running when function is tiered up by call counter, leave their loops too
+      BackEdgeCounts[FunctionIndex] = 0;
+      return Source.TierUpLoop(FunctionIndex, TargetIndex);
+    } /* End of 'TierUpLoop' function */
+
+    /* Linear memory growing function.
+     * ARGUMENTS:
+     *   - count of pages to add:
+     *       UINT32 Delta;
+     * RETURNS:
+     *   (UINT32) Previous memory size in pages, ~0 if memory can't be grown;
+     */
+    UINT32 GrowMemory( UINT32 Delta );
+
+    /* Bulk memory instruction execution function.
+     * ARGUMENTS:
+     *   - instruction ('memory.init', 'data.drop', 'memory.copy' or 'memory.fill'):
+     *       bin::system_instruction Instruction;
+     *   - data segment index ('memory.init' and 'data.drop' only):
+     *       UINT32 SegmentIndex;
+     *   - operand slots (destination address, source address, fill value or segment offset and byte count, 'data.drop' has no operands):
+     *       const UINT64 *Operands;
+     * RETURNS:
+     *   (BOOL) TRUE if instruction is executed, FALSE if range is out of memory or segment bounds (trap);
+     */
+    BOOL BulkMemory( bin::system_instruction Instruction, UINT32 SegmentIndex, const UINT64 *Operands );
+
+    /* Function execution function (executes functions from call stack top until call stack shrinks below initial size).
+     * TEMPLATE ARGUMENTS:
+     *   - instruction dispatch technique:
+     *       dispatch_type DISPATCH;
+     * ARGUMENTS:
+     *   - instance to execute code of (nullptr if handler table requested only):
+     *       instance_impl *Instance;
+     *   - handler table (256 entries, indexed by instruction) output pointer, not nullptr only if requested:
+     *       const VOID *const **HandlerTable = nullptr;
+     * RETURNS:
+     *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+     */
+    template <dispatch_type DISPATCH>
+      static BOOL Execute( instance_impl *Instance, const VOID *const **HandlerTable = nullptr );
+
+    /* Register bytecode function execution function (executes functions from call stack top until call stack shrinks below initial size).
+     * TEMPLATE ARGUMENTS:
+     *   - instruction dispatch technique:
+     *       dispatch_type DISPATCH;
+     * ARGUMENTS:
+     *   - instance to execute code of (nullptr if handler table requested only):
+     *       instance_impl *Instance;
+     *   - handler table (256 entries, indexed by instruction) output pointer, not nullptr only if requested:
+     *       const VOID *const **HandlerTable = nullptr;
+     * RETURNS:
+     *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+     */
+    template <dispatch_type DISPATCH>
+      static BOOL ExecuteRegister( instance_impl *Instance, const VOID *const **HandlerTable = nullptr );
+
+    /* Cached stack bytecode function execution function (executes functions from call stack top until call stack shrinks below initial size).
+     * TEMPLATE ARGUMENTS:
+     *   - instruction dispatch technique:
+     *       dispatch_type DISPATCH;
+     * ARGUMENTS:
+     *   - instance to execute code of (nullptr if handler table requested only):
+     *       instance_impl *Instance;
+     *   - handler table (768 entries, indexed by instruction and cache state) output pointer, not nullptr only if requested:
+     *       const VOID *const **HandlerTable = nullptr;
+     * RETURNS:
+     *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+     */
+    template <dispatch_type DISPATCH>
+      static BOOL ExecuteCached( instance_impl *Instance, const VOID *const **HandlerTable = nullptr );
+
+    /* Native function (on call stack top) execution function.
+     * ARGUMENTS:
+     *   - instance to execute code of:
+     *       instance_impl *Instance;
+     * RETURNS:
+     *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+     */
+    static BOOL ExecuteNative( instance_impl *Instance );
+
+    /* Optimized function (on call stack top) execution function.
+     * ARGUMENTS:
+     *   - instance to execute code of:
+     *       instance_impl *Instance;
+     *   - function on call stack top:
+     *       const compiled_function_data &Function;
+     *   - optimized code entry (function or on-stack replacement one):
+     *       native_entry Entry;
+     * RETURNS:
+     *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+     */
+    static BOOL ExecuteOptimized( instance_impl *Instance, const compiled_function_data &Function, native_entry Entry );
+
+    /* Host function (on call stack top) execution function.
+     * ARGUMENTS:
+     *   - instance to execute code of:
+     *       instance_impl *Instance;
+     *   - function on call stack top:
+     *       const compiled_function_data &Function;
+     * RETURNS:
+     *   (BOOL) TRUE;
+     */
+    static BOOL ExecuteHost( instance_impl *Instance, const compiled_function_data &Function );
+
+    /* Call stack top function execution function (chooses engine by function bytecode format).
+     * TEMPLATE ARGUMENTS:
+     *   - instruction dispatch technique:
+     *       dispatch_type DISPATCH;
+     * ARGUMENTS:
+     *   - instance to execute code of:
+     *       instance_impl *Instance;
+     *   - function on call stack top:
+     *       const compiled_function_data &Function;
+     * RETURNS:
+     *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+     */
+    template <dispatch_type DISPATCH>
+      static BOOL ExecuteTop( instance_impl *Instance, const compiled_function_data &Function );
+
   public:
 
     /* Instance implementation constructor.
      * ARGUMENTS:
      *   - module to create instance of:
      *       module_source_impl &Source;
+     *   - implementation settings:
+     *       const settings &Settings;
+     *   - host functions, bound to module function imports (in import order):
+     *       std::vector<host_function> FunctionImports;
+     *   - snapshot of module instance to start from (nullptr if instance is started from module):
+     *       const snapshot_impl *Snapshot;
      */
-    instance_impl( const source_impl &Source ) : Source(Source)
+    instance_impl( const source_impl &Source, const settings &Settings, std::vector<host_function> FunctionImports, const snapshot_impl *Snapshot = nullptr ) :
+      Source(Source),
+      Heap(
+        Snapshot != nullptr ? Snapshot->MemoryLimits : Source.MemoryLimits,
+        Source.MemoryReservation,
+        Source.MemoryGrowthGranularity,
+        Snapshot != nullptr ? Snapshot->MemoryImage : Source.MemoryImage
+      ),
+      CallStack(Settings.CallStackDepth),
+      FunctionImports(std::move(FunctionImports)),
+      Dispatch(Settings.Dispatch),
+      CallCounts(Source.Functions.size()),
+      BackEdgeCounts(Source.Functions.size())
     {
-      Heap.resize(65536);
+      if (Snapshot != nullptr)
+      {
+        if (!Snapshot->MemoryImage.IsCreated())
+          std::ranges::copy(Snapshot->Memory, Heap.Data());
+        DataSegments = Snapshot->DataSegments;
+        return;
+      }
+
+      // Active segments are validated to fit initial memory by module loading, they are copied if memory isn't mapped from image
+      DataSegments.reserve(Source.DataSegments.size());
+      for (const data_segment &Segment : Source.DataSegments)
+        if (Segment.Offset)
+        {
+          if (!Source.MemoryImage.IsCreated())
+            std::ranges::copy(Segment.Data, Heap.Data() + *Segment.Offset);
+          DataSegments.emplace_back();
+        }
+        else
+          DataSegments.emplace_back(Segment.Data);
     } /* End of 'runtime_impl' class */
 
+    /* Compiled function linking (direct-threaded handler resolution) function.
+     * ARGUMENTS:
+     *   - function to link:
+     *       compiled_function_data &Function;
+     * RETURNS: None.
+     */
+    static VOID Link( compiled_function_data &Function );
+
+    /* Single instruction relinking (after instruction rewriting) function.
+     * ARGUMENTS:
+     *   - function, instruction is located in:
+     *       compiled_function_data &Function;
+     *   - rewritten instruction index:
+     *       SIZE_T Ip;
+     * RETURNS: None.
+     */
+    static VOID Link( compiled_function_data &Function, SIZE_T Ip );
+
+    /* Function calling from native code function (arguments and result are passed through caller frame slots).
+     * ARGUMENTS:
+     *   - native code execution context:
+     *       native_context *Context;
+     *   - caller frame:
+     *       UINT64 *Frame;
+     *   - index of function to call:
+     *       UINT32 FunctionIndex;
+     *   - caller frame slot of the first argument (result is stored to it):
+     *       UINT32 Base;
+     * RETURNS:
+     *   (UINT64 *) Caller frame (it may be moved by callee), nullptr if callee trapped;
+     */
+    static UINT64 * NativeCall( native_context *Context, UINT64 *Frame, UINT32 FunctionIndex, UINT32 Base );
+
+    /* Linear memory growing from native code function.
+     * ARGUMENTS:
+     *   - native code execution context:
+     *       native_context *Context;
+     *   - frame slot with count of pages to add (previous memory size in pages or ~0 is stored to it):
+     *       UINT64 *Slot;
+     * RETURNS: None.
+     */
+    static VOID NativeGrowMemory( native_context *Context, UINT64 *Slot );
+
+    /* Bulk memory instruction execution from native code function.
+     * ARGUMENTS:
+     *   - native code execution context:
+     *       native_context *Context;
+     *   - operand slots (in operand stack order):
+     *       const UINT64 *Operands;
+     *   - instruction (system instruction code):
+     *       UINT32 Instruction;
+     *   - data segment index ('memory.init' and 'data.drop' only):
+     *       UINT32 SegmentIndex;
+     * RETURNS:
+     *   (BOOL) TRUE if instruction is executed, FALSE on trap;
+     */
+    static BOOL NativeBulkMemory( native_context *Context, const UINT64 *Operands, UINT32 Instruction, UINT32 SegmentIndex );
+
+    /* Loop tier-up from native code (called when back edge counter reaches threshold) function.
+     * ARGUMENTS:
+     *   - native code execution context:
+     *       native_context *Context;
+     *   - loop header branch target index:
+     *       UINT32 TargetIndex;
+     * RETURNS:
+     *   (UINT32) 0 if native code continues execution, 1 if call is finished by optimized code (result is stored to frame first slot), 2 on trap;
+     */
+    static UINT32 NativeTierUp( native_context *Context, UINT32 TargetIndex );
+
+    /* Function calling from optimized code function.
+     * ARGUMENTS:
+     *   - native code execution context:
+     *       native_context *Context;
+     *   - argument slots (result is stored to the first one):
+     *       UINT64 *Arguments;
+     *   - index of function to call:
+     *       UINT32 FunctionIndex;
+     * RETURNS:
+     *   (BOOL) TRUE if callee finished without trap, FALSE otherwise;
+     */
+    static BOOL OptimizedCall( native_context *Context, UINT64 *Arguments, UINT32 FunctionIndex );
+
+    /* Function (with arguments pushed to evaluation stack) calling function (result is left on evaluation stack).
+     * ARGUMENTS:
+     *   - function index:
+     *       UINT32 FunctionIndex;
+     *   - function:
+     *       const compiled_function_data &Function;
+     * RETURNS:
+     *   (BOOL) TRUE if function finished without trap, FALSE otherwise;
+     */
+    BOOL ExecuteCall( UINT32 FunctionIndex, const compiled_function_data &Function );
+
     /* Module function calling function.
      * ARGUMENTS:
      *   - function name:
@@ -352,15 +1320,18 @@ namespace watap::impl::standard
      * RETURNS:
      *   (std::optional<value>) Return value if called, std::nullopt otherwise;
      */
-    std::optional<value> Call( std::string_view FunctionName, std::span<const value> Parameters = {} )
-    {
-      // auto *RootFnPtr = Source.GetExportFunction(FunctionName);
-      // if (RootFnPtr == nullptr)
-      //   return std::nullopt;
-      // const compiled_function_data &RootFn = *RootFnPtr;
+    std::optional<value> Call( std::string_view FunctionName, std::span<const value> Parameters = {} ) override;
 
-      return std::nullopt;
-    } /* End of 'Call' function */
+    /* Exported function finding function.
+     * ARGUMENTS:
+     *   - function name:
+     *       std::string_view FunctionName;
+     *   - expected function signature:
+     *       const function_signature &Signature;
+     * RETURNS:
+     *   (std::optional<UINT32>) Function index if function with such name and signature is exported, std::nullopt otherwise;
+     */
+    std::optional<UINT32> FindFunction( std::string_view FunctionName, const function_signature &Signature ) const override;
 
     /* Global value getting function.
      * ARGUMENTS:
@@ -386,16 +1357,30 @@ namespace watap::impl::standard
       return std::nullopt;
     } /* End of 'GetGlobal' function */
 
+    /* Instance snapshot creation function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (snapshot_impl *) Created snapshot, nullptr if instance is trapped or running (its state isn't consistent then);
+     */
+    snapshot_impl * CreateSnapshot( VOID ) const
+    {
+      if (Trapped || CallStack.Size() != 0)
+        return nullptr;
+      return new snapshot_impl(Source, std::span<const UINT8>(Heap.Data(), Heap.Size()), DataSegments);
+    } /* End of 'CreateSnapshot' function */
+
     /* Module pointer dereferencing function.
      * ARGUMENTS:
      *   - module ptr:
      *       UINT32 WasmPtr;
      * RETURNS:
-     *   (VOID *) Pointer to runtime memory that corresponds to WasmPtr;
+     *   (VOID *) Pointer to runtime memory that corresponds to WasmPtr, nullptr if WasmPtr is out of memory bounds;
      */
     VOID * GetPtr( UINT32 WasmPtr )
     {
-      return Heap.data() + WasmPtr;
+      if (WasmPtr >= Heap.Size())
+        return nullptr;
+      return Heap.Data() + WasmPtr;
     } /* End of 'GetPtr' function */
 
     /* Is module trapped, trap requires module full restart.
@@ -414,10 +1399,25 @@ namespace watap::impl::standard
      */
     VOID Restart( VOID )
     {
+      // Stacks are in use by running host function caller
+      if (IsHostRunning)
+        return;
       if (!Trapped)
         Trap();
       Trapped = FALSE;
     } /* End of 'Restart' function */
+
+  protected:
+    /* Function by index calling function.
+     * ARGUMENTS:
+     *   - function index:
+     *       UINT32 FunctionIndex;
+     *   - argument slots (result is written to the first slot):
+     *       UINT64 *Slots;
+     * RETURNS:
+     *   (BOOL) TRUE if function finished without trap, FALSE otherwise;
+     */
+    BOOL CallFunction( UINT32 FunctionIndex, UINT64 *Slots ) override;
   }; /* End of 'runtime_impl' class */
 
   /* Binary stream utility set */
@@ -430,7 +1430,7 @@ namespace watap::impl::standard
      * RETURNS:
      *   (std::optional<UINT32>) Parsed UINT32.
      */
-    std::optional<UINT32> ParseUint( binary_input_stream &Stream )
+    inline std::optional<UINT32> ParseUint( binary_input_stream &Stream )
     {
       auto [Value, Offset] = leb128::DecodeUnsigned(Stream.CurrentPtr());
       if (Stream.Get<UINT8>(Offset))
@@ -443,460 +1443,3 @@ namespace watap::impl::standard
 #endif // !defined(__watap_impl_standard_def_h_)
 
 /* END OF 'watap_impl_standard_def.h' FILE */
-
-#if 0
-/* Evaluation binary operator implementation generation macro */
-#define WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(TYPE, OP) { TYPE *Ptr = EvaluationStack.Pop<TYPE>(sizeof(TYPE)); Ptr[-1] = (Ptr[-1] OP *Ptr); break; }
-
-/* Evaluation binary function implementation generation macro */
-#define WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(TYPE, FN) { TYPE *Ptr = EvaluationStack.Pop<TYPE>(sizeof(TYPE)); Ptr[-1] = (FN(Ptr[-1], *Ptr)); break; }
-
-/* Evaluation unary function implementation generation macro */
-#define WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(TYPE, FN) { TYPE *Ptr = EvaluationStack.Get<TYPE>() - 1; *Ptr = (FN(*Ptr)); break; }
-
-/* WATAP_STANDARD_ROT_FUNCTION_WRAPPER macro helper */
-#define __WATAP_STANDARD_ROT_FUNCTION_WRAPPER(LARG, RARG) (LARG, static_cast<INT>(RARG))
-
-/* Wrapper, special for std::rot* functions don't emit warnings during WIN32 Compilation */
-#define WATAP_STANDARD_ROT_FUNCTION_WRAPPER(FN) FN __WATAP_STANDARD_ROT_FUNCTION_WRAPPER
-
-/* Heap loading with builtin conversion implementaion function */
-#define WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(TYPE, FROM)                                             \
-{                                                                                                    \
-  auto [Ptr, Offset] = leb128::DecodeUnsigned(InstructionPointer);                                   \
-  InstructionPointer += Offset;                                                                      \
-  EvaluationStack.Push<TYPE>(sizeof(TYPE))[-1] = *reinterpret_cast<const FROM *>(Heap.data() + Ptr); \
-  break;                                                                                             \
-}
-
-/* Heap loading with builtin conversion implementaion function */
-#define WATAP_STANDARD_DEFINE_HEAP_STORE_TO(TYPE, TO)                                                     \
-{                                                                                                         \
-  auto [Ptr, Offset] = leb128::DecodeUnsigned(InstructionPointer);                                        \
-  InstructionPointer += Offset;                                                                           \
-  *reinterpret_cast<TO *>(Heap.data() + Ptr) = static_cast<TO>(*EvaluationStack.Pop<TYPE>(sizeof(TYPE))); \
-  break;                                                                                                  \
-}
-
-/* Integer extend generation macro definition */
-#define WATAP_STANDARD_DEFINE_I_EXTEND(BASE, SUB) { BASE *P = EvaluationStack.Get<BASE>() - 1; *P = static_cast<BASE>(*reinterpret_cast<SUB *>(P)); break; }
-
-/* Heap loading with builtin conversion implementaion function */
-#define WATAP_STANDARD_DEFINE_CAST(FROM, TO)                                                             \
-{                                                                                                        \
-  FROM P = *EvaluationStack.Pop<FROM>(sizeof(FROM));                                                     \
-  EvaluationStack.Push<TO>(sizeof(TO))[-1] = static_cast<TO>(P);                                         \
-  break;                                                                                                 \
-}
-
-
-    /* Module function calling function.
-     * ARGUMENTS:
-     *   - function name:
-     *       std::string_view FunctionName;
-     *   - function parameter list:
-     *       std::span<const value> Parameters;
-     * RETURNS:
-     *   (std::optional<value>) Return value if called, std::nullopt otherwise;
-     */
-    std::optional<value> Call( std::string_view FunctionName, std::span<const value> Parameters = {} )
-    {
-      UINT32 RootFunctionIndex;
-      if (auto FIter = Source.FunctionExportTable.find(FunctionName); FIter != Source.FunctionExportTable.end())
-        RootFunctionIndex = FIter->second;
-      else
-        return std::nullopt;
-      auto &RootFunction = Source.Functions[RootFunctionIndex];
-
-      // Initialize callstack
-      CallStack.push(call {
-        .FunctionIndex = RootFunctionIndex,
-        .InstructionIndex = 0,
-        .LocalStackFrameSize = RootFunction.Locals.size() * sizeof(UINT64),
-      });
-
-      // Push initial arguments into evaluation stack (for them being popped from during first function start)
-      for (UINT32 i = 0; i < RootFunction.ArgumentCount; i++)
-      {
-        SIZE_T Size = bin::GetValueTypeSize(RootFunction.Locals[i]);
-        UINT8 *Ptr = EvaluationStack.Push<UINT8>(Size);
-        std::memcpy(Ptr - Size, &Parameters[i], Size);
-      }
-
-      // Start function execution
-      while (!CallStack.empty())
-      {
-        call &Call = CallStack.top();
-
-        if (Call.InstructionIndex >= Source.Functions[Call.FunctionIndex].Instructions.size())
-        {
-          CallStack.pop();
-          continue;
-        }
-
-        const auto &Function = Source.Functions[Call.FunctionIndex];
-        
-        // Decode instructions
-        auto &Instructions = Function.Instructions;
-        const UINT8 *InstructionPointer = Instructions.data() + Call.InstructionIndex;
-        const UINT8 *const InstructionsEnd = Instructions.data() + Instructions.size();
-
-        UINT64 *StackFrame = reinterpret_cast<UINT64 *>(LocalStack.Push(Call.LocalStackFrameSize));
-        // Load bytes from stack
-
-        // Write function argumetns if function just started
-        if (Call.InstructionIndex == 0)
-          for (INT i = 0; i < (INT)Function.ArgumentCount; i++)
-            StackFrame[-1 - i] = *reinterpret_cast<UINT64 *>(EvaluationStack.Pop(bin::GetValueTypeSize(Function.Locals[i])));
-
-        BOOL Continue = TRUE;
-        while (Continue && InstructionPointer < InstructionsEnd)
-        {
-          bin::instruction Instruction = static_cast<bin::instruction>(*InstructionPointer++);
-
-          switch (Instruction)
-          {
-          case bin::instruction::eUnreachable       :
-            Trap();
-            Continue = FALSE;
-            break;
-
-          case bin::instruction::eNop               :
-            break;
-
-          case bin::instruction::eBlock             :
-          {
-            break;
-          }
-
-          case bin::instruction::eLoop              : break;
-          case bin::instruction::eIf                :
-          {
-
-            break;
-          }
-          case bin::instruction::eElse              : break;
-          case bin::instruction::eExpressionEnd     : break;
-          case bin::instruction::eBr                : break;
-          case bin::instruction::eBrIf              : break;
-          case bin::instruction::eReturn            :
-          {
-            // TODO TC4 WASM Fix return
-            Continue = FALSE;
-            break;
-          }
-          case bin::instruction::eBrTable           : break;
-
-          case bin::instruction::eCall              :
-          {
-            auto [FunctionIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
-            InstructionPointer += Offset;
-
-            CallStack.push(call {
-              .FunctionIndex = (UINT32)FunctionIndex,
-              .InstructionIndex = 0,
-              .LocalStackFrameSize = Source.Functions[FunctionIndex].Locals.size() * sizeof(UINT64),
-            });
-            Continue = FALSE;
-            break;
-          }
-
-          case bin::instruction::eCallIndirect      : break;
-
-          case bin::instruction::eDrop              : break; // TODO TC4 WASM Implement type context.
-          case bin::instruction::eSelect            : break;
-          case bin::instruction::eSelectTyped       : break;
-
-          case bin::instruction::eLocalGet          :
-          {
-            auto [LocalIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
-            InstructionPointer += Offset;
-
-            SIZE_T LocalSize = bin::GetValueTypeSize(Function.Locals[LocalIndex]);
-            UINT8 *P = EvaluationStack.Push<UINT8>(LocalSize);
-            std::memcpy(P - LocalSize, StackFrame - LocalIndex - 1, LocalSize);
-            break;
-          }
-
-          case bin::instruction::eLocalSet          :
-          {
-            auto [LocalIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
-            InstructionPointer += Offset;
-
-            SIZE_T LocalSize = bin::GetValueTypeSize(Function.Locals[LocalIndex]);
-            UINT8 *P = EvaluationStack.Pop<UINT8>(LocalSize);
-            std::memcpy(StackFrame - LocalIndex - 1, P, LocalSize);
-            break;
-          }
-
-          case bin::instruction::eLocalTee          :
-          {
-            auto [LocalIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
-            InstructionPointer += Offset;
-
-            SIZE_T LocalSize = bin::GetValueTypeSize(Function.Locals[LocalIndex]);
-            UINT8 *P = EvaluationStack.Get<UINT8>() - LocalSize;
-            std::memcpy(StackFrame - LocalIndex - 1, P, LocalSize);
-            break;
-          }
-
-          case bin::instruction::eGlobalGet         : break;
-          case bin::instruction::eGlobalSet         : break;
-          case bin::instruction::eTableGet          : break;
-          case bin::instruction::eTableSet          : break;
-
-          case bin::instruction::eI32Load           : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM( UINT32,  UINT32)
-          case bin::instruction::eI64Load           : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM( UINT64,  UINT64)
-          case bin::instruction::eF32Load           : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(FLOAT32, FLOAT32)
-          case bin::instruction::eF64Load           : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(FLOAT64, FLOAT64)
-
-          case bin::instruction::eI32Load8S         : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT32,  INT8 )
-          case bin::instruction::eI32Load8U         : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT32, UINT8 )
-          case bin::instruction::eI32Load16S        : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT32,  INT16)
-          case bin::instruction::eI32Load16U        : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT32, UINT16)
-
-          case bin::instruction::eI64Load8S         : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT64,  INT8 )
-          case bin::instruction::eI64Load8U         : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT64, UINT8 )
-          case bin::instruction::eI64Load16S        : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT64,  INT16)
-          case bin::instruction::eI64Load16U        : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT64, UINT16)
-          case bin::instruction::eI64Load32S        : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT64,  INT32)
-          case bin::instruction::eI64Load32U        : WATAP_STANDARD_DEFINE_HEAP_LOAD_FROM(UINT64, UINT32)
-
-          case bin::instruction::eI32Store          :
-          case bin::instruction::eF32Store          :
-             WATAP_STANDARD_DEFINE_HEAP_STORE_TO(UINT32, UINT32)
-
-          case bin::instruction::eI64Store          :
-          case bin::instruction::eF64Store          :
-             WATAP_STANDARD_DEFINE_HEAP_STORE_TO(UINT64, UINT64)
-
-          case bin::instruction::eI32Store8         : WATAP_STANDARD_DEFINE_HEAP_STORE_TO(UINT32, UINT8 )
-          case bin::instruction::eI32Store16        : WATAP_STANDARD_DEFINE_HEAP_STORE_TO(UINT32, UINT16)
-          case bin::instruction::eI64Store8         : WATAP_STANDARD_DEFINE_HEAP_STORE_TO(UINT64, UINT8 )
-          case bin::instruction::eI64Store16        : WATAP_STANDARD_DEFINE_HEAP_STORE_TO(UINT64, UINT16)
-          case bin::instruction::eI64Store32        : WATAP_STANDARD_DEFINE_HEAP_STORE_TO(UINT64, UINT32)
-
-          case bin::instruction::eMemorySize        :
-          {
-            EvaluationStack.Push<UINT32>(4)[-1] = static_cast<UINT32>(Heap.size());
-            break;
-          }
-
-          case bin::instruction::eMemoryGrow        :
-          {
-            Heap.resize(Heap.size() * 2, 0x00);
-            break;
-          }
-
-          case bin::instruction::eI32Const          :
-          {
-            auto [Value, Offset] = leb128::DecodeSigned<32>(InstructionPointer);
-            InstructionPointer += Offset;
-            EvaluationStack.Push<UINT32>(4)[-1] = (UINT32)Value;
-            break;
-          }
-
-          case bin::instruction::eF32Const          :
-          {
-            EvaluationStack.Push<FLOAT>(4)[-1] = *reinterpret_cast<const FLOAT *>(InstructionPointer);
-            InstructionPointer += 4;
-            break;
-          }
-
-          case bin::instruction::eI64Const          :
-          {
-            auto [Value, Offset] = leb128::DecodeSigned<64>(InstructionPointer);
-            InstructionPointer += Offset;
-            EvaluationStack.Push<UINT64>(4)[-1] = Value;
-            break;
-          }
-
-          case bin::instruction::eF64Const          :
-          {
-            EvaluationStack.Push<FLOAT>(8)[-1] = *reinterpret_cast<const FLOAT *>(InstructionPointer);
-            InstructionPointer += 8;
-            break;
-          }
-
-          case bin::instruction::eI32Eqz            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(  INT32, 0 ==)
-          case bin::instruction::eI32Eq             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, ==)
-          case bin::instruction::eI32Ne             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, !=)
-          case bin::instruction::eI32LtS            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT32, <)
-          case bin::instruction::eI32LtU            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, <)
-          case bin::instruction::eI32GtS            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT32, >)
-          case bin::instruction::eI32GtU            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, >)
-          case bin::instruction::eI32LeS            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT32, <=)
-          case bin::instruction::eI32LeU            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, <=)
-          case bin::instruction::eI32GeS            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT32, >=)
-          case bin::instruction::eI32GeU            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, >=)
-
-          case bin::instruction::eI64Eqz            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(  INT64, 0 ==)
-          case bin::instruction::eI64Eq             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, ==)
-          case bin::instruction::eI64Ne             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, !=)
-          case bin::instruction::eI64LtS            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT64, <)
-          case bin::instruction::eI64LtU            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, <)
-          case bin::instruction::eI64GtS            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT64, >)
-          case bin::instruction::eI64GtU            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, >)
-          case bin::instruction::eI64LeS            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT64, <=)
-          case bin::instruction::eI64LeU            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, <=)
-          case bin::instruction::eI64GeS            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT64, >=)
-          case bin::instruction::eI64GeU            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, >=)
-
-          case bin::instruction::eF32Eq             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, ==)
-          case bin::instruction::eF32Ne             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, !=)
-          case bin::instruction::eF32Lt             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, <)
-          case bin::instruction::eF32Gt             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, >)
-          case bin::instruction::eF32Le             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, <=)
-          case bin::instruction::eF32Ge             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, >=)
-          case bin::instruction::eF64Eq             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, ==)
-          case bin::instruction::eF64Ne             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, !=)
-          case bin::instruction::eF64Lt             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, <)
-          case bin::instruction::eF64Gt             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, >)
-          case bin::instruction::eF64Le             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, <=)
-          case bin::instruction::eF64Ge             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, >=)
-
-          case bin::instruction::eI32Clz            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(UINT32, std::countl_zero<UINT32>)
-          case bin::instruction::eI32Ctz            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(UINT32, std::countr_zero<UINT32>)
-          case bin::instruction::eI32Popcnt         : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(UINT32, std::popcount<UINT32>)
-
-          case bin::instruction::eI32Add            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, +)
-          case bin::instruction::eI32Sub            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, -)
-          case bin::instruction::eI32Mul            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, *)
-          case bin::instruction::eI32DivS           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT32, /)
-          case bin::instruction::eI32DivU           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, /)
-          case bin::instruction::eI32RemS           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT32, %)
-          case bin::instruction::eI32RemU           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, %)
-          case bin::instruction::eI32And            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, &)
-          case bin::instruction::eI32Or             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, |)
-          case bin::instruction::eI32Xor            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, ^)
-          case bin::instruction::eI32Shl            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, <<)
-          case bin::instruction::eI32ShrS           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT32, >>)
-          case bin::instruction::eI32ShrU           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT32, >>)
-          case bin::instruction::eI32Rotl           : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(UINT32, WATAP_STANDARD_ROT_FUNCTION_WRAPPER(std::rotl))
-          case bin::instruction::eI32Rotr           : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(UINT32, WATAP_STANDARD_ROT_FUNCTION_WRAPPER(std::rotr))
-
-          case bin::instruction::eI64Clz            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(UINT64, std::countl_zero<UINT64>)
-          case bin::instruction::eI64Ctz            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(UINT64, std::countr_zero<UINT64>)
-          case bin::instruction::eI64Popcnt         : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(UINT64, std::popcount<UINT64>)
-
-          case bin::instruction::eI64Add            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, +)
-          case bin::instruction::eI64Sub            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, -)
-          case bin::instruction::eI64Mul            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, *)
-          case bin::instruction::eI64DivS           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT64, /)
-          case bin::instruction::eI64DivU           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, /)
-          case bin::instruction::eI64RemS           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT64, %)
-          case bin::instruction::eI64RemU           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, %)
-          case bin::instruction::eI64And            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, &)
-          case bin::instruction::eI64Or             : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, |)
-          case bin::instruction::eI64Xor            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, ^)
-          case bin::instruction::eI64Shl            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, <<)
-          case bin::instruction::eI64ShrS           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY( INT64, >>)
-          case bin::instruction::eI64ShrU           : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(UINT64, >>)
-          case bin::instruction::eI64Rotl           : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(UINT64, WATAP_STANDARD_ROT_FUNCTION_WRAPPER(std::rotl))
-          case bin::instruction::eI64Rotr           : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(UINT64, WATAP_STANDARD_ROT_FUNCTION_WRAPPER(std::rotr))
-
-          case bin::instruction::eF32Abs            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT32, std::abs)
-          case bin::instruction::eF32Neg            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT32, -)
-          case bin::instruction::eF32Ceil           : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT32, std::ceil)
-          case bin::instruction::eF32Floor          : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT32, std::floor)
-          case bin::instruction::eF32Trunc          : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT32, std::trunc)
-          case bin::instruction::eF32Nearest        : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT32, std::round)
-          case bin::instruction::eF32Sqrt           : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT32, std::sqrt)
-          case bin::instruction::eF32Add            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, +)
-          case bin::instruction::eF32Sub            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, -)
-          case bin::instruction::eF32Mul            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, *)
-          case bin::instruction::eF32Div            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT32, /)
-          case bin::instruction::eF32CopySign       : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(FLOAT32, std::copysign)
-          case bin::instruction::eF32Min            : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(FLOAT32, std::min)
-          case bin::instruction::eF32Max            : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(FLOAT32, std::max)
-
-          case bin::instruction::eF64Abs            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT64, std::abs)
-          case bin::instruction::eF64Neg            : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT64, -)
-          case bin::instruction::eF64Ceil           : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT64, std::ceil)
-          case bin::instruction::eF64Floor          : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT64, std::floor)
-          case bin::instruction::eF64Trunc          : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT64, std::trunc)
-          case bin::instruction::eF64Nearest        : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT64, std::round)
-          case bin::instruction::eF64Sqrt           : WATAP_STANDARD_DEFINE_EXEC_FN_UNARY(FLOAT64, std::sqrt)
-          case bin::instruction::eF64Add            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, +)
-          case bin::instruction::eF64Sub            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, -)
-          case bin::instruction::eF64Mul            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, *)
-          case bin::instruction::eF64Div            : WATAP_STANDARD_DEFINE_EXEC_OP_BINARY(FLOAT64, /)
-          case bin::instruction::eF64Min            : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(FLOAT64, std::copysign)
-          case bin::instruction::eF64Max            : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(FLOAT64, std::min)
-          case bin::instruction::eF64CopySign       : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(FLOAT64, std::max)
-
-          case bin::instruction::eI32WrapI64        : WATAP_STANDARD_DEFINE_CAST( UINT32,  UINT64)
-
-          case bin::instruction::eI32TruncF32S      : WATAP_STANDARD_DEFINE_CAST(FLOAT32,   INT32)
-          case bin::instruction::eI32TruncF32U      : WATAP_STANDARD_DEFINE_CAST(FLOAT32,  UINT32)
-          case bin::instruction::eI32TruncF64S      : WATAP_STANDARD_DEFINE_CAST(FLOAT64,   INT32)
-          case bin::instruction::eI32TruncF64U      : WATAP_STANDARD_DEFINE_CAST(FLOAT64,  UINT32)
-
-          case bin::instruction::eI64ExtendI32S     : WATAP_STANDARD_DEFINE_CAST(  INT32,   INT64)
-          case bin::instruction::eI64ExtendI32U     : WATAP_STANDARD_DEFINE_CAST( UINT32,  UINT64)
-          case bin::instruction::eI64TruncF32S      : WATAP_STANDARD_DEFINE_CAST(FLOAT32,   INT64)
-          case bin::instruction::eI64TruncF32U      : WATAP_STANDARD_DEFINE_CAST(FLOAT32,  UINT64)
-          case bin::instruction::eI64TruncF64S      : WATAP_STANDARD_DEFINE_CAST(FLOAT64,   INT64)
-          case bin::instruction::eI64TruncF64U      : WATAP_STANDARD_DEFINE_CAST(FLOAT64,  UINT64)
-
-          case bin::instruction::eF32ConvertI32S    : WATAP_STANDARD_DEFINE_CAST(  INT32, FLOAT32)
-          case bin::instruction::eF32ConvertI32U    : WATAP_STANDARD_DEFINE_CAST( UINT32, FLOAT32)
-          case bin::instruction::eF32ConvertI64S    : WATAP_STANDARD_DEFINE_CAST(  INT64, FLOAT32)
-          case bin::instruction::eF32ConvertI64U    : WATAP_STANDARD_DEFINE_CAST( UINT64, FLOAT32)
-          case bin::instruction::eF32DemoteF64      : WATAP_STANDARD_DEFINE_CAST(FLOAT64, FLOAT32)
-
-          case bin::instruction::eF64ConvertI32S    : WATAP_STANDARD_DEFINE_CAST(  INT32, FLOAT64)
-          case bin::instruction::eF64ConvertI32U    : WATAP_STANDARD_DEFINE_CAST( UINT32, FLOAT64)
-          case bin::instruction::eF64ConvertI64S    : WATAP_STANDARD_DEFINE_CAST(  INT64, FLOAT64)
-          case bin::instruction::eF64ConvertI64U    : WATAP_STANDARD_DEFINE_CAST( UINT64, FLOAT64)
-          case bin::instruction::eF64PromoteF32     : WATAP_STANDARD_DEFINE_CAST(FLOAT32, FLOAT64)
-
-          case bin::instruction::eI32ReinterpretF32 : break; // That's all
-          case bin::instruction::eI64ReinterpretF64 : break; // That's all
-          case bin::instruction::eF32ReinterpretI32 : break; // That's all
-          case bin::instruction::eF64ReinterpretI64 : break; // That's all
-
-          case bin::instruction::eI32Extend8S       : WATAP_STANDARD_DEFINE_I_EXTEND(INT32, INT8 )
-          case bin::instruction::eI32Extend16S      : WATAP_STANDARD_DEFINE_I_EXTEND(INT32, INT16)
-          case bin::instruction::eI64Extend8S       : WATAP_STANDARD_DEFINE_I_EXTEND(INT64, INT8 )
-          case bin::instruction::eI64Extend16S      : WATAP_STANDARD_DEFINE_I_EXTEND(INT64, INT16)
-          case bin::instruction::eI64Extend32S      : WATAP_STANDARD_DEFINE_I_EXTEND(INT64, INT32)
-
-          case bin::instruction::eRefNull           :
-            *EvaluationStack.Push<UINT32>(4) = 0;
-            break;
-
-          case bin::instruction::eRefIsNull         : WATAP_STANDARD_DEFINE_EXEC_FN_BINARY(UINT32, 0 ==)
-
-          case bin::instruction::eRefFunc           :
-          {
-            auto [FunctionIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
-            InstructionPointer += Offset;
-            *EvaluationStack.Push<UINT32>(4) = FunctionIndex;
-            break;
-          }
-
-          case bin::instruction::eSystem            :
-            Trap(); // TODO TC4 WASM
-            break;
-
-          case bin::instruction::eVector            :
-            Trap(); // TODO TC4 WASM SIMD Add support
-            break;
-
-          default                                   : break;
-          }
-        }
-
-        Call.InstructionIndex = InstructionPointer - Instructions.data();
-      }
-
-      if (Trapped || !RootFunction.ReturnType)
-        return std::nullopt;
-
-      SIZE_T Size = bin::GetValueTypeSize(*RootFunction.ReturnType);
-      value Result { .F64x2 {0, 0} };
-      std::memcpy(&Result, EvaluationStack.Pop(Size), Size);
-      return Result;
-    } /* End of 'Call' function */
-#endif
@@ -0,0 +1,569 @@
+#ifndef __watap_impl_standard_exec_h_
+#define __watap_impl_standard_exec_h_
+
+#include "watap_impl_standard_def.h"
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/* Direct-threaded code support (labels as values extension) */
+#if defined(__GNUC__) || defined(__clang__)
+#  define WATAP_STANDARD_THREADED_DISPATCH
+#endif // defined(__GNUC__) || defined(__clang__)
+
+/* Native code compilation support (x86-64 code generator, 'mmap' executable memory) */
+#if defined(__x86_64__) && defined(__linux__)
+#  define WATAP_STANDARD_NATIVE_CODE
+#endif // defined(__x86_64__) && defined(__linux__)
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* Execution utility function set */
+  namespace exec_util
+  {
+    /* WASM 'min' operation implementation function.
+     * ARGUMENTS:
+     *   - operands:
+     *       type Lhs, Rhs;
+     * RETURNS:
+     *   (type) Minimal operand (NaN if any operand is NaN, -0 is less than +0);
+     */
+    template <typename type>
+      inline type Min( type Lhs, type Rhs ) noexcept
+      {
+        if (Lhs != Lhs || Rhs != Rhs)
+          return Lhs + Rhs;
+        if (Lhs == Rhs)
+          return std::signbit(Lhs) ? Lhs : Rhs;
+        return Lhs < Rhs ? Lhs : Rhs;
+      } /* End of 'Min' function */
+
+    /* WASM 'max' operation implementation function.
+     * ARGUMENTS:
+     *   - operands:
+     *       type Lhs, Rhs;
+     * RETURNS:
+     *   (type) Maximal operand (NaN if any operand is NaN, +0 is greater than -0);
+     */
+    template <typename type>
+      inline type Max( type Lhs, type Rhs ) noexcept
+      {
+        if (Lhs != Lhs || Rhs != Rhs)
+          return Lhs + Rhs;
+        if (Lhs == Rhs)
+          return std::signbit(Lhs) ? Rhs : Lhs;
+        return Lhs > Rhs ? Lhs : Rhs;
+      } /* End of 'Max' function */
+
+    /* Floating point to integer truncation validation function.
+     * ARGUMENTS:
+     *   - value to truncate:
+     *       from_type Value;
+     * RETURNS:
+     *   (BOOL) TRUE if truncated value is representable in integer type, FALSE otherwise;
+     */
+    template <typename to_type, typename from_type>
+      inline BOOL IsTruncatable( from_type Value ) noexcept
+      {
+        constexpr INT BIT_COUNT = std::numeric_limits<to_type>::digits + std::is_signed_v<to_type>;
+        const DOUBLE Double = static_cast<DOUBLE>(Value);
+
+        if (Double != Double)
+          return FALSE;
+
+        if constexpr (std::is_signed_v<to_type>)
+        {
+          if constexpr (BIT_COUNT == 64)
+            return Double >= -0x1p63 && Double < 0x1p63;
+          else
+            return Double > std::ldexp(-1.0, BIT_COUNT - 1) - 1.0 && Double < std::ldexp(1.0, BIT_COUNT - 1);
+        }
+        else
+          return Double > -1.0 && Double < std::ldexp(1.0, BIT_COUNT);
+      } /* End of 'IsTruncatable' function */
+
+    /* Stack value copying function (fixed size copies are used for common value sizes, as variable size 'memcpy' is way slower).
+     * ARGUMENTS:
+     *   - destination and source:
+     *       VOID *Dst;
+     *       const VOID *Src;
+     *   - value size:
+     *       SIZE_T Size;
+     * RETURNS: None.
+     */
+    inline VOID CopyValue( VOID *Dst, const VOID *Src, SIZE_T Size ) noexcept
+    {
+      switch (Size)
+      {
+      case 4  : std::memcpy(Dst, Src, 4);  break;
+      case 8  : std::memcpy(Dst, Src, 8);  break;
+      case 16 : std::memcpy(Dst, Src, 16); break;
+      default : std::memcpy(Dst, Src, Size);
+      }
+    } /* End of 'CopyValue' function */
+
+    /* Register bytecode frame slot reading function.
+     * ARGUMENTS:
+     *   - slot to read value from:
+     *       const UINT64 *Slot;
+     * RETURNS:
+     *   (type) Value stored in slot lower bytes;
+     */
+    template <typename type>
+      inline type ReadSlot( const UINT64 *Slot ) noexcept
+      {
+        type Value;
+
+        std::memcpy(&Value, Slot, sizeof(type));
+        return Value;
+      } /* End of 'ReadSlot' function */
+
+    /* Register bytecode frame slot writing function.
+     * ARGUMENTS:
+     *   - slot to write value to:
+     *       UINT64 *Slot;
+     *   - value:
+     *       type Value;
+     * RETURNS: None.
+     */
+    template <typename type>
+      inline VOID WriteSlot( UINT64 *Slot, type Value ) noexcept
+      {
+        std::memcpy(Slot, &Value, sizeof(type));
+      } /* End of 'WriteSlot' function */
+
+    /* Cached stack top value (stored in 64 bit host register) or evaluation stack slot reading function.
+     * ARGUMENTS:
+     *   - cached value bits:
+     *       UINT64 Bits;
+     * RETURNS:
+     *   (type) Value stored in lower bits;
+     */
+    template <typename type>
+      inline type FromCacheBits( UINT64 Bits ) noexcept
+      {
+        static_assert(sizeof(type) == 4 || sizeof(type) == 8, "Only 32 and 64 bit values may be cached");
+
+        if constexpr (sizeof(type) == 8)
+          return std::bit_cast<type>(Bits);
+        else
+          return std::bit_cast<type>(static_cast<UINT32>(Bits));
+      } /* End of 'FromCacheBits' function */
+
+    /* Cached stack top value (stored in 64 bit host register) or evaluation stack slot writing function.
+     * ARGUMENTS:
+     *   - value:
+     *       type Value;
+     * RETURNS:
+     *   (UINT64) Value bits (upper bits of 32 bit values are zero);
+     */
+    template <typename type>
+      inline UINT64 ToCacheBits( type Value ) noexcept
+      {
+        static_assert(sizeof(type) == 4 || sizeof(type) == 8, "Only 32 and 64 bit values may be cached");
+
+        if constexpr (sizeof(type) == 8)
+          return std::bit_cast<UINT64>(Value);
+        else
+          return std::bit_cast<UINT32>(Value);
+      } /* End of 'ToCacheBits' function */
+  } /* end of 'exec_util' namespace */
+
+  /* Resolved call site call frame pushing function (function arguments are consumed from evaluation stack).
+   * ARGUMENTS:
+   *   - call site to push frame of callee of:
+   *       const call_site &Site;
+   * RETURNS:
+   *   (BOOL) TRUE if frame is pushed, FALSE if call stack is exhausted;
+   */
+  inline BOOL instance_impl::PushCall( const call_site &Site )
+  {
+    const compiled_function_data *Function = Site.Callee;
+
+    CountCall(Site.FunctionIndex);
+
+    if (IsFrameOnEvaluationStack(*Function))
+    {
+      // Arguments become the first frame slots in place, so call only pushes zeroed slots of the rest locals.
+      // Space for function values is reserved once, so engine pushes them without capacity checks and frame isn't moved during function execution.
+      EvaluationStack.Reserve(Site.FrameSize + Function->MaxStackHeight * sizeof(UINT64));
+      std::memset(EvaluationStack.PushReserved<UINT8>(Site.FrameSize) - Site.FrameSize, 0, Site.FrameSize);
+
+      return CallStack.Push(call {
+        .FunctionIndex = Site.FunctionIndex,
+        .InstructionIndex = 0,
+        .LocalStackFrameSize = 0,
+        .EvaluationStackBase = EvaluationStack.Size(),
+      });
+    }
+
+    UINT64 *Frame = LocalStack.Push<UINT64>(Site.FrameSize) - Function->FrameSlotCount;
+
+    std::memset(Frame, 0, Site.FrameSize);
+    for (SIZE_T i = Function->ArgumentCount; i-- > 0; )
+      Frame[i] = *EvaluationStack.Pop<UINT64>(sizeof(UINT64));
+
+    return CallStack.Push(call {
+      .FunctionIndex = Site.FunctionIndex,
+      .InstructionIndex = 0,
+      .LocalStackFrameSize = Site.FrameSize,
+      .EvaluationStackBase = EvaluationStack.Size(),
+    });
+  } /* End of 'PushCall' function */
+
+  /* Resolved call site tail call frame pushing function (call stack top stack bytecode call is replaced by callee one,
+   * callee arguments are consumed from evaluation stack, the rest caller values are dropped).
+   * ARGUMENTS:
+   *   - call site to push frame of callee of:
+   *       const call_site &Site;
+   *   - caller frame (placed on evaluation stack):
+   *       UINT64 *Frame;
+   * RETURNS: None.
+   */
+  inline VOID instance_impl::PushTailCall( const call_site &Site, UINT64 *Frame )
+  {
+    const SIZE_T ArgumentCount = Site.Callee->ArgumentCount;
+    UINT64 *Top = EvaluationStack.Get<UINT64>();
+
+    // Arguments are moved to caller frame start, so callee frame takes caller frame place and stacks don't grow (push can't fail)
+    std::memmove(Frame, Top - ArgumentCount, ArgumentCount * sizeof(UINT64));
+    EvaluationStack.Pop((Top - Frame - ArgumentCount) * sizeof(UINT64));
+    CallStack.Pop();
+    PushCall(Site);
+  } /* End of 'PushTailCall' function */
+
+  /* Instruction immediate reading function.
+   * ARGUMENTS:
+   *   - first slot of immediate (immediate is split into 16 bit slots, lower half first):
+   *       const compiled_instruction *Slots;
+   * RETURNS:
+   *   (type) Immediate value;
+   */
+  template <typename type>
+    inline type ReadImmediate( const compiled_instruction *Slots ) noexcept
+    {
+      // Slots of immediate form its little-endian representation, so it's read by single (unaligned) load
+      if constexpr (std::endian::native == std::endian::little)
+      {
+        type Value;
+        std::memcpy(&Value, Slots, sizeof(type));
+        return Value;
+      }
+      else
+      {
+        type Value = 0;
+        for (SIZE_T i = 0; i < sizeof(type) / sizeof(UINT16); i++)
+          Value |= static_cast<type>(Slots[i].InstructionID) << i * 16;
+        return Value;
+      }
+    } /* End of 'ReadImmediate' function */
+
+  /* Register bytecode instruction length (in instruction slots, operands and immediates included) getting function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       compiled_instruction Instruction;
+   * RETURNS:
+   *   (SIZE_T) Count of slots occupied by instruction;
+   */
+  SIZE_T GetRegisterInstructionLength( compiled_instruction Instruction ) noexcept;
+} /* end of 'watap::impl::standard' namespace */
+
+/* Instruction immediate reading macros (immediates are stored in 16 bit instruction slots after instruction) */
+#define WATAP_STANDARD_IMM_U16(SLOT) (Code[Ip + (SLOT)].InstructionID)
+#define WATAP_STANDARD_IMM_U32(SLOT) (::watap::impl::standard::ReadImmediate<UINT32>(&Code[Ip + (SLOT)]))
+#define WATAP_STANDARD_IMM_U64(SLOT) (::watap::impl::standard::ReadImmediate<UINT64>(&Code[Ip + (SLOT)]))
+
+/* Next instruction (at 'Ip') dispatch macros, handler of next instruction may be passed if it's already known */
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+#  define WATAP_STANDARD_DISPATCH()                        \
+     {                                                     \
+       if constexpr (DISPATCH == dispatch_type::eThreaded) \
+         goto *Handlers[Ip];                               \
+       else                                                \
+         continue;                                         \
+     }
+#  define WATAP_STANDARD_DISPATCH_TO(HANDLER)              \
+     {                                                     \
+       if constexpr (DISPATCH == dispatch_type::eThreaded) \
+         goto *(HANDLER);                                  \
+       else                                                \
+         continue;                                         \
+     }
+#  define WATAP_STANDARD_OP(NAME) case static_cast<UINT8>(bin::instruction::NAME): L_##NAME:
+#  define WATAP_STANDARD_FUSED_OP(NAME) case static_cast<UINT8>(fused_instruction::NAME): L_##NAME:
+#  define WATAP_STANDARD_QUICKENED_OP(NAME) case static_cast<UINT8>(quickened_instruction::NAME): L_##NAME:
+#else // defined(WATAP_STANDARD_THREADED_DISPATCH)
+#  define WATAP_STANDARD_DISPATCH() continue
+#  define WATAP_STANDARD_DISPATCH_TO(HANDLER) continue
+#  define WATAP_STANDARD_OP(NAME) case static_cast<UINT8>(bin::instruction::NAME):
+#  define WATAP_STANDARD_FUSED_OP(NAME) case static_cast<UINT8>(fused_instruction::NAME):
+#  define WATAP_STANDARD_QUICKENED_OP(NAME) case static_cast<UINT8>(quickened_instruction::NAME):
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+/* Instruction pointer advance and next instruction dispatch macro */
+#define WATAP_STANDARD_NEXT(LENGTH) { Ip += (LENGTH); WATAP_STANDARD_DISPATCH(); }
+
+/* Execution trap macro */
+#define WATAP_STANDARD_TRAP() { Instance->Trap(); return FALSE; }
+
+/* Stack bytecode instruction length (compile time constant) getting macro */
+#define WATAP_STANDARD_STACK_LENGTH(NAME) (std::integral_constant<SIZE_T, GetCompiledInstructionLength(compiled_instruction { bin::instruction::NAME })>::value)
+
+/* Evaluation stack value popping and pushing macros (every value takes single 8 byte slot, upper bits of 32 bit value slot are zero,
+ * values are pushed to space, reserved by call, without capacity checks) */
+#define WATAP_STANDARD_STACK_POP(TYPE) (exec_util::FromCacheBits<TYPE>(*EvaluationStack.Pop<UINT64>(sizeof(UINT64))))
+#define WATAP_STANDARD_STACK_PUSH_SLOT(BITS) (EvaluationStack.PushReserved<UINT64>(sizeof(UINT64))[-1] = (BITS))
+#define WATAP_STANDARD_STACK_PUSH(TYPE, VALUE) WATAP_STANDARD_STACK_PUSH_SLOT(exec_util::ToCacheBits<TYPE>(static_cast<TYPE>(VALUE)))
+
+/* Stack bytecode branch implementation macro (label values are moved down to target label stack height, target handler is taken from branch target,
+ * backward branches are counted for tier-up, call leaves hot loop to its optimized code, as 'return' does, by on-stack replacement) */
+#define WATAP_STANDARD_STACK_BRANCH(TARGET)                                                              \
+{                                                                                                        \
+  const branch_target &Target = (TARGET);                                                                \
+  const BOOL IsBackEdge = Target.Ip <= Ip;                                                               \
+  if (Target.DropCount != 0)                                                                             \
+  {                                                                                                      \
+    UINT64 *Top = EvaluationStack.Pop<UINT64>(Target.DropCount * sizeof(UINT64));                       \
+    std::memmove(Top - Target.KeepCount, Top + Target.DropCount - Target.KeepCount,                      \
+      Target.KeepCount * sizeof(UINT64));                                                                \
+  }                                                                                                      \
+  Ip = Target.Ip;                                                                                        \
+  if (IsBackEdge)                                                                                        \
+    if (const native_entry OsrEntry = Instance->CountBackEdge(static_cast<UINT32>(&Target - Targets)))   \
+    {                                                                                                    \
+      if (!ExecuteOptimized(Instance, *Function, OsrEntry))                                              \
+        return FALSE;                                                                                    \
+      if (CallStack.Size() < RootDepth)                                                                  \
+        return TRUE;                                                                                     \
+      LoadState();                                                                                       \
+      WATAP_STANDARD_NEXT(0)                                                                             \
+    }                                                                                                    \
+  WATAP_STANDARD_DISPATCH_TO(Target.Handler);                                                            \
+}
+
+/* Cached stack bytecode instruction cache state (0 - nothing is cached, 1 - 32 bit value is cached, 2 - 64 bit value is cached) location in instruction data */
+#define WATAP_STANDARD_CACHE_STATE_SHIFT 6
+#define WATAP_STANDARD_CACHE_DATA_MASK   0x3F
+
+/* Cached stack bytecode handler index (by instruction and its cache state) getting macro */
+#define WATAP_STANDARD_CACHE_HANDLER_INDEX(INSTRUCTION) \
+  (static_cast<UINT32>((INSTRUCTION).Instruction) | static_cast<UINT32>((INSTRUCTION).InstructionData >> WATAP_STANDARD_CACHE_STATE_SHIFT) << 8)
+
+/* Handler table (labels of 'WATAP_STANDARD_OP' handlers) entry macro */
+#define WATAP_STANDARD_HANDLER_TABLE_ENTRY(NAME, ...) Table[static_cast<UINT8>(bin::instruction::NAME)] = &&L_##NAME;
+
+/* Handler table superinstruction (labels of 'WATAP_STANDARD_FUSED_OP' handlers) entry macro */
+#define WATAP_STANDARD_FUSED_HANDLER_TABLE_ENTRY(NAME, ...) Table[static_cast<UINT8>(fused_instruction::NAME)] = &&L_##NAME;
+
+/* Handler table quickened instruction (labels of 'WATAP_STANDARD_QUICKENED_OP' handlers) entry macro */
+#define WATAP_STANDARD_QUICKENED_HANDLER_TABLE_ENTRY(NAME) Table[static_cast<UINT8>(quickened_instruction::NAME)] = &&L_##NAME;
+
+/* Handler table declaration macro, table is exported by 'Execute*(nullptr, &Table)' call */
+#define WATAP_STANDARD_HANDLER_TABLE(LISTS)                                    \
+  static const std::array<const VOID *, 256> Table = ({                        \
+    std::array<const VOID *, 256> Table;                                       \
+    Table.fill(&&L_Invalid);                                                   \
+    LISTS                                                                      \
+    Table;                                                                     \
+  });                                                                          \
+  if (HandlerTable != nullptr)                                                 \
+  {                                                                            \
+    *HandlerTable = Table.data();                                              \
+    return TRUE;                                                               \
+  }
+
+/***
+ * Numeric instruction lists, shared by all bytecode formats.
+ * Entry format is X(INSTRUCTION, KIND, KIND_ARGUMENTS...), every engine defines its own implementation for each KIND.
+ ***/
+
+/* Instructions that consume one value and produce one value */
+#define WATAP_STANDARD_UNARY_INSTRUCTIONS(X)                            \
+  X(eI32Eqz         , EQZ      , UINT32)                                \
+  X(eI64Eqz         , EQZ      , UINT64)                                \
+  X(eI32Clz         , FN_UNARY , UINT32, std::countl_zero<UINT32>)      \
+  X(eI32Ctz         , FN_UNARY , UINT32, std::countr_zero<UINT32>)      \
+  X(eI32Popcnt      , FN_UNARY , UINT32, std::popcount<UINT32>)         \
+  X(eI64Clz         , FN_UNARY , UINT64, std::countl_zero<UINT64>)      \
+  X(eI64Ctz         , FN_UNARY , UINT64, std::countr_zero<UINT64>)      \
+  X(eI64Popcnt      , FN_UNARY , UINT64, std::popcount<UINT64>)         \
+  X(eF32Abs         , FN_UNARY , FLOAT32, std::abs)                     \
+  X(eF32Neg         , FN_UNARY , FLOAT32, -)                            \
+  X(eF32Ceil        , FN_UNARY , FLOAT32, std::ceil)                    \
+  X(eF32Floor       , FN_UNARY , FLOAT32, std::floor)                   \
+  X(eF32Trunc       , FN_UNARY , FLOAT32, std::trunc)                   \
+  X(eF32Nearest     , FN_UNARY , FLOAT32, std::nearbyint)               \
+  X(eF32Sqrt        , FN_UNARY , FLOAT32, std::sqrt)                    \
+  X(eF64Abs         , FN_UNARY , FLOAT64, std::abs)                     \
+  X(eF64Neg         , FN_UNARY , FLOAT64, -)                            \
+  X(eF64Ceil        , FN_UNARY , FLOAT64, std::ceil)                    \
+  X(eF64Floor       , FN_UNARY , FLOAT64, std::floor)                   \
+  X(eF64Trunc       , FN_UNARY , FLOAT64, std::trunc)                   \
+  X(eF64Nearest     , FN_UNARY , FLOAT64, std::nearbyint)               \
+  X(eF64Sqrt        , FN_UNARY , FLOAT64, std::sqrt)                    \
+  X(eI32WrapI64     , CAST     ,  UINT64,  UINT32)                      \
+  X(eI32TruncF32S   , TRUNC    , FLOAT32,   INT32)                      \
+  X(eI32TruncF32U   , TRUNC    , FLOAT32,  UINT32)                      \
+  X(eI32TruncF64S   , TRUNC    , FLOAT64,   INT32)                      \
+  X(eI32TruncF64U   , TRUNC    , FLOAT64,  UINT32)                      \
+  X(eI64ExtendI32S  , CAST     ,   INT32,   INT64)                      \
+  X(eI64ExtendI32U  , CAST     ,  UINT32,  UINT64)                      \
+  X(eI64TruncF32S   , TRUNC    , FLOAT32,   INT64)                      \
+  X(eI64TruncF32U   , TRUNC    , FLOAT32,  UINT64)                      \
+  X(eI64TruncF64S   , TRUNC    , FLOAT64,   INT64)                      \
+  X(eI64TruncF64U   , TRUNC    , FLOAT64,  UINT64)                      \
+  X(eF32ConvertI32S , CAST     ,   INT32, FLOAT32)                      \
+  X(eF32ConvertI32U , CAST     ,  UINT32, FLOAT32)                      \
+  X(eF32ConvertI64S , CAST     ,   INT64, FLOAT32)                      \
+  X(eF32ConvertI64U , CAST     ,  UINT64, FLOAT32)                      \
+  X(eF32DemoteF64   , CAST     , FLOAT64, FLOAT32)                      \
+  X(eF64ConvertI32S , CAST     ,   INT32, FLOAT64)                      \
+  X(eF64ConvertI32U , CAST     ,  UINT32, FLOAT64)                      \
+  X(eF64ConvertI64S , CAST     ,   INT64, FLOAT64)                      \
+  X(eF64ConvertI64U , CAST     ,  UINT64, FLOAT64)                      \
+  X(eF64PromoteF32  , CAST     , FLOAT32, FLOAT64)                      \
+  X(eI32Extend8S    , I_EXTEND ,   INT32,    INT8)                      \
+  X(eI32Extend16S   , I_EXTEND ,   INT32,   INT16)                      \
+  X(eI64Extend8S    , I_EXTEND ,   INT64,    INT8)                      \
+  X(eI64Extend16S   , I_EXTEND ,   INT64,   INT16)                      \
+  X(eI64Extend32S   , I_EXTEND ,   INT64,   INT32)                      \
+  X(eRefIsNull      , FN_UNARY ,  UINT32, 0 ==)
+
+/* Instructions that consume two values and produce one value */
+#define WATAP_STANDARD_BINARY_INSTRUCTIONS(X)                           \
+  X(eI32Eq          , COMPARE  ,  UINT32, ==)                           \
+  X(eI32Ne          , COMPARE  ,  UINT32, !=)                           \
+  X(eI32LtS         , COMPARE  ,   INT32, < )                           \
+  X(eI32LtU         , COMPARE  ,  UINT32, < )                           \
+  X(eI32GtS         , COMPARE  ,   INT32, > )                           \
+  X(eI32GtU         , COMPARE  ,  UINT32, > )                           \
+  X(eI32LeS         , COMPARE  ,   INT32, <=)                           \
+  X(eI32LeU         , COMPARE  ,  UINT32, <=)                           \
+  X(eI32GeS         , COMPARE  ,   INT32, >=)                           \
+  X(eI32GeU         , COMPARE  ,  UINT32, >=)                           \
+  X(eI64Eq          , COMPARE  ,  UINT64, ==)                           \
+  X(eI64Ne          , COMPARE  ,  UINT64, !=)                           \
+  X(eI64LtS         , COMPARE  ,   INT64, < )                           \
+  X(eI64LtU         , COMPARE  ,  UINT64, < )                           \
+  X(eI64GtS         , COMPARE  ,   INT64, > )                           \
+  X(eI64GtU         , COMPARE  ,  UINT64, > )                           \
+  X(eI64LeS         , COMPARE  ,   INT64, <=)                           \
+  X(eI64LeU         , COMPARE  ,  UINT64, <=)                           \
+  X(eI64GeS         , COMPARE  ,   INT64, >=)                           \
+  X(eI64GeU         , COMPARE  ,  UINT64, >=)                           \
+  X(eF32Eq          , COMPARE  , FLOAT32, ==)                           \
+  X(eF32Ne          , COMPARE  , FLOAT32, !=)                           \
+  X(eF32Lt          , COMPARE  , FLOAT32, < )                           \
+  X(eF32Gt          , COMPARE  , FLOAT32, > )                           \
+  X(eF32Le          , COMPARE  , FLOAT32, <=)                           \
+  X(eF32Ge          , COMPARE  , FLOAT32, >=)                           \
+  X(eF64Eq          , COMPARE  , FLOAT64, ==)                           \
+  X(eF64Ne          , COMPARE  , FLOAT64, !=)                           \
+  X(eF64Lt          , COMPARE  , FLOAT64, < )                           \
+  X(eF64Gt          , COMPARE  , FLOAT64, > )                           \
+  X(eF64Le          , COMPARE  , FLOAT64, <=)                           \
+  X(eF64Ge          , COMPARE  , FLOAT64, >=)                           \
+  X(eI32Add         , OP_BINARY,  UINT32, +)                            \
+  X(eI32Sub         , OP_BINARY,  UINT32, -)                            \
+  X(eI32Mul         , OP_BINARY,  UINT32, *)                            \
+  X(eI32DivS        , DIV_S    ,   INT32)                               \
+  X(eI32DivU        , DIV_U    ,  UINT32, /)                            \
+  X(eI32RemS        , REM_S    ,   INT32)                               \
+  X(eI32RemU        , DIV_U    ,  UINT32, %)                            \
+  X(eI32And         , OP_BINARY,  UINT32, &)                            \
+  X(eI32Or          , OP_BINARY,  UINT32, |)                            \
+  X(eI32Xor         , OP_BINARY,  UINT32, ^)                            \
+  X(eI32Shl         , SHIFT    ,  UINT32, <<)                           \
+  X(eI32ShrS        , SHIFT    ,   INT32, >>)                           \
+  X(eI32ShrU        , SHIFT    ,  UINT32, >>)                           \
+  X(eI32Rotl        , ROTATE   ,  UINT32, std::rotl)                    \
+  X(eI32Rotr        , ROTATE   ,  UINT32, std::rotr)                    \
+  X(eI64Add         , OP_BINARY,  UINT64, +)                            \
+  X(eI64Sub         , OP_BINARY,  UINT64, -)                            \
+  X(eI64Mul         , OP_BINARY,  UINT64, *)                            \
+  X(eI64DivS        , DIV_S    ,   INT64)                               \
+  X(eI64DivU        , DIV_U    ,  UINT64, /)                            \
+  X(eI64RemS        , REM_S    ,   INT64)                               \
+  X(eI64RemU        , DIV_U    ,  UINT64, %)                            \
+  X(eI64And         , OP_BINARY,  UINT64, &)                            \
+  X(eI64Or          , OP_BINARY,  UINT64, |)                            \
+  X(eI64Xor         , OP_BINARY,  UINT64, ^)                            \
+  X(eI64Shl         , SHIFT    ,  UINT64, <<)                           \
+  X(eI64ShrS        , SHIFT    ,   INT64, >>)                           \
+  X(eI64ShrU        , SHIFT    ,  UINT64, >>)                           \
+  X(eI64Rotl        , ROTATE   ,  UINT64, std::rotl)                    \
+  X(eI64Rotr        , ROTATE   ,  UINT64, std::rotr)                    \
+  X(eF32Add         , OP_BINARY, FLOAT32, +)                            \
+  X(eF32Sub         , OP_BINARY, FLOAT32, -)                            \
+  X(eF32Mul         , OP_BINARY, FLOAT32, *)                            \
+  X(eF32Div         , OP_BINARY, FLOAT32, /)                            \
+  X(eF32Min         , FN_BINARY, FLOAT32, exec_util::Min)               \
+  X(eF32Max         , FN_BINARY, FLOAT32, exec_util::Max)               \
+  X(eF32CopySign    , FN_BINARY, FLOAT32, std::copysign)                \
+  X(eF64Add         , OP_BINARY, FLOAT64, +)                            \
+  X(eF64Sub         , OP_BINARY, FLOAT64, -)                            \
+  X(eF64Mul         , OP_BINARY, FLOAT64, *)                            \
+  X(eF64Div         , OP_BINARY, FLOAT64, /)                            \
+  X(eF64Min         , FN_BINARY, FLOAT64, exec_util::Min)               \
+  X(eF64Max         , FN_BINARY, FLOAT64, exec_util::Max)               \
+  X(eF64CopySign    , FN_BINARY, FLOAT64, std::copysign)
+
+/* Memory loading instructions (address is consumed, loaded value is produced), KIND arguments are result and memory value types */
+#define WATAP_STANDARD_LOAD_INSTRUCTIONS(X)                             \
+  X(eI32Load        , LOAD     ,  UINT32,  UINT32)                      \
+  X(eI64Load        , LOAD     ,  UINT64,  UINT64)                      \
+  X(eF32Load        , LOAD     , FLOAT32, FLOAT32)                      \
+  X(eF64Load        , LOAD     , FLOAT64, FLOAT64)                      \
+  X(eI32Load8S      , LOAD     ,  UINT32,    INT8)                      \
+  X(eI32Load8U      , LOAD     ,  UINT32,   UINT8)                      \
+  X(eI32Load16S     , LOAD     ,  UINT32,   INT16)                      \
+  X(eI32Load16U     , LOAD     ,  UINT32,  UINT16)                      \
+  X(eI64Load8S      , LOAD     ,  UINT64,    INT8)                      \
+  X(eI64Load8U      , LOAD     ,  UINT64,   UINT8)                      \
+  X(eI64Load16S     , LOAD     ,  UINT64,   INT16)                      \
+  X(eI64Load16U     , LOAD     ,  UINT64,  UINT16)                      \
+  X(eI64Load32S     , LOAD     ,  UINT64,   INT32)                      \
+  X(eI64Load32U     , LOAD     ,  UINT64,  UINT32)
+
+/* Memory storing instructions (address and value are consumed), KIND arguments are value and memory value types */
+#define WATAP_STANDARD_STORE_INSTRUCTIONS(X)                            \
+  X(eI32Store       , STORE    ,  UINT32,  UINT32)                      \
+  X(eI64Store       , STORE    ,  UINT64,  UINT64)                      \
+  X(eF32Store       , STORE    ,  UINT32,  UINT32)                      \
+  X(eF64Store       , STORE    ,  UINT64,  UINT64)                      \
+  X(eI32Store8      , STORE    ,  UINT32,   UINT8)                      \
+  X(eI32Store16     , STORE    ,  UINT32,  UINT16)                      \
+  X(eI64Store8      , STORE    ,  UINT64,   UINT8)                      \
+  X(eI64Store16     , STORE    ,  UINT64,  UINT16)                      \
+  X(eI64Store32     , STORE    ,  UINT64,  UINT32)
+
+/* Stack bytecode instructions without control transfer (they may be superinstruction parts) */
+#define WATAP_STANDARD_STACK_SIMPLE_INSTRUCTIONS(X)                     \
+  X(eNop            , NOP        )                                      \
+  X(eDrop           , DROP       )                                      \
+  X(eSelect         , SELECT     )                                      \
+  X(eLocalGet       , LOCAL_GET  )                                      \
+  X(eLocalSet       , LOCAL_SET  )                                      \
+  X(eLocalTee       , LOCAL_TEE  )                                      \
+  X(eMemorySize     , MEMORY_SIZE)                                      \
+  X(eMemoryGrow     , MEMORY_GROW)                                      \
+  X(eI32Const       , CONST      ,  UINT32, 32)                         \
+  X(eI64Const       , CONST      ,  UINT64, 64)                         \
+  X(eF32Const       , CONST      ,  UINT32, 32)                         \
+  X(eF64Const       , CONST      ,  UINT64, 64)                         \
+  X(eRefNull        , REF_NULL   )                                      \
+  X(eRefFunc        , REF_FUNC   )
+
+/* All numeric and memory access instructions */
+#define WATAP_STANDARD_NUMERIC_INSTRUCTIONS(X) \
+  WATAP_STANDARD_UNARY_INSTRUCTIONS(X)         \
+  WATAP_STANDARD_BINARY_INSTRUCTIONS(X)        \
+  WATAP_STANDARD_LOAD_INSTRUCTIONS(X)          \
+  WATAP_STANDARD_STORE_INSTRUCTIONS(X)
+
+#endif // !defined(__watap_impl_standard_exec_h_)
+
+/* END OF 'watap_impl_standard_exec.h' FILE */
@@ -0,0 +1,189 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_interface.h"
+#include "watap_impl_standard_exec.h"
+
+#include <algorithm>
+
+/***
+ * Superinstructions.
+ *
+ * Superinstruction executes a sequence of 2 or 3 stack bytecode instructions with single dispatch.
+ * Fusion rewrites opcode of the first sequence instruction only, so code layout isn't changed and
+ * the rest of sequence may be still executed separately (e.g. if it's jumped to).
+ *
+ * Superinstruction set is stored in 'watap_impl_standard_fusion_table.h' file, which is generated by
+ * 'WriteFusionTable' from statistics, recorded by sources with 'settings::FusionStatistics' set.
+ * Any stack bytecode instruction without control transfer may be superinstruction part.
+ ***/
+
+/* Opcode range, available for superinstructions (unused by WASM itself) */
+#define WATAP_STANDARD_FUSED_OPCODE_FIRST 0xD3
+#define WATAP_STANDARD_FUSED_OPCODE_LAST  0xFB
+
+/* Fusion table sequence entry macros */
+#define WATAP_STANDARD_FUSED_PAIR_SEQUENCE(NAME, CODE, FIRST, SECOND) \
+  fused_sequence { fused_instruction::NAME, 2, { WATAP_STANDARD_FUSED_FIRST_PART FIRST, WATAP_STANDARD_FUSED_FIRST_PART SECOND } },
+#define WATAP_STANDARD_FUSED_TRIPLE_SEQUENCE(NAME, CODE, FIRST, SECOND, THIRD) \
+  fused_sequence { fused_instruction::NAME, 3, { WATAP_STANDARD_FUSED_FIRST_PART FIRST, WATAP_STANDARD_FUSED_FIRST_PART SECOND, WATAP_STANDARD_FUSED_FIRST_PART THIRD } },
+
+/* Superinstruction part descriptor (fusion table part text) entry macro */
+#define WATAP_STANDARD_FUSED_PART_DESCRIPTOR(NAME, ...) Descriptors[static_cast<UINT8>(bin::instruction::NAME)] = #NAME ", " #__VA_ARGS__;
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* Superinstruction instruction sequence representation structure */
+  struct fused_sequence
+  {
+    fused_instruction Instruction;         // Superinstruction
+    SIZE_T PartCount;                      // Count of instructions in sequence
+    std::array<bin::instruction, 3> Parts; // Instruction sequence
+  }; /* End of 'fused_sequence' structure */
+
+  /* Superinstruction sequences (longer sequences first, so they are preferred) */
+  static const std::vector<fused_sequence> FusedSequences
+  {
+    WATAP_STANDARD_FUSED_TRIPLES(WATAP_STANDARD_FUSED_TRIPLE_SEQUENCE)
+    WATAP_STANDARD_FUSED_PAIRS(WATAP_STANDARD_FUSED_PAIR_SEQUENCE)
+  };
+
+  /* Stack bytecode instruction sequence statistics recording function.
+   * ARGUMENTS:
+   *   - function to record sequences of (stack bytecode, not fused):
+   *       const compiled_function_data &Function;
+   * RETURNS: None.
+   */
+  VOID source_impl::RecordFusionStatistics( const compiled_function_data &Function ) const
+  {
+    const std::vector<compiled_instruction> &Code = Function.Instructions;
+    std::vector<UINT8> Sequence;
+
+    for (SIZE_T Ip = 0; Ip < Code.size(); Ip += GetCompiledInstructionLength(Code[Ip]))
+    {
+      Sequence.clear();
+      for (SIZE_T PartIp = Ip; PartIp < Code.size() && Sequence.size() < 3; PartIp += GetCompiledInstructionLength(Code[PartIp]))
+      {
+        Sequence.push_back(static_cast<UINT8>(Code[PartIp].Instruction));
+        if (Sequence.size() >= 2)
+          FusionStatistics->SequenceCounts[Sequence]++;
+      }
+    }
+  } /* End of 'RecordFusionStatistics' function */
+
+  /* Stack bytecode superinstruction fusion function.
+   * ARGUMENTS:
+   *   - function to fuse instruction sequences of (validated stack bytecode, linking isn't required):
+   *       compiled_function_data &Function;
+   * RETURNS:
+   *   (SIZE_T) Count of superinstructions emitted;
+   */
+  SIZE_T source_impl::Fuse( compiled_function_data &Function ) const
+  {
+    std::vector<compiled_instruction> &Code = Function.Instructions;
+    SIZE_T FusedCount = 0;
+
+    for (SIZE_T Ip = 0; Ip < Code.size(); )
+    {
+      SIZE_T SequenceLength = GetCompiledInstructionLength(Code[Ip]);
+
+      for (const fused_sequence &Sequence : FusedSequences)
+      {
+        SIZE_T PartIp = Ip;
+        SIZE_T Part = 0;
+
+        while (Part < Sequence.PartCount && PartIp < Code.size() && Code[PartIp].Instruction == Sequence.Parts[Part])
+          PartIp += GetCompiledInstructionLength(Code[PartIp]), Part++;
+
+        if (Part == Sequence.PartCount)
+        {
+          Code[Ip].Instruction = static_cast<bin::instruction>(Sequence.Instruction);
+          SequenceLength = PartIp - Ip;
+          FusedCount++;
+          break;
+        }
+      }
+
+      Ip += SequenceLength;
+    }
+
+    return FusedCount;
+  } /* End of 'Fuse' function */
+
+  /* Superinstruction table generation function.
+   * ARGUMENTS:
+   *   - stream to write table ('watap_impl_standard_fusion_table.h' file contents) to:
+   *       std::ostream &Stream;
+   *   - recorded instruction sequence statistics:
+   *       const fusion_statistics &Statistics;
+   * RETURNS: None.
+   */
+  VOID WriteFusionTable( std::ostream &Stream, const fusion_statistics &Statistics )
+  {
+    // Table parts are instruction list entries of instructions that may be fused
+    std::array<std::string, 256> Descriptors;
+    WATAP_STANDARD_STACK_SIMPLE_INSTRUCTIONS(WATAP_STANDARD_FUSED_PART_DESCRIPTOR)
+    WATAP_STANDARD_NUMERIC_INSTRUCTIONS(WATAP_STANDARD_FUSED_PART_DESCRIPTOR)
+
+    for (std::string &Descriptor : Descriptors)
+    {
+      // Normalize list entry spacing
+      std::string Normalized;
+      for (CHAR C : Descriptor)
+        if (C != ' ' || (!Normalized.empty() && Normalized.back() != ' '))
+          Normalized.push_back(C);
+      while (!Normalized.empty() && Normalized.back() == ' ')
+        Normalized.pop_back();
+      for (SIZE_T Position; (Position = Normalized.find(" ,")) != std::string::npos; )
+        Normalized.erase(Position, 1);
+      Descriptor = std::move(Normalized);
+    }
+
+    // Sequences are ranked by count of dispatches they save
+    std::vector<std::pair<UINT64, const std::vector<UINT8> *>> Candidates;
+    for (const auto &[Sequence, Count] : Statistics.SequenceCounts)
+      if (std::ranges::all_of(Sequence, [&]( UINT8 Opcode ) { return !Descriptors[Opcode].empty(); }))
+        Candidates.push_back({Count * (Sequence.size() - 1), &Sequence});
+    std::ranges::stable_sort(Candidates, std::greater {}, [](const auto &Candidate) { return Candidate.first; });
+    if (Candidates.size() > WATAP_STANDARD_FUSED_OPCODE_LAST - WATAP_STANDARD_FUSED_OPCODE_FIRST + 1)
+      Candidates.resize(WATAP_STANDARD_FUSED_OPCODE_LAST - WATAP_STANDARD_FUSED_OPCODE_FIRST + 1);
+
+    // Opcodes are assigned to pairs first, then to triples
+    std::ranges::stable_sort(Candidates, std::less {}, [](const auto &Candidate) { return Candidate.second->size(); });
+
+    std::string Lists[2];
+    UINT32 Opcode = WATAP_STANDARD_FUSED_OPCODE_FIRST;
+
+    for (const auto &[Saved, Sequence] : Candidates)
+    {
+      std::string Name = "eFused", Parts;
+
+      for (UINT8 Part : *Sequence)
+      {
+        const std::string &Descriptor = Descriptors[Part];
+
+        Name += Descriptor.substr(1, Descriptor.find(',') - 1);
+        Parts += std::format(", ({})", Descriptor);
+      }
+      Lists[Sequence->size() - 2] += std::format(" \\\n  X({}, 0x{:02X}{}) /* Saves {} dispatches */", Name, Opcode++, Parts, Saved);
+    }
+
+    Stream <<
+      "/* Superinstruction table, generated by 'WriteFusionTable' from recorded instruction sequence statistics. */\n"
+      "\n"
+      "#ifndef __watap_impl_standard_fusion_table_h_\n"
+      "#define __watap_impl_standard_fusion_table_h_\n"
+      "\n"
+      "/* Fused instruction pairs, entry format is X(NAME, OPCODE, FIRST, SECOND), every part is '(INSTRUCTION, KIND, KIND_ARGUMENTS...)' */\n"
+      "#define WATAP_STANDARD_FUSED_PAIRS(X)" << Lists[0] << "\n"
+      "\n"
+      "/* Fused instruction triples, entry format is X(NAME, OPCODE, FIRST, SECOND, THIRD) */\n"
+      "#define WATAP_STANDARD_FUSED_TRIPLES(X)" << Lists[1] << "\n"
+      "\n"
+      "#endif // !defined(__watap_impl_standard_fusion_table_h_)\n"
+      "\n"
+      "/* END OF 'watap_impl_standard_fusion_table.h' FILE */\n";
+  } /* End of 'WriteFusionTable' function */
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_fusion.cpp' FILE */
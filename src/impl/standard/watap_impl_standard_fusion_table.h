@@ -0,0 +1,55 @@
+/* Superinstruction table, generated by 'WriteFusionTable' from recorded instruction sequence statistics. */
+
+#ifndef __watap_impl_standard_fusion_table_h_
+#define __watap_impl_standard_fusion_table_h_
+
+/* Fused instruction pairs, entry format is X(NAME, OPCODE, FIRST, SECOND), every part is '(INSTRUCTION, KIND, KIND_ARGUMENTS...)' */
+#define WATAP_STANDARD_FUSED_PAIRS(X) \
+  X(eFusedLocalGetLocalGet, 0xD3, (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET)) /* Saves 27 dispatches */ \
+  X(eFusedLocalSetLocalGet, 0xD4, (eLocalSet, LOCAL_SET), (eLocalGet, LOCAL_GET)) /* Saves 13 dispatches */ \
+  X(eFusedLocalGetF32Load, 0xD5, (eLocalGet, LOCAL_GET), (eF32Load, LOAD, FLOAT32, FLOAT32)) /* Saves 8 dispatches */ \
+  X(eFusedLocalGetI32Load, 0xD6, (eLocalGet, LOCAL_GET), (eI32Load, LOAD, UINT32, UINT32)) /* Saves 7 dispatches */ \
+  X(eFusedLocalGetI32Const, 0xD7, (eLocalGet, LOCAL_GET), (eI32Const, CONST, UINT32, 32)) /* Saves 7 dispatches */ \
+  X(eFusedF32MulF32Add, 0xD8, (eF32Mul, OP_BINARY, FLOAT32, *), (eF32Add, OP_BINARY, FLOAT32, +)) /* Saves 7 dispatches */ \
+  X(eFusedLocalGetF32Mul, 0xD9, (eLocalGet, LOCAL_GET), (eF32Mul, OP_BINARY, FLOAT32, *)) /* Saves 6 dispatches */ \
+  X(eFusedI32StoreLocalGet, 0xDA, (eI32Store, STORE, UINT32, UINT32), (eLocalGet, LOCAL_GET)) /* Saves 6 dispatches */ \
+  X(eFusedLocalGetI64Load, 0xDB, (eLocalGet, LOCAL_GET), (eI64Load, LOAD, UINT64, UINT64)) /* Saves 4 dispatches */ \
+  X(eFusedI32LoadI32Store, 0xDC, (eI32Load, LOAD, UINT32, UINT32), (eI32Store, STORE, UINT32, UINT32)) /* Saves 4 dispatches */ \
+  X(eFusedI64LoadI64Add, 0xDD, (eI64Load, LOAD, UINT64, UINT64), (eI64Add, OP_BINARY, UINT64, +)) /* Saves 4 dispatches */ \
+  X(eFusedF32LoadLocalGet, 0xDE, (eF32Load, LOAD, FLOAT32, FLOAT32), (eLocalGet, LOCAL_GET)) /* Saves 4 dispatches */ \
+  X(eFusedF32LoadF32Mul, 0xDF, (eF32Load, LOAD, FLOAT32, FLOAT32), (eF32Mul, OP_BINARY, FLOAT32, *)) /* Saves 4 dispatches */ \
+  X(eFusedI64AddLocalSet, 0xE0, (eI64Add, OP_BINARY, UINT64, +), (eLocalSet, LOCAL_SET)) /* Saves 4 dispatches */
+
+/* Fused instruction triples, entry format is X(NAME, OPCODE, FIRST, SECOND, THIRD) */
+#define WATAP_STANDARD_FUSED_TRIPLES(X) \
+  X(eFusedLocalSetLocalGetLocalGet, 0xE1, (eLocalSet, LOCAL_SET), (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET)) /* Saves 16 dispatches */ \
+  X(eFusedLocalGetLocalGetF32Mul, 0xE2, (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET), (eF32Mul, OP_BINARY, FLOAT32, *)) /* Saves 12 dispatches */ \
+  X(eFusedLocalGetLocalGetLocalGet, 0xE3, (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET)) /* Saves 10 dispatches */ \
+  X(eFusedLocalGetLocalGetI32Load, 0xE4, (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET), (eI32Load, LOAD, UINT32, UINT32)) /* Saves 8 dispatches */ \
+  X(eFusedLocalGetLocalGetI64Load, 0xE5, (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET), (eI64Load, LOAD, UINT64, UINT64)) /* Saves 8 dispatches */ \
+  X(eFusedLocalGetI32LoadI32Store, 0xE6, (eLocalGet, LOCAL_GET), (eI32Load, LOAD, UINT32, UINT32), (eI32Store, STORE, UINT32, UINT32)) /* Saves 8 dispatches */ \
+  X(eFusedLocalGetI64LoadI64Add, 0xE7, (eLocalGet, LOCAL_GET), (eI64Load, LOAD, UINT64, UINT64), (eI64Add, OP_BINARY, UINT64, +)) /* Saves 8 dispatches */ \
+  X(eFusedLocalGetF32LoadLocalGet, 0xE8, (eLocalGet, LOCAL_GET), (eF32Load, LOAD, FLOAT32, FLOAT32), (eLocalGet, LOCAL_GET)) /* Saves 8 dispatches */ \
+  X(eFusedLocalGetF32LoadF32Mul, 0xE9, (eLocalGet, LOCAL_GET), (eF32Load, LOAD, FLOAT32, FLOAT32), (eF32Mul, OP_BINARY, FLOAT32, *)) /* Saves 8 dispatches */ \
+  X(eFusedLocalGetF32MulF32Add, 0xEA, (eLocalGet, LOCAL_GET), (eF32Mul, OP_BINARY, FLOAT32, *), (eF32Add, OP_BINARY, FLOAT32, +)) /* Saves 8 dispatches */ \
+  X(eFusedI32LoadI32StoreLocalGet, 0xEB, (eI32Load, LOAD, UINT32, UINT32), (eI32Store, STORE, UINT32, UINT32), (eLocalGet, LOCAL_GET)) /* Saves 8 dispatches */ \
+  X(eFusedI64LoadI64AddLocalSet, 0xEC, (eI64Load, LOAD, UINT64, UINT64), (eI64Add, OP_BINARY, UINT64, +), (eLocalSet, LOCAL_SET)) /* Saves 8 dispatches */ \
+  X(eFusedF32LoadLocalGetF32Load, 0xED, (eF32Load, LOAD, FLOAT32, FLOAT32), (eLocalGet, LOCAL_GET), (eF32Load, LOAD, FLOAT32, FLOAT32)) /* Saves 8 dispatches */ \
+  X(eFusedI64AddLocalSetLocalGet, 0xEE, (eI64Add, OP_BINARY, UINT64, +), (eLocalSet, LOCAL_SET), (eLocalGet, LOCAL_GET)) /* Saves 8 dispatches */ \
+  X(eFusedF32MulF32AddLocalGet, 0xEF, (eF32Mul, OP_BINARY, FLOAT32, *), (eF32Add, OP_BINARY, FLOAT32, +), (eLocalGet, LOCAL_GET)) /* Saves 8 dispatches */ \
+  X(eFusedLocalGetI32ConstI32Mul, 0xF0, (eLocalGet, LOCAL_GET), (eI32Const, CONST, UINT32, 32), (eI32Mul, OP_BINARY, UINT32, *)) /* Saves 6 dispatches */ \
+  X(eFusedLocalSetLocalGetI32Const, 0xF1, (eLocalSet, LOCAL_SET), (eLocalGet, LOCAL_GET), (eI32Const, CONST, UINT32, 32)) /* Saves 6 dispatches */ \
+  X(eFusedF32LoadF32MulF32Add, 0xF2, (eF32Load, LOAD, FLOAT32, FLOAT32), (eF32Mul, OP_BINARY, FLOAT32, *), (eF32Add, OP_BINARY, FLOAT32, +)) /* Saves 6 dispatches */ \
+  X(eFusedI32StoreLocalGetLocalGet, 0xF3, (eI32Store, STORE, UINT32, UINT32), (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET)) /* Saves 6 dispatches */ \
+  X(eFusedI32MulLocalSetLocalGet, 0xF4, (eI32Mul, OP_BINARY, UINT32, *), (eLocalSet, LOCAL_SET), (eLocalGet, LOCAL_GET)) /* Saves 6 dispatches */ \
+  X(eFusedLocalGetLocalGetI32Const, 0xF5, (eLocalGet, LOCAL_GET), (eLocalGet, LOCAL_GET), (eI32Const, CONST, UINT32, 32)) /* Saves 4 dispatches */ \
+  X(eFusedLocalGetI32ConstI32ShrU, 0xF6, (eLocalGet, LOCAL_GET), (eI32Const, CONST, UINT32, 32), (eI32ShrU, SHIFT, UINT32, >>)) /* Saves 4 dispatches */ \
+  X(eFusedLocalGetF32MulLocalGet, 0xF7, (eLocalGet, LOCAL_GET), (eF32Mul, OP_BINARY, FLOAT32, *), (eLocalGet, LOCAL_GET)) /* Saves 4 dispatches */ \
+  X(eFusedI32ConstI32MulLocalSet, 0xF8, (eI32Const, CONST, UINT32, 32), (eI32Mul, OP_BINARY, UINT32, *), (eLocalSet, LOCAL_SET)) /* Saves 4 dispatches */ \
+  X(eFusedI32ConstI32ShrULocalGet, 0xF9, (eI32Const, CONST, UINT32, 32), (eI32ShrU, SHIFT, UINT32, >>), (eLocalGet, LOCAL_GET)) /* Saves 4 dispatches */ \
+  X(eFusedI32AddLocalSetLocalGet, 0xFA, (eI32Add, OP_BINARY, UINT32, +), (eLocalSet, LOCAL_SET), (eLocalGet, LOCAL_GET)) /* Saves 4 dispatches */ \
+  X(eFusedI32ShrULocalGetI32Xor, 0xFB, (eI32ShrU, SHIFT, UINT32, >>), (eLocalGet, LOCAL_GET), (eI32Xor, OP_BINARY, UINT32, ^)) /* Saves 4 dispatches */
+
+#endif // !defined(__watap_impl_standard_fusion_table_h_)
+
+/* END OF 'watap_impl_standard_fusion_table.h' FILE */
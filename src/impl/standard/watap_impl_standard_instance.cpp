@@ -0,0 +1,728 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_interface.h"
+#include "watap_impl_standard_exec.h"
+
+#include <algorithm>
+
+/***
+ * Stack bytecode instruction implementations (by 'WATAP_STANDARD_*_INSTRUCTIONS' list KIND)
+ ***/
+
+/* Binary operation operands getting macro (result is written to left operand slot) */
+#define WATAP_STANDARD_STACK_OPERANDS(TYPE) \
+  const TYPE Rhs = WATAP_STANDARD_STACK_POP(TYPE); UINT64 *Slot = EvaluationStack.Get<UINT64>() - 1; const TYPE Lhs = exec_util::FromCacheBits<TYPE>(*Slot);
+
+/* Unary operation operand getting macro (result is written to operand slot) */
+#define WATAP_STANDARD_STACK_OPERAND(TYPE) \
+  UINT64 *Slot = EvaluationStack.Get<UINT64>() - 1; const TYPE Value = exec_util::FromCacheBits<TYPE>(*Slot);
+
+/* Operation result writing macro */
+#define WATAP_STANDARD_STACK_SET(TYPE, VALUE) (*Slot = exec_util::ToCacheBits<TYPE>(static_cast<TYPE>(VALUE)))
+
+/* Evaluation binary operator and function implementation generation macros */
+#define WATAP_STANDARD_STACK_OP_BINARY(TYPE, OP) { WATAP_STANDARD_STACK_OPERANDS(TYPE) WATAP_STANDARD_STACK_SET(TYPE, Lhs OP Rhs); }
+#define WATAP_STANDARD_STACK_FN_BINARY(TYPE, FN) { WATAP_STANDARD_STACK_OPERANDS(TYPE) WATAP_STANDARD_STACK_SET(TYPE, FN(Lhs, Rhs)); }
+
+/* Evaluation shift and rotation implementation generation macros (shift count is taken by module of bit count) */
+#define WATAP_STANDARD_STACK_SHIFT(TYPE, OP) { WATAP_STANDARD_STACK_OPERANDS(TYPE) WATAP_STANDARD_STACK_SET(TYPE, Lhs OP (Rhs & (sizeof(TYPE) * 8 - 1))); }
+#define WATAP_STANDARD_STACK_ROTATE(TYPE, FN) { WATAP_STANDARD_STACK_OPERANDS(TYPE) WATAP_STANDARD_STACK_SET(TYPE, FN(Lhs, static_cast<INT>(Rhs & (sizeof(TYPE) * 8 - 1)))); }
+
+/* Evaluation comparison operator implementation generation macro */
+#define WATAP_STANDARD_STACK_COMPARE(TYPE, OP) { WATAP_STANDARD_STACK_OPERANDS(TYPE) WATAP_STANDARD_STACK_SET(UINT32, Lhs OP Rhs); }
+
+/* Evaluation signed division implementation generation macro (traps on zero division and overflow) */
+#define WATAP_STANDARD_STACK_DIV_S(TYPE)                                              \
+{                                                                                     \
+  WATAP_STANDARD_STACK_OPERANDS(TYPE)                                                 \
+  if (Rhs == 0 || (Rhs == -1 && Lhs == std::numeric_limits<TYPE>::min()))             \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_STACK_SET(TYPE, Lhs / Rhs);                                          \
+}
+
+/* Evaluation signed remainder implementation generation macro (traps on zero division) */
+#define WATAP_STANDARD_STACK_REM_S(TYPE)                                              \
+{                                                                                     \
+  WATAP_STANDARD_STACK_OPERANDS(TYPE)                                                 \
+  if (Rhs == 0)                                                                       \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_STACK_SET(TYPE, Rhs == -1 ? 0 : Lhs % Rhs);                          \
+}
+
+/* Evaluation unsigned division/remainder implementation generation macro (traps on zero division) */
+#define WATAP_STANDARD_STACK_DIV_U(TYPE, OP)                                          \
+{                                                                                     \
+  WATAP_STANDARD_STACK_OPERANDS(TYPE)                                                 \
+  if (Rhs == 0)                                                                       \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_STACK_SET(TYPE, Lhs OP Rhs);                                         \
+}
+
+/* Evaluation unary function, 'equal to zero', integer extend and conversion implementation generation macros */
+#define WATAP_STANDARD_STACK_FN_UNARY(TYPE, FN) { WATAP_STANDARD_STACK_OPERAND(TYPE) WATAP_STANDARD_STACK_SET(TYPE, FN(Value)); }
+#define WATAP_STANDARD_STACK_EQZ(TYPE) { WATAP_STANDARD_STACK_OPERAND(TYPE) WATAP_STANDARD_STACK_SET(UINT32, Value == 0); }
+#define WATAP_STANDARD_STACK_I_EXTEND(BASE, SUB) { WATAP_STANDARD_STACK_OPERAND(BASE) WATAP_STANDARD_STACK_SET(BASE, static_cast<SUB>(Value)); }
+#define WATAP_STANDARD_STACK_CAST(FROM, TO) { WATAP_STANDARD_STACK_OPERAND(FROM) WATAP_STANDARD_STACK_SET(TO, Value); }
+
+/* Floating point to integer truncation implementation generation macro (traps on unrepresentable result) */
+#define WATAP_STANDARD_STACK_TRUNC(FROM, TO)                                                             \
+{                                                                                                        \
+  WATAP_STANDARD_STACK_OPERAND(FROM)                                                                     \
+  if (!exec_util::IsTruncatable<TO>(Value))                                                              \
+    WATAP_STANDARD_TRAP();                                                                               \
+  WATAP_STANDARD_STACK_SET(TO, Value);                                                                   \
+}
+
+/* Heap loading with builtin conversion implementaion function (loaded value replaces address) */
+#define WATAP_STANDARD_STACK_LOAD(TYPE, FROM)                                                             \
+{                                                                                                         \
+  WATAP_STANDARD_STACK_OPERAND(UINT32)                                                                    \
+  const UINT64 Address = static_cast<UINT64>(Value) + WATAP_STANDARD_IMM_U32(1);                          \
+  if (Address + sizeof(FROM) > Heap.Size())                                                               \
+    WATAP_STANDARD_TRAP();                                                                                \
+  FROM Loaded;                                                                                            \
+  std::memcpy(&Loaded, Heap.Data() + Address, sizeof(FROM));                                              \
+  WATAP_STANDARD_STACK_SET(TYPE, Loaded);                                                                 \
+}
+
+/* Heap storing with builtin conversion implementaion function */
+#define WATAP_STANDARD_STACK_STORE(TYPE, TO)                                                              \
+{                                                                                                         \
+  const TO Value = static_cast<TO>(WATAP_STANDARD_STACK_POP(TYPE));                                       \
+  const UINT64 Address = static_cast<UINT64>(WATAP_STANDARD_STACK_POP(UINT32)) + WATAP_STANDARD_IMM_U32(1); \
+  if (Address + sizeof(TO) > Heap.Size())                                                                 \
+    WATAP_STANDARD_TRAP();                                                                                \
+  std::memcpy(Heap.Data() + Address, &Value, sizeof(TO));                                                 \
+}
+
+/* Nop implementation macro */
+#define WATAP_STANDARD_STACK_NOP() {}
+
+/* Value dropping implementation macro */
+#define WATAP_STANDARD_STACK_DROP() { EvaluationStack.Pop(sizeof(UINT64)); }
+
+/* Value selection implementation macro (whole slot is selected) */
+#define WATAP_STANDARD_STACK_SELECT()                                                                    \
+{                                                                                                        \
+  const UINT32 Condition = WATAP_STANDARD_STACK_POP(UINT32);                                             \
+  UINT64 *Rhs = EvaluationStack.Pop<UINT64>(sizeof(UINT64));                                             \
+  if (Condition == 0)                                                                                    \
+    Rhs[-1] = *Rhs;                                                                                      \
+}
+
+/* Local variable access implementation macros (whole 8 byte local slot is copied) */
+#define WATAP_STANDARD_STACK_LOCAL_GET() { WATAP_STANDARD_STACK_PUSH_SLOT(Frame[WATAP_STANDARD_IMM_U16(1)]); }
+#define WATAP_STANDARD_STACK_LOCAL_SET() { Frame[WATAP_STANDARD_IMM_U16(1)] = *EvaluationStack.Pop<UINT64>(sizeof(UINT64)); }
+#define WATAP_STANDARD_STACK_LOCAL_TEE() { Frame[WATAP_STANDARD_IMM_U16(1)] = EvaluationStack.Get<UINT64>()[-1]; }
+
+/* Memory size query and growing implementation macros */
+#define WATAP_STANDARD_STACK_MEMORY_SIZE() { WATAP_STANDARD_STACK_PUSH(UINT32, Heap.Size() / 65536); }
+#define WATAP_STANDARD_STACK_MEMORY_GROW() { WATAP_STANDARD_STACK_OPERAND(UINT32) WATAP_STANDARD_STACK_SET(UINT32, Instance->GrowMemory(Value)); }
+
+/* Constant implementation macro (floating point constants are pushed by bit pattern) */
+#define WATAP_STANDARD_STACK_CONST(TYPE, BITS) { WATAP_STANDARD_STACK_PUSH_SLOT(WATAP_STANDARD_IMM_U##BITS(1)); }
+
+/* Reference implementation macros (references are function index plus one, null reference is zero) */
+#define WATAP_STANDARD_STACK_REF_NULL() { WATAP_STANDARD_STACK_PUSH(UINT32, 0); }
+#define WATAP_STANDARD_STACK_REF_FUNC() { WATAP_STANDARD_STACK_PUSH(UINT32, WATAP_STANDARD_IMM_U32(1) + 1); }
+
+/* Stack bytecode instruction list entry implementation macro */
+#define WATAP_STANDARD_STACK_INSTRUCTION(NAME, KIND, ...) \
+  WATAP_STANDARD_OP(NAME) WATAP_STANDARD_STACK_##KIND(__VA_ARGS__) WATAP_STANDARD_NEXT(WATAP_STANDARD_STACK_LENGTH(NAME))
+
+/* Superinstruction part implementation macro (instruction pointer is moved to next part) */
+#define WATAP_STANDARD_STACK_FUSED_PART(NAME, KIND, ...) WATAP_STANDARD_STACK_##KIND(__VA_ARGS__) Ip += WATAP_STANDARD_STACK_LENGTH(NAME);
+
+/* Superinstruction list entry implementation macros */
+#define WATAP_STANDARD_STACK_FUSED_PAIR(NAME, CODE, FIRST, SECOND) \
+  WATAP_STANDARD_FUSED_OP(NAME) WATAP_STANDARD_STACK_FUSED_PART FIRST WATAP_STANDARD_STACK_FUSED_PART SECOND WATAP_STANDARD_DISPATCH();
+#define WATAP_STANDARD_STACK_FUSED_TRIPLE(NAME, CODE, FIRST, SECOND, THIRD) \
+  WATAP_STANDARD_FUSED_OP(NAME) WATAP_STANDARD_STACK_FUSED_PART FIRST WATAP_STANDARD_STACK_FUSED_PART SECOND WATAP_STANDARD_STACK_FUSED_PART THIRD WATAP_STANDARD_DISPATCH();
+
+/* List of control transfer instructions supported by stack bytecode execution engine */
+#define WATAP_STANDARD_STACK_CONTROL_INSTRUCTIONS(X) \
+  X(eUnreachable) X(eReturn) X(eCall) X(eReturnCall) X(eIf) X(eBr) X(eBrIf) X(eBrTable)
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* Function call frame pushing function (function arguments are consumed from evaluation stack).
+   * ARGUMENTS:
+   *   - index of function to call:
+   *       UINT32 FunctionIndex;
+   * RETURNS:
+   *   (const compiled_function_data *) Called function, nullptr if function can't be compiled or call stack is exhausted;
+   */
+  const compiled_function_data * instance_impl::PushCall( UINT32 FunctionIndex )
+  {
+    const compiled_function_data *Function = Source.GetFunction(FunctionIndex);
+
+    if (Function == nullptr || !PushCall(call_site { .Callee = Function, .FunctionIndex = FunctionIndex, .FrameSize = GetCallFrameSize(*Function) }))
+      return nullptr;
+    return Function;
+  } /* End of 'PushCall' function */
+
+  /* Stack bytecode 'call' or 'return_call' instruction quickening (callee resolution and instruction rewriting to 'eCallDirect', 'eCallHost' or 'eReturnCallDirect') function.
+   * ARGUMENTS:
+   *   - function, instruction is located in:
+   *       compiled_function_data &Function;
+   *   - 'call' or 'return_call' instruction index:
+   *       SIZE_T Ip;
+   * RETURNS:
+   *   (BOOL) TRUE if call is quickened, FALSE if callee can't be compiled;
+   */
+  BOOL instance_impl::QuickenCall( compiled_function_data &Function, SIZE_T Ip )
+  {
+    const compiled_instruction *Code = Function.Instructions.data();
+    const UINT32 FunctionIndex = WATAP_STANDARD_IMM_U32(1);
+    const compiled_function_data *Callee = Source.GetFunction(FunctionIndex);
+
+    if (Callee == nullptr)
+      return FALSE;
+
+    // Calls of the same function share call site
+    auto Site = std::ranges::find(Function.CallSites, FunctionIndex, &call_site::FunctionIndex);
+    if (Site == Function.CallSites.end())
+      Site = Function.CallSites.insert(Site, call_site { .Callee = Callee, .FunctionIndex = FunctionIndex, .FrameSize = GetCallFrameSize(*Callee) });
+
+    const UINT32 SiteIndex = static_cast<UINT32>(Site - Function.CallSites.begin());
+    const quickened_instruction Quickened = Code[Ip].Instruction == bin::instruction::eReturnCall
+      ? quickened_instruction::eReturnCallDirect
+      : IsHostFunction(*Callee) ? quickened_instruction::eCallHost : quickened_instruction::eCallDirect;
+
+    // Cache state of cached stack bytecode instruction is kept in instruction data
+    Function.Instructions[Ip].Instruction = static_cast<bin::instruction>(Quickened);
+    Function.Instructions[Ip + 1].InstructionID = static_cast<UINT16>(SiteIndex);
+    Function.Instructions[Ip + 2].InstructionID = static_cast<UINT16>(SiteIndex >> 16);
+    Link(Function, Ip);
+    return TRUE;
+  } /* End of 'QuickenCall' function */
+
+  /* Host function (on call stack top) execution function.
+   * ARGUMENTS:
+   *   - instance to execute code of:
+   *       instance_impl *Instance;
+   *   - function on call stack top:
+   *       const compiled_function_data &Function;
+   * RETURNS:
+   *   (BOOL) TRUE;
+   */
+  BOOL instance_impl::ExecuteHost( instance_impl *Instance, const compiled_function_data &Function )
+  {
+    const host_function &Host = Instance->FunctionImports[Function.ImportIndex];
+    UINT64 *Frame = Instance->GetFrame(Instance->CallStack.Top(), Function);
+
+    Instance->CallHost(Host, Frame);
+    Instance->PopCall(Function, Frame);
+    return TRUE;
+  } /* End of 'ExecuteHost' function */
+
+  /* Call stack top function execution function (chooses engine by function bytecode format).
+   * TEMPLATE ARGUMENTS:
+   *   - instruction dispatch technique:
+   *       dispatch_type DISPATCH;
+   * ARGUMENTS:
+   *   - instance to execute code of:
+   *       instance_impl *Instance;
+   *   - function on call stack top:
+   *       const compiled_function_data &Function;
+   * RETURNS:
+   *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+   */
+  template <dispatch_type DISPATCH>
+    BOOL instance_impl::ExecuteTop( instance_impl *Instance, const compiled_function_data &Function )
+    {
+      if (IsHostFunction(Function))
+        return ExecuteHost(Instance, Function);
+      if (Function.OptimizedEntry != nullptr)
+        return ExecuteOptimized(Instance, Function, Function.OptimizedEntry);
+      if (Function.Bytecode == bytecode_type::eRegister)
+        return ExecuteRegister<DISPATCH>(Instance);
+      if (Function.Bytecode == bytecode_type::eCachedStack)
+        return ExecuteCached<DISPATCH>(Instance);
+      if (Function.Bytecode == bytecode_type::eNative)
+        return ExecuteNative(Instance);
+      return Execute<DISPATCH>(Instance);
+    } /* End of 'ExecuteTop' function */
+
+  /* Function execution function (executes functions from call stack top until call stack shrinks below initial size).
+   * TEMPLATE ARGUMENTS:
+   *   - instruction dispatch technique:
+   *       dispatch_type DISPATCH;
+   * ARGUMENTS:
+   *   - instance to execute code of (nullptr if handler table requested only):
+   *       instance_impl *Instance;
+   *   - handler table (256 entries, indexed by instruction) output pointer, not nullptr only if requested:
+   *       const VOID *const **HandlerTable;
+   * RETURNS:
+   *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+   */
+  template <dispatch_type DISPATCH>
+    BOOL instance_impl::Execute( instance_impl *Instance, const VOID *const **HandlerTable )
+    {
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+      WATAP_STANDARD_HANDLER_TABLE(
+        WATAP_STANDARD_STACK_CONTROL_INSTRUCTIONS(WATAP_STANDARD_HANDLER_TABLE_ENTRY)
+        WATAP_STANDARD_STACK_SIMPLE_INSTRUCTIONS(WATAP_STANDARD_HANDLER_TABLE_ENTRY)
+        WATAP_STANDARD_NUMERIC_INSTRUCTIONS(WATAP_STANDARD_HANDLER_TABLE_ENTRY)
+        WATAP_STANDARD_FUSED_PAIRS(WATAP_STANDARD_FUSED_HANDLER_TABLE_ENTRY)
+        WATAP_STANDARD_FUSED_TRIPLES(WATAP_STANDARD_FUSED_HANDLER_TABLE_ENTRY)
+        WATAP_STANDARD_QUICKENED_HANDLER_TABLE_ENTRY(eCallDirect)
+        WATAP_STANDARD_QUICKENED_HANDLER_TABLE_ENTRY(eReturnCallDirect)
+        WATAP_STANDARD_QUICKENED_HANDLER_TABLE_ENTRY(eCallHost)
+        WATAP_STANDARD_HANDLER_TABLE_ENTRY(eSystem)
+      )
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+      const source_impl &Source = Instance->Source;
+      local_stack &EvaluationStack = Instance->EvaluationStack;
+      linear_memory &Heap = Instance->Heap;
+      fixed_stack<call> &CallStack = Instance->CallStack;
+      const SIZE_T RootDepth = CallStack.Size();
+
+      const compiled_function_data *Function;   // Current function
+      const compiled_instruction *Code;         // Current function code
+      const VOID *const *Handlers;              // Current function handlers
+      const branch_target *Targets;             // Current function branch targets
+      SIZE_T Ip;                                // Instruction pointer (index)
+      UINT64 *Frame;                            // Local variable frame (placed on evaluation stack below function values)
+
+      // Execution state by call stack top loading
+      auto LoadState = [&]( VOID )
+        {
+          const call &Call = CallStack.Top();
+
+          Function = &std::get<compiled_function_data>(Source.Functions[Call.FunctionIndex]);
+          Code = Function->Instructions.data();
+          Handlers = Function->Handlers.data();
+          Targets = Function->BranchTargets.data();
+          Ip = Call.InstructionIndex;
+          Frame = EvaluationStack.At<UINT64>(Call.EvaluationStackBase) - Function->FrameSlotCount;
+        };
+
+      LoadState();
+
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+      if constexpr (DISPATCH == dispatch_type::eThreaded)
+        goto *Handlers[Ip];
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+      while (TRUE)
+      {
+        switch (static_cast<UINT8>(Code[Ip].Instruction))
+        {
+        WATAP_STANDARD_OP(eUnreachable)
+          WATAP_STANDARD_TRAP();
+
+        WATAP_STANDARD_OP(eReturn)
+          {
+            UINT64 *Top = EvaluationStack.Get<UINT64>();
+
+            // Return value replaces frame (so it's left in the first argument slot of caller's view), the rest is popped
+            if (Function->ReturnSize != 0)
+              *Frame++ = Top[-1];
+            EvaluationStack.Pop((Top - Frame) * sizeof(UINT64));
+            CallStack.Pop();
+
+            if (CallStack.Size() < RootDepth)
+              return TRUE;
+            LoadState();
+            WATAP_STANDARD_NEXT(0)
+          }
+
+        WATAP_STANDARD_OP(eCall)
+          // Callee is resolved by the first execution only, call continues as quickened one
+          if (!Instance->QuickenCall(const_cast<compiled_function_data &>(*Function), Ip))
+            WATAP_STANDARD_TRAP();
+          [[fallthrough]];
+
+        WATAP_STANDARD_QUICKENED_OP(eCallDirect)
+          {
+            const call_site &Site = Function->CallSites[WATAP_STANDARD_IMM_U32(1)];
+            const compiled_function_data *Callee = Site.Callee;
+
+            CallStack.Top().InstructionIndex = Ip + 3;
+            if (!Instance->PushCall(Site))
+              WATAP_STANDARD_TRAP();
+
+            // Callee of another bytecode format (or tiered up one) is executed by its own engine, result is left on evaluation stack
+            if (Callee->Bytecode != bytecode_type::eStack || Callee->OptimizedEntry != nullptr)
+            {
+              if (!ExecuteTop<DISPATCH>(Instance, *Callee))
+                return FALSE;
+              LoadState();
+              WATAP_STANDARD_NEXT(0)
+            }
+
+            // Callee state is known, call stack top isn't looked up
+            Function = Callee;
+            Code = Function->Instructions.data();
+            Handlers = Function->Handlers.data();
+            Targets = Function->BranchTargets.data();
+            Ip = 0;
+            Frame = EvaluationStack.Get<UINT64>() - Function->FrameSlotCount;
+            WATAP_STANDARD_DISPATCH()
+          }
+
+        WATAP_STANDARD_QUICKENED_OP(eCallHost)
+          {
+            const compiled_function_data *Callee = Function->CallSites[WATAP_STANDARD_IMM_U32(1)].Callee;
+            const host_function &Host = Instance->FunctionImports[Callee->ImportIndex];
+
+            // Host function has no frame, its result replaces arguments (space for it is reserved with caller values)
+            Instance->CallHost(Host, EvaluationStack.Pop<UINT64>(Callee->ArgumentCount * sizeof(UINT64)));
+            if (Callee->ReturnSize != 0)
+              EvaluationStack.PushReserved(sizeof(UINT64));
+            WATAP_STANDARD_NEXT(3)
+          }
+
+        WATAP_STANDARD_OP(eReturnCall)
+          // Callee is resolved by the first execution only, tail call continues as quickened one
+          if (!Instance->QuickenCall(const_cast<compiled_function_data &>(*Function), Ip))
+            WATAP_STANDARD_TRAP();
+          [[fallthrough]];
+
+        WATAP_STANDARD_QUICKENED_OP(eReturnCallDirect)
+          {
+            const call_site &Site = Function->CallSites[WATAP_STANDARD_IMM_U32(1)];
+            const compiled_function_data *Callee = Site.Callee;
+
+            Instance->PushTailCall(Site, Frame);
+
+            // Callee of another bytecode format (or tiered up one) is executed by its own engine, its result is the current call result
+            if (Callee->Bytecode != bytecode_type::eStack || Callee->OptimizedEntry != nullptr)
+            {
+              if (!ExecuteTop<DISPATCH>(Instance, *Callee))
+                return FALSE;
+              if (CallStack.Size() < RootDepth)
+                return TRUE;
+              LoadState();
+              WATAP_STANDARD_NEXT(0)
+            }
+
+            Function = Callee;
+            Code = Function->Instructions.data();
+            Handlers = Function->Handlers.data();
+            Targets = Function->BranchTargets.data();
+            Ip = 0;
+            Frame = EvaluationStack.Get<UINT64>() - Function->FrameSlotCount;
+            WATAP_STANDARD_DISPATCH()
+          }
+
+        WATAP_STANDARD_OP(eIf)
+          if (WATAP_STANDARD_STACK_POP(UINT32) == 0)
+          {
+            const branch_target &Target = Targets[WATAP_STANDARD_IMM_U32(1)];
+
+            Ip = Target.Ip;
+            WATAP_STANDARD_DISPATCH_TO(Target.Handler);
+          }
+          WATAP_STANDARD_NEXT(3)
+
+        WATAP_STANDARD_OP(eBr)
+          WATAP_STANDARD_STACK_BRANCH(Targets[WATAP_STANDARD_IMM_U32(1)])
+
+        WATAP_STANDARD_OP(eBrIf)
+          if (WATAP_STANDARD_STACK_POP(UINT32) != 0)
+            WATAP_STANDARD_STACK_BRANCH(Targets[WATAP_STANDARD_IMM_U32(1)])
+          WATAP_STANDARD_NEXT(3)
+
+        WATAP_STANDARD_OP(eBrTable)
+          {
+            // Out of range index selects default target
+            const UINT32 Index = WATAP_STANDARD_STACK_POP(UINT32);
+            WATAP_STANDARD_STACK_BRANCH(Targets[WATAP_STANDARD_IMM_U32(1) + std::min(Index, WATAP_STANDARD_IMM_U32(3))])
+          }
+
+        // Bulk memory instructions ('data.drop' has no operands, segment index is immediate of 'memory.init' and 'data.drop' only)
+        WATAP_STANDARD_OP(eSystem)
+          {
+            const SIZE_T Length = GetCompiledInstructionLength(Code[Ip]);
+            const bin::system_instruction Instruction = Code[Ip].SystemInstruction;
+            const UINT64 *Operands = EvaluationStack.Pop<UINT64>(Instruction == bin::system_instruction::eDataDrop ? 0 : 3 * sizeof(UINT64));
+
+            if (!Instance->BulkMemory(Instruction, Length > 1 ? WATAP_STANDARD_IMM_U32(1) : 0, Operands))
+              WATAP_STANDARD_TRAP();
+            WATAP_STANDARD_NEXT(Length)
+          }
+
+        WATAP_STANDARD_STACK_SIMPLE_INSTRUCTIONS(WATAP_STANDARD_STACK_INSTRUCTION)
+        WATAP_STANDARD_NUMERIC_INSTRUCTIONS(WATAP_STANDARD_STACK_INSTRUCTION)
+
+        WATAP_STANDARD_FUSED_PAIRS(WATAP_STANDARD_STACK_FUSED_PAIR)
+        WATAP_STANDARD_FUSED_TRIPLES(WATAP_STANDARD_STACK_FUSED_TRIPLE)
+
+        default:
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+        L_Invalid:
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+          // Compiler emitted instruction that isn't supported by execution engine
+          WATAP_STANDARD_TRAP();
+        }
+      }
+    } /* End of 'Execute' function */
+
+  /* Linear memory growing function.
+   * ARGUMENTS:
+   *   - count of pages to add:
+   *       UINT32 Delta;
+   * RETURNS:
+   *   (UINT32) Previous memory size in pages, ~0 if memory can't be grown;
+   */
+  UINT32 instance_impl::GrowMemory( UINT32 Delta )
+  {
+    const SIZE_T OldPageCount = Heap.Size() / linear_memory::PageSize;
+
+    if (!Heap.Grow(Delta))
+      return ~0U;
+    return static_cast<UINT32>(OldPageCount);
+  } /* End of 'GrowMemory' function */
+
+  /* Bulk memory instruction execution function.
+   * ARGUMENTS:
+   *   - instruction ('memory.init', 'data.drop', 'memory.copy' or 'memory.fill'):
+   *       bin::system_instruction Instruction;
+   *   - data segment index ('memory.init' and 'data.drop' only):
+   *       UINT32 SegmentIndex;
+   *   - operand slots (destination address, source address, fill value or segment offset and byte count, 'data.drop' has no operands):
+   *       const UINT64 *Operands;
+   * RETURNS:
+   *   (BOOL) TRUE if instruction is executed, FALSE if range is out of memory or segment bounds (trap);
+   */
+  BOOL instance_impl::BulkMemory( bin::system_instruction Instruction, UINT32 SegmentIndex, const UINT64 *Operands )
+  {
+    if (Instruction == bin::system_instruction::eDataDrop)
+    {
+      DataSegments[SegmentIndex] = {};
+      return TRUE;
+    }
+
+    // Ranges are checked by 64 bit sums, so they don't wrap around (empty range at memory end is in bounds)
+    const UINT64 Destination = exec_util::ReadSlot<UINT32>(&Operands[0]);
+    const UINT32 Value = exec_util::ReadSlot<UINT32>(&Operands[1]);
+    const UINT64 Size = exec_util::ReadSlot<UINT32>(&Operands[2]);
+
+    if (Destination + Size > Heap.Size())
+      return FALSE;
+
+    // Host 'memmove' and 'memset' are vectorized by C library (and 'memmove' handles overlapping ranges)
+    switch (Instruction)
+    {
+    case bin::system_instruction::eMemoryCopy:
+      if (Value + Size > Heap.Size())
+        return FALSE;
+      std::memmove(Heap.Data() + Destination, Heap.Data() + Value, Size);
+      return TRUE;
+
+    case bin::system_instruction::eMemoryFill:
+      std::memset(Heap.Data() + Destination, static_cast<UINT8>(Value), Size);
+      return TRUE;
+
+    case bin::system_instruction::eMemoryInit:
+      {
+        const std::span<const UINT8> Segment = DataSegments[SegmentIndex];
+
+        if (Value + Size > Segment.size())
+          return FALSE;
+        if (Size != 0)
+          std::memcpy(Heap.Data() + Destination, Segment.data() + Value, Size);
+        return TRUE;
+      }
+
+    default:
+      return FALSE;
+    }
+  } /* End of 'BulkMemory' function */
+
+  /* Compiled function linking (direct-threaded handler resolution) function.
+   * ARGUMENTS:
+   *   - function to link:
+   *       compiled_function_data &Function;
+   * RETURNS: None.
+   */
+  VOID instance_impl::Link( compiled_function_data &Function )
+  {
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+    const VOID *const *Table = nullptr;
+    SIZE_T (*GetLength)( compiled_instruction ) = GetCompiledInstructionLength;
+
+    // Native code has nothing to resolve
+    if (Function.Bytecode == bytecode_type::eNative)
+      return;
+
+    if (Function.Bytecode == bytecode_type::eRegister)
+    {
+      ExecuteRegister<dispatch_type::eThreaded>(nullptr, &Table);
+      GetLength = GetRegisterInstructionLength;
+    }
+    else if (Function.Bytecode == bytecode_type::eCachedStack)
+      ExecuteCached<dispatch_type::eThreaded>(nullptr, &Table);
+    else
+      Execute<dispatch_type::eThreaded>(nullptr, &Table);
+
+    Function.Handlers.assign(Function.Instructions.size(), nullptr);
+    for (SIZE_T i = 0; i < Function.Instructions.size(); i += GetLength(Function.Instructions[i]))
+    {
+      const compiled_instruction Instruction = Function.Instructions[i];
+
+      // Cached stack bytecode handler variant is chosen by instruction cache state
+      Function.Handlers[i] = Function.Bytecode == bytecode_type::eCachedStack
+        ? Table[WATAP_STANDARD_CACHE_HANDLER_INDEX(Instruction)]
+        : Table[static_cast<UINT8>(Instruction.Instruction)];
+    }
+    for (branch_target &Target : Function.BranchTargets)
+      Target.Handler = Function.Handlers[Target.Ip];
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+  } /* End of 'Link' function */
+
+  /* Single instruction relinking (after instruction rewriting) function.
+   * ARGUMENTS:
+   *   - function, instruction is located in:
+   *       compiled_function_data &Function;
+   *   - rewritten instruction index:
+   *       SIZE_T Ip;
+   * RETURNS: None.
+   */
+  VOID instance_impl::Link( compiled_function_data &Function, SIZE_T Ip )
+  {
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+    const VOID *const *Table = nullptr;
+
+    // Unlinked function is executed by switch dispatch only
+    if (Function.Handlers.empty())
+      return;
+
+    if (Function.Bytecode == bytecode_type::eCachedStack)
+    {
+      ExecuteCached<dispatch_type::eThreaded>(nullptr, &Table);
+      Function.Handlers[Ip] = Table[WATAP_STANDARD_CACHE_HANDLER_INDEX(Function.Instructions[Ip])];
+    }
+    else
+    {
+      Execute<dispatch_type::eThreaded>(nullptr, &Table);
+      Function.Handlers[Ip] = Table[static_cast<UINT8>(Function.Instructions[Ip].Instruction)];
+    }
+
+    // Branch targets hold handler of the instruction too
+    for (branch_target &Target : Function.BranchTargets)
+      if (Target.Ip == Ip)
+        Target.Handler = Function.Handlers[Ip];
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+  } /* End of 'Link' function */
+
+  /* Module function calling function.
+   * ARGUMENTS:
+   *   - function name:
+   *       std::string_view FunctionName;
+   *   - function parameter list:
+   *       std::span<const value> Parameters;
+   * RETURNS:
+   *   (std::optional<value>) Return value if called, std::nullopt otherwise;
+   */
+  std::optional<value> instance_impl::Call( std::string_view FunctionName, std::span<const value> Parameters )
+  {
+    // Host function, imported by instance, can't call it back
+    if (Trapped || IsHostRunning)
+      return std::nullopt;
+
+    auto ExportIter = Source.Exports.find(FunctionName);
+    if (ExportIter == Source.Exports.end() || ExportIter->second.Type != bin::import_export_type::eFunction)
+      return std::nullopt;
+
+    const UINT32 FunctionIndex = ExportIter->second.Index;
+    const compiled_function_data *Function = Source.GetFunction(FunctionIndex);
+    if (Function == nullptr || Function->ArgumentCount != Parameters.size())
+      return std::nullopt;
+
+    // Push arguments to evaluation stack for them becoming the first callee frame slots
+    for (UINT32 i = 0; i < Function->ArgumentCount; i++)
+      PushValue(&Parameters[i], Function->LocalSizes[i]);
+
+    if (!ExecuteCall(FunctionIndex, *Function))
+      return std::nullopt;
+
+    value Result { .U64x2 {0, 0} };
+    PopValue(&Result, Function->ReturnSize);
+    return Result;
+  } /* End of 'Call' function */
+
+  /* Exported function finding function.
+   * ARGUMENTS:
+   *   - function name:
+   *       std::string_view FunctionName;
+   *   - expected function signature:
+   *       const function_signature &Signature;
+   * RETURNS:
+   *   (std::optional<UINT32>) Function index if function with such name and signature is exported, std::nullopt otherwise;
+   */
+  std::optional<UINT32> instance_impl::FindFunction( std::string_view FunctionName, const function_signature &Signature ) const
+  {
+    auto ExportIter = Source.Exports.find(FunctionName);
+    if (ExportIter == Source.Exports.end() || ExportIter->second.Type != bin::import_export_type::eFunction)
+      return std::nullopt;
+
+    const UINT32 FunctionIndex = ExportIter->second.Index;
+    if (FunctionIndex >= Source.FunctionSignatureIndices.size() || Source.FunctionSignatures[Source.FunctionSignatureIndices[FunctionIndex]] != Signature)
+      return std::nullopt;
+    return FunctionIndex;
+  } /* End of 'FindFunction' function */
+
+  /* Function by index calling function.
+   * ARGUMENTS:
+   *   - function index:
+   *       UINT32 FunctionIndex;
+   *   - argument slots (result is written to the first slot):
+   *       UINT64 *Slots;
+   * RETURNS:
+   *   (BOOL) TRUE if function finished without trap, FALSE otherwise;
+   */
+  BOOL instance_impl::CallFunction( UINT32 FunctionIndex, UINT64 *Slots )
+  {
+    // Host function, imported by instance, can't call it back
+    if (Trapped || IsHostRunning)
+      return FALSE;
+
+    const compiled_function_data *Function = Source.GetFunction(FunctionIndex);
+    if (Function == nullptr)
+      return FALSE;
+
+    // Argument slots are copied as is, they become the first callee frame slots
+    std::memcpy(EvaluationStack.Push<UINT64>(Function->ArgumentCount * sizeof(UINT64)) - Function->ArgumentCount, Slots, Function->ArgumentCount * sizeof(UINT64));
+
+    if (!ExecuteCall(FunctionIndex, *Function))
+      return FALSE;
+
+    PopValue(Slots, Function->ReturnSize);
+    return TRUE;
+  } /* End of 'CallFunction' function */
+
+  /* Function (with arguments pushed to evaluation stack) calling function (result is left on evaluation stack).
+   * ARGUMENTS:
+   *   - function index:
+   *       UINT32 FunctionIndex;
+   *   - function:
+   *       const compiled_function_data &Function;
+   * RETURNS:
+   *   (BOOL) TRUE if function finished without trap, FALSE otherwise;
+   */
+  BOOL instance_impl::ExecuteCall( UINT32 FunctionIndex, const compiled_function_data &Function )
+  {
+    if (PushCall(FunctionIndex) == nullptr)
+    {
+      Trap();
+      return FALSE;
+    }
+
+    return (Dispatch == dispatch_type::eThreaded && !Function.Handlers.empty())
+      ? ExecuteTop<dispatch_type::eThreaded>(this, Function)
+      : ExecuteTop<dispatch_type::eSwitch>(this, Function);
+  } /* End of 'ExecuteCall' function */
+
+  /* Engine instantiations, engines are referenced from other bytecode format engines */
+  template BOOL instance_impl::Execute<dispatch_type::eSwitch>( instance_impl *, const VOID *const ** );
+  template BOOL instance_impl::Execute<dispatch_type::eThreaded>( instance_impl *, const VOID *const ** );
+  template BOOL instance_impl::ExecuteTop<dispatch_type::eSwitch>( instance_impl *, const compiled_function_data & );
+  template BOOL instance_impl::ExecuteTop<dispatch_type::eThreaded>( instance_impl *, const compiled_function_data & );
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_instance.cpp' FILE */
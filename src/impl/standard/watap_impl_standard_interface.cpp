@@ -50,10 +50,12 @@ namespace watap::impl::standard
     SIZE_T ReturnTypeCount = 0;
     WATAP_SET_OR_RETURN(ReturnTypeCount, bin_util::ParseUint(Stream), std::nullopt);
 
-    if (ReturnTypeCount-- > 0)
+    if (ReturnTypeCount > 0)
+    {
       WATAP_SET_OR_RETURN(Result.ReturnType, Stream.Get<bin::value_type>(), std::nullopt);
+    }
 
-    while (ReturnTypeCount--)
+    for (SIZE_T i = 1; i < ReturnTypeCount; i++)
       Stream.Get<bin::value_type>();
     return std::move(Result);
   } /* End of 'binary_stream' structure */
@@ -62,11 +64,11 @@ namespace watap::impl::standard
     std::optional<std::span<const type>> ParseVec( binary_input_stream &Stream )
     {
       SIZE_T Count;
-      WATAP_SET_OR_RETURN(Count, ParseUint(Stream), std::nullopt);
+      WATAP_SET_OR_RETURN(Count, bin_util::ParseUint(Stream), std::nullopt);
 
-      auto Begin = reinterpret_cast<const type *>(Stream.CurrentPtr());
-      Stream.Skip(Count * sizeof(type));
-      if (!Stream)
+      // Vector may end at stream end (data section ends with the last segment bytes)
+      const type *Begin = Stream.Get<type>(Count);
+      if (Begin == nullptr)
         return std::nullopt;
 
       return std::span<const type>(Begin, Count);
@@ -87,13 +89,19 @@ namespace watap::impl::standard
 
     switch (LimitType)
     {
-    case bin::limit_type::eMinMax:
-      WATAP_SET_OR_RETURN(Result.Max, bin_util::ParseUint(Stream), std::nullopt);
-      [[fallthrough]];
-
     case bin::limit_type::eMin:
       WATAP_SET_OR_RETURN(Result.Min, bin_util::ParseUint(Stream), std::nullopt);
       break;
+
+    case bin::limit_type::eMinMax:
+      WATAP_SET_OR_RETURN(Result.Min, bin_util::ParseUint(Stream), std::nullopt);
+      WATAP_SET_OR_RETURN(Result.Max, bin_util::ParseUint(Stream), std::nullopt);
+      if (Result.Max < Result.Min)
+        return std::nullopt;
+      break;
+
+    default:
+      return std::nullopt;
     }
 
     return Result;
@@ -171,7 +179,7 @@ namespace watap::impl::standard
       return nullptr;
     std::span<const UINT8> Data = std::get<std::span<const UINT8>>(Info);
 
-    std::unique_ptr<source_impl> Result {new source_impl()};
+    std::unique_ptr<source_impl> Result {new source_impl(Settings)};
 
     // Parse sections from code
     std::map<bin::section_id, std::span<const UINT8>> Sections;
@@ -190,36 +198,6 @@ namespace watap::impl::standard
         WATAP_CALL_OR_RETURN(Result->FunctionSignatures.push_back, ParseFunctionType(Stream), nullptr);
     }
 
-    /* Function section */
-    if (auto SectionIter = Sections.find(bin::section_id::eFunction); SectionIter != Sections.end())
-    {
-      binary_input_stream Stream {SectionIter->second};
-
-      UINT32 FunctionCount = 0;
-      WATAP_SET_OR_RETURN(FunctionCount, bin_util::ParseUint(Stream), nullptr);
-
-      while (FunctionCount--)
-        WATAP_CALL_OR_RETURN(Result->FunctionSignatureIndices.push_back, bin_util::ParseUint(Stream), nullptr);
-    }
-
-    /* Table section */
-    if (auto SectionIter = Sections.find(bin::section_id::eTable); SectionIter != Sections.end())
-    {
-      binary_input_stream Stream {SectionIter->second};
-
-      std::span<const bin::table_type> Tables;
-      WATAP_SET_OR_RETURN(Tables, ParseVec<bin::table_type>(Stream), nullptr);
-      Result->Tables = {Tables.begin(), Tables.end()};
-    }
-
-    /* Global section */
-    if (auto SectionIter = Sections.find(bin::section_id::eGlobal); SectionIter != Sections.end())
-    {
-      binary_input_stream Stream {SectionIter->second};
-
-
-    }
-
     /* Import section */
     if (auto SectionIter = Sections.find(bin::section_id::eImport); SectionIter != Sections.end())
     {
@@ -241,8 +219,28 @@ namespace watap::impl::standard
         switch (Element.Type)
         {
         case bin::import_export_type::eFunction:
-          WATAP_SET_OR_RETURN(Element.Function.TypeIndex, bin_util::ParseUint(Stream), nullptr);
-          break;
+          {
+            WATAP_SET_OR_RETURN(Element.Function.TypeIndex, bin_util::ParseUint(Stream), nullptr);
+            if (Element.Function.TypeIndex >= Result->FunctionSignatures.size())
+              return nullptr;
+
+            // Imported function takes the next function index, it's called through host function, bound to it by instance
+            const function_signature &Signature = Result->FunctionSignatures[Element.Function.TypeIndex];
+            compiled_function_data Function
+            {
+              .ReturnSize = Signature.ReturnType ? static_cast<UINT32>(bin::GetValueTypeSize(*Signature.ReturnType)) : 0,
+              .ArgumentCount = static_cast<UINT32>(Signature.ArgumentTypes.size()),
+              .Bytecode = static_cast<bytecode_type>(internal_bytecode_type::eHost),
+              .FrameSlotCount = std::max<UINT32>(static_cast<UINT32>(Signature.ArgumentTypes.size()), Signature.ReturnType.has_value()),
+              .ImportIndex = Result->FunctionImportCount++,
+            };
+
+            for (bin::value_type Type : Signature.ArgumentTypes)
+              Function.LocalSizes.push_back(static_cast<UINT32>(bin::GetValueTypeSize(Type)));
+            Result->FunctionSignatureIndices.push_back(Element.Function.TypeIndex);
+            Result->Functions.push_back(std::move(Function));
+            break;
+          }
 
         case bin::import_export_type::eTable:
           WATAP_SET_OR_RETURN(Element.Table.ReferenceType, Stream.Get<bin::reference_type>(), nullptr);
@@ -263,10 +261,61 @@ namespace watap::impl::standard
           return nullptr;
         }
 
-        Result->Imports[Name] = Element;
+        Result->Imports.push_back(import_requirement { .Name = std::move(Name), .Element = Element });
+      }
+    }
+
+    /* Function section */
+    if (auto SectionIter = Sections.find(bin::section_id::eFunction); SectionIter != Sections.end())
+    {
+      binary_input_stream Stream {SectionIter->second};
+
+      UINT32 FunctionCount = 0;
+      WATAP_SET_OR_RETURN(FunctionCount, bin_util::ParseUint(Stream), nullptr);
+
+      while (FunctionCount--)
+        WATAP_CALL_OR_RETURN(Result->FunctionSignatureIndices.push_back, bin_util::ParseUint(Stream), nullptr);
+    }
+
+    /* Table section */
+    if (auto SectionIter = Sections.find(bin::section_id::eTable); SectionIter != Sections.end())
+    {
+      binary_input_stream Stream {SectionIter->second};
+
+      std::span<const bin::table_type> Tables;
+      WATAP_SET_OR_RETURN(Tables, ParseVec<bin::table_type>(Stream), nullptr);
+      Result->Tables = {Tables.begin(), Tables.end()};
+    }
+
+    /* Memory section */
+    if (auto SectionIter = Sections.find(bin::section_id::eMemory); SectionIter != Sections.end())
+    {
+      binary_input_stream Stream {SectionIter->second};
+
+      UINT32 MemoryCount = 0;
+      WATAP_SET_OR_RETURN(MemoryCount, bin_util::ParseUint(Stream), nullptr);
+
+      // Single memory is supported, its size is limited by 32 bit address space (memory without maximum may grow up to it)
+      if (MemoryCount > 1)
+        return nullptr;
+      if (MemoryCount == 1)
+      {
+        WATAP_SET_OR_RETURN(Result->MemoryLimits, ParseLimits(Stream), nullptr);
+        if (Result->MemoryLimits.Max == ~0U)
+          Result->MemoryLimits.Max = linear_memory::MaxPageCount;
+        if (Result->MemoryLimits.Min > linear_memory::MaxPageCount || Result->MemoryLimits.Max > linear_memory::MaxPageCount)
+          return nullptr;
       }
     }
 
+    /* Global section */
+    if (auto SectionIter = Sections.find(bin::section_id::eGlobal); SectionIter != Sections.end())
+    {
+      binary_input_stream Stream {SectionIter->second};
+
+
+    }
+
     /* Code section */
     if (auto SectionIter = Sections.find(bin::section_id::eCode); SectionIter != Sections.end())
     {
@@ -277,14 +326,15 @@ namespace watap::impl::standard
 
       for (UINT32 i = 0; i < FunctionCount; i++)
       {
-        const function_signature &Signature = Result->FunctionSignatures[Result->FunctionSignatureIndices[i]];
+        if (Result->FunctionImportCount + i >= Result->FunctionSignatureIndices.size())
+          return nullptr;
 
         UINT32 CodeSize = 0;
         WATAP_SET_OR_RETURN(CodeSize, bin_util::ParseUint(Stream), nullptr);
 
         Result->Functions.push_back(raw_function_data
         {
-          .SignatureIndex = Result->FunctionSignatureIndices[i],
+          .SignatureIndex = Result->FunctionSignatureIndices[Result->FunctionImportCount + i],
           .Instructions = {Stream.CurrentPtr(), Stream.CurrentPtr() + static_cast<SIZE_T>(CodeSize)},
         });
 
@@ -292,6 +342,73 @@ namespace watap::impl::standard
       }
     }
 
+    /* Data section */
+    if (auto SectionIter = Sections.find(bin::section_id::eData); SectionIter != Sections.end())
+    {
+      binary_input_stream Stream {SectionIter->second};
+
+      UINT32 SegmentCount = 0;
+      WATAP_SET_OR_RETURN(SegmentCount, bin_util::ParseUint(Stream), nullptr);
+
+      for (UINT32 i = 0; i < SegmentCount; i++)
+      {
+        data_segment Segment;
+        UINT32 Mode = 0;
+        WATAP_SET_OR_RETURN(Mode, bin_util::ParseUint(Stream), nullptr);
+
+        // Segment is passive (1) or active in memory 0 (0 or 2 with explicit memory index)
+        if (Mode == 2)
+        {
+          UINT32 MemoryIndex = 0;
+          WATAP_SET_OR_RETURN(MemoryIndex, bin_util::ParseUint(Stream), nullptr);
+          if (MemoryIndex != 0)
+            return nullptr;
+        }
+        else if (Mode != 0 && Mode != 1)
+          return nullptr;
+
+        // Offset expression is 'i32.const' only, as there are no globals
+        if (Mode != 1)
+        {
+          const bin::instruction *Instruction = Stream.Get<bin::instruction>();
+          if (Instruction == nullptr || *Instruction != bin::instruction::eI32Const)
+            return nullptr;
+
+          auto [Offset, Length] = leb128::DecodeSigned<32>(Stream.CurrentPtr());
+          if (Stream.Get<UINT8>(Length) == nullptr)
+            return nullptr;
+          Segment.Offset = static_cast<UINT32>(Offset);
+
+          const bin::instruction *End = Stream.Get<bin::instruction>();
+          if (End == nullptr || *End != bin::instruction::eExpressionEnd)
+            return nullptr;
+        }
+
+        std::span<const UINT8> Data;
+        WATAP_SET_OR_RETURN(Data, ParseVec<UINT8>(Stream), nullptr);
+        Segment.Data = {Data.begin(), Data.end()};
+
+        // Memory isn't imported, so active segment that doesn't fit initial memory fails any instantiation
+        if (Segment.Offset && static_cast<UINT64>(*Segment.Offset) + Data.size() > static_cast<UINT64>(Result->MemoryLimits.Min) * linear_memory::PageSize)
+          return nullptr;
+        Result->DataSegments.push_back(std::move(Segment));
+      }
+
+      // Image is prepared once, so instances map active segments instead of copying them
+      Result->MemoryImage.Create(Result->DataSegments);
+    }
+
+    /* Data count section (segment count must match data section, 'memory.init' and 'data.drop' are validated by data section) */
+    if (auto SectionIter = Sections.find(bin::section_id::eDataCount); SectionIter != Sections.end())
+    {
+      binary_input_stream Stream {SectionIter->second};
+
+      UINT32 SegmentCount = 0;
+      WATAP_SET_OR_RETURN(SegmentCount, bin_util::ParseUint(Stream), nullptr);
+      if (SegmentCount != Result->DataSegments.size())
+        return nullptr;
+    }
+
     /* Export section */
     if (auto SectionIter = Sections.find(bin::section_id::eExport); SectionIter != Sections.end())
     {
@@ -308,7 +425,7 @@ namespace watap::impl::standard
         /* Parse name and element */
         WATAP_SET_OR_RETURN(Name, ParseString(Stream), nullptr);
         WATAP_SET_OR_RETURN(Element.Type, Stream.Get<bin::import_export_type>(), nullptr);
-        WATAP_SET_OR_RETURN(Element.Index, Stream.Get<UINT32>(), nullptr);
+        WATAP_SET_OR_RETURN(Element.Index, bin_util::ParseUint(Stream), nullptr);
 
         Result->Exports[Name] = Element;
       }
@@ -329,6 +446,68 @@ namespace watap::impl::standard
     if (auto Impl = dynamic_cast<source_impl *>(ModuleSource))
       delete Impl;
   } /* End of 'DestroyModuleSource' function */
+
+  /* Import table create function.
+   * ARGUMENTS:
+   *   - import table descriptor:
+   *       const import_table_info &Info;
+   * RETURNS:
+   *   (import_table *) Created import table pointer, nullptr if functions with the same name are provided;
+   */ 
+  import_table * interface_impl::CreateImportTable( const import_table_info &Info )
+  {
+    std::unique_ptr<import_table_impl> Result {new import_table_impl()};
+
+    for (const host_function_import &Import : Info.Functions)
+      if (!Result->Functions.emplace(import_name { .ModuleName = Import.ModuleName, .Name = Import.Name }, Import.Function).second)
+        return nullptr;
+    return Result.release();
+  } /* End of 'CreateImportTable' function */
+
+  /* Import table destroy function.
+   * ARGUMENTS:
+   *   - import table pointer:
+   *       import_table *ImportTable;
+   * RETURNS: None.
+   */ 
+  VOID interface_impl::DestroyImportTable( import_table *ImportTable )
+  {
+    // Import tables are created by this interface only (import table interface has no virtual functions to cast it dynamically)
+    delete static_cast<import_table_impl *>(ImportTable);
+  } /* End of 'DestroyImportTable' function */
+
+  /* Runtime create function (module imports are resolved once, so instance calls imported functions by index).
+   * ARGUMENTS:
+   *   - runtime descriptor:
+   *       const runtime_info &Info;
+   * RETURNS:
+   *   (runtime *) Created instance pointer, nullptr if some module import isn't provided by import table or snapshot is taken of another module;
+   */ 
+  instance * interface_impl::CreateInstance( const instance_info &Info )
+  {
+    const source_impl *Source = dynamic_cast<const source_impl *>(Info.ModuleSource);
+    const import_table_impl *ImportTable = static_cast<const import_table_impl *>(Info.ImportTable);
+    const snapshot_impl *Snapshot = static_cast<const snapshot_impl *>(Info.Snapshot);
+    std::vector<host_function> FunctionImports;
+
+    // Snapshot is bound to module it's taken of, imports are bound to instance anew
+    if (Source == nullptr || (Snapshot != nullptr && &Snapshot->Source != Source))
+      return nullptr;
+
+    FunctionImports.reserve(Source->FunctionImportCount);
+    for (const import_requirement &Import : Source->Imports)
+    {
+      // Tables, memories and globals can't be imported, as they aren't supported by execution engines
+      if (Import.Element.Type != bin::import_export_type::eFunction || ImportTable == nullptr)
+        return nullptr;
+
+      auto Iter = ImportTable->Functions.find(Import.Name);
+      if (Iter == ImportTable->Functions.end() || Iter->second.Signature != Source->FunctionSignatures[Import.Element.Function.TypeIndex])
+        return nullptr;
+      FunctionImports.push_back(Iter->second);
+    }
+    return new instance_impl(*Source, Settings, std::move(FunctionImports), Snapshot);
+  } /* End of 'CreateInstance' function */
 } /* end of 'watap::impl::standard' namespace */
 
 /* END OF 'watap_impl_standard_parser.h' FILE */
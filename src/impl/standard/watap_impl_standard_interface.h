@@ -8,7 +8,18 @@ namespace watap::impl::standard
   /* Interface implementation */
   class interface_impl : public interface
   {
+    settings Settings; // Implementation settings
+
   public:
+    /* Interface implementation constructor.
+     * ARGUMENTS:
+     *   - implementation settings:
+     *       const settings &Settings;
+     */
+    interface_impl( const settings &Settings ) : Settings(Settings)
+    {
+    } /* End of 'interface_impl' function */
+
     /* Module source create function.
      * ARGUMENTS:
      *   - module source descriptor:
@@ -33,10 +44,7 @@ namespace watap::impl::standard
      * RETURNS:
      *   (import_table *) Created import table pointer;
      */ 
-    import_table * CreateImportTable( const import_table_info &Info )
-    {
-      throw std::runtime_error("Import table create functions aren't implemented yet");
-    } /* End of 'CreateImportTable' function */
+    import_table * CreateImportTable( const import_table_info &Info ) override;
 
     /* Import table destroy function.
      * ARGUMENTS:
@@ -44,10 +52,7 @@ namespace watap::impl::standard
      *       import_table *ImportTable;
      * RETURNS: None.
      */ 
-    VOID DestroyImportTable( import_table *ImportTable )
-    {
-      throw std::runtime_error("Import table create functions aren't implemented yet");
-    } /* End of 'DestroyImportTable' function */
+    VOID DestroyImportTable( import_table *ImportTable ) override;
 
     /* Runtime create function.
      * ARGUMENTS:
@@ -56,12 +61,7 @@ namespace watap::impl::standard
      * RETURNS:
      *   (runtime *) Created import table pointer;
      */ 
-    instance * CreateInstance( const instance_info &Info )
-    {
-      if (auto Impl = dynamic_cast<const source_impl *>(Info.ModuleSource))
-        return new instance_impl(*Impl);
-      return nullptr;
-    } /* End of 'CreateRuntime' function */
+    instance * CreateInstance( const instance_info &Info ) override;
 
     /* Runtime destroy function.
      * ARGUMENTS:
@@ -74,6 +74,32 @@ namespace watap::impl::standard
       if (auto Impl = dynamic_cast<instance_impl *>(Runtime))
         delete Impl;
     } /* End of 'DestroyRuntime' function */
+
+    /* Instance snapshot create function (instances, created from snapshot, share its memory pages until they write them).
+     * ARGUMENTS:
+     *   - initialized instance (not trapped and not running):
+     *       instance *Instance;
+     * RETURNS:
+     *   (snapshot *) Created snapshot pointer, nullptr if instance state can't be captured;
+     */
+    snapshot * CreateSnapshot( instance *Instance ) override
+    {
+      if (auto Impl = dynamic_cast<instance_impl *>(Instance))
+        return Impl->CreateSnapshot();
+      return nullptr;
+    } /* End of 'CreateSnapshot' function */
+
+    /* Instance snapshot destroy function (instances, created from snapshot, stay valid).
+     * ARGUMENTS:
+     *   - snapshot pointer:
+     *       snapshot *Snapshot;
+     * RETURNS: None.
+     */
+    VOID DestroySnapshot( snapshot *Snapshot ) override
+    {
+      // Snapshots are created by this interface only (snapshot interface has no virtual functions to cast it dynamically)
+      delete static_cast<snapshot_impl *>(Snapshot);
+    } /* End of 'DestroySnapshot' function */
   }; /* End of 'interface_impl' class */
 } /* end of 'watap_impl_standard_interface' namespace */
 
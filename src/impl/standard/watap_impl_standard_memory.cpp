@@ -0,0 +1,379 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_memory.h"
+
+#include <algorithm>
+#include <new>
+
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+#  include <map>
+#  include <mutex>
+#  include <signal.h>
+#  include <sys/mman.h>
+#  include <ucontext.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+  /* Registered native code representation structure */
+  struct registered_code
+  {
+    SIZE_T End;      // Code end address
+    SIZE_T TrapExit; // Code trap exit address
+  }; /* End of 'registered_code' structure */
+
+  /* Native code registry (codes by their starts) */
+  struct code_registry
+  {
+    std::mutex Mutex;                       // Registry access mutex
+    std::map<SIZE_T, registered_code> Codes; // Registered codes
+    struct sigaction PreviousAction {};     // Fault action, replaced by linear memory fault handler
+  }; /* End of 'code_registry' structure */
+
+  /* Native code registry getting function (registry is never destroyed, as code may be unregistered by static object destructors).
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (code_registry &) Registry;
+   */
+  static code_registry & GetCodeRegistry( VOID )
+  {
+    static code_registry *Registry = new code_registry;
+
+    return *Registry;
+  } /* End of 'GetCodeRegistry' function */
+
+  /* Linear memory access fault handler.
+   * ARGUMENTS:
+   *   - signal number:
+   *       INT Signal;
+   *   - signal information:
+   *       siginfo_t *Info;
+   *   - faulted thread context:
+   *       VOID *Context;
+   * RETURNS: None.
+   */
+  static VOID HandleFault( INT Signal, siginfo_t *Info, VOID *Context )
+  {
+    code_registry &Registry = GetCodeRegistry();
+    greg_t *Registers = static_cast<ucontext_t *>(Context)->uc_mcontext.gregs;
+    const SIZE_T Address = reinterpret_cast<SIZE_T>(Info->si_addr);
+    const SIZE_T Ip = static_cast<SIZE_T>(Registers[REG_RIP]);
+
+    // Native code keeps linear memory data in r13, so faulted address is checked to be in its reservation
+    if (Address - static_cast<SIZE_T>(Registers[REG_R13]) < linear_memory::ReservationSize)
+    {
+      // Fault is synchronous and native code never holds registry mutex, so it may be locked here
+      std::lock_guard Lock(Registry.Mutex);
+      auto Iter = Registry.Codes.upper_bound(Ip);
+
+      if (Iter != Registry.Codes.begin() && Ip < (--Iter)->second.End)
+      {
+        Registers[REG_RIP] = static_cast<greg_t>(Iter->second.TrapExit);
+        return;
+      }
+    }
+
+    // Fault isn't native code linear memory access one, it's passed to previous action
+    if (Registry.PreviousAction.sa_flags & SA_SIGINFO)
+      Registry.PreviousAction.sa_sigaction(Signal, Info, Context);
+    else if (Registry.PreviousAction.sa_handler != SIG_DFL && Registry.PreviousAction.sa_handler != SIG_IGN)
+      Registry.PreviousAction.sa_handler(Signal);
+    else
+      sigaction(Signal, &Registry.PreviousAction, nullptr); // Faulted instruction is restarted and faults with default action
+  } /* End of 'HandleFault' function */
+
+  /* Linear memory access fault handler installation (performed once) function.
+   * ARGUMENTS: None.
+   * RETURNS: None.
+   */
+  static VOID InstallFaultHandler( VOID )
+  {
+    static const BOOL IsInstalled = []( VOID ) -> BOOL
+      {
+        struct sigaction Action {};
+
+        Action.sa_sigaction = HandleFault;
+        Action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+        sigemptyset(&Action.sa_mask);
+        return sigaction(SIGSEGV, &Action, &GetCodeRegistry().PreviousAction) == 0;
+      }();
+
+    if (!IsInstalled)
+      throw std::bad_alloc();
+  } /* End of 'InstallFaultHandler' function */
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+
+  /* Memory image destructor */
+  memory_image::~memory_image( VOID )
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    if (File != -1)
+      close(File);
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+  } /* End of '~memory_image' function */
+
+  /* Image creation function.
+   * ARGUMENTS:
+   *   - data segments (active ones are written to image in order, passive ones are skipped):
+   *       std::span<const data_segment> Segments;
+   * RETURNS:
+   *   (BOOL) TRUE if image is created, FALSE if images aren't supported or data is too small (memory is initialized by copying then);
+   */
+  BOOL memory_image::Create( std::span<const data_segment> Segments )
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    const SIZE_T HostPageSize = static_cast<SIZE_T>(sysconf(_SC_PAGESIZE));
+    std::vector<std::pair<SIZE_T, SIZE_T>> Pages; // Page aligned bounds of segments
+    SIZE_T DataSize = 0;
+
+    for (const data_segment &Segment : Segments)
+      if (Segment.Offset && !Segment.Data.empty())
+      {
+        Pages.push_back({*Segment.Offset / HostPageSize * HostPageSize, (*Segment.Offset + Segment.Data.size() + HostPageSize - 1) / HostPageSize * HostPageSize});
+        DataSize += Segment.Data.size();
+      }
+    if (DataSize < MinDataSize)
+      return FALSE;
+
+    // Ranges of adjacent and overlapping segment pages are merged (pages between them stay anonymous ones)
+    std::ranges::sort(Pages);
+
+    std::vector<std::pair<SIZE_T, SIZE_T>> Merged;
+
+    for (const auto &[Begin, End] : Pages)
+      if (!Merged.empty() && Begin <= Merged.back().first + Merged.back().second)
+        Merged.back().second = std::max(Merged.back().second, End - Merged.back().first);
+      else
+        Merged.push_back({Begin, End - Begin});
+
+    std::vector<std::pair<SIZE_T, std::span<const UINT8>>> Chunks;
+
+    for (const data_segment &Segment : Segments)
+      if (Segment.Offset)
+        Chunks.push_back({*Segment.Offset, Segment.Data});
+    return Build(std::move(Merged), Chunks);
+#else // defined(WATAP_STANDARD_GUARD_PAGES)
+    return FALSE;
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+  } /* End of 'Create' function */
+
+  /* Image of memory content creation function.
+   * ARGUMENTS:
+   *   - memory content (host page aligned):
+   *       std::span<const UINT8> Memory;
+   * RETURNS:
+   *   (BOOL) TRUE if image is created, FALSE if images aren't supported or memory is zero filled (memory content is copied then);
+   */
+  BOOL memory_image::Create( std::span<const UINT8> Memory )
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    const SIZE_T HostPageSize = static_cast<SIZE_T>(sysconf(_SC_PAGESIZE));
+    std::vector<std::pair<SIZE_T, SIZE_T>> NewRanges;
+    std::vector<std::pair<SIZE_T, std::span<const UINT8>>> Chunks;
+
+    // Zero filled pages aren't written to image, they stay anonymous ones
+    for (SIZE_T Offset = 0; Offset < Memory.size(); Offset += HostPageSize)
+    {
+      const std::span<const UINT8> Page = Memory.subspan(Offset, HostPageSize);
+
+      if (std::ranges::all_of(Page, []( UINT8 Byte ) { return Byte == 0; }))
+        continue;
+      if (!NewRanges.empty() && NewRanges.back().first + NewRanges.back().second == Offset)
+        NewRanges.back().second += HostPageSize;
+      else
+        NewRanges.push_back({Offset, HostPageSize});
+    }
+    if (NewRanges.empty())
+      return FALSE;
+
+    for (const auto &[Offset, Size] : NewRanges)
+      Chunks.push_back({Offset, Memory.subspan(Offset, Size)});
+    return Build(std::move(NewRanges), Chunks);
+#else // defined(WATAP_STANDARD_GUARD_PAGES)
+    return FALSE;
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+  } /* End of 'Create' function */
+
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+  /* Image file building function.
+   * ARGUMENTS:
+   *   - host page aligned image ranges, that contain data (offsets and sizes, in ascending order, not empty):
+   *       std::vector<std::pair<SIZE_T, SIZE_T>> NewRanges;
+   *   - image data chunks (offsets and data, written in order, so later chunks replace earlier ones):
+   *       std::span<const std::pair<SIZE_T, std::span<const UINT8>>> Chunks;
+   * RETURNS:
+   *   (BOOL) TRUE if image is created, FALSE otherwise;
+   */
+  BOOL memory_image::Build( std::vector<std::pair<SIZE_T, SIZE_T>> NewRanges, std::span<const std::pair<SIZE_T, std::span<const UINT8>>> Chunks )
+  {
+    // Image file is sparse, so it takes pages, that contain data, only
+    const INT NewFile = memfd_create("watap_memory_image", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+    if (NewFile == -1)
+      return FALSE;
+    BOOL IsWritten = ftruncate(NewFile, static_cast<off_t>(NewRanges.back().first + NewRanges.back().second)) == 0;
+
+    for (const auto &[Offset, Data] : Chunks)
+      for (SIZE_T Written = 0; IsWritten && Written < Data.size(); )
+      {
+        const ssize_t Count = pwrite(NewFile, Data.data() + Written, Data.size() - Written, static_cast<off_t>(Offset + Written));
+
+        IsWritten = Count > 0;
+        Written += IsWritten ? static_cast<SIZE_T>(Count) : 0;
+      }
+
+    // Image is never changed after creation
+    if (!IsWritten || fcntl(NewFile, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0)
+    {
+      close(NewFile);
+      return FALSE;
+    }
+    File = NewFile;
+    Ranges = std::move(NewRanges);
+    return TRUE;
+  } /* End of 'Build' function */
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+
+  /* Image to memory mapping (image ranges replace memory pages, that must be accessible) function.
+   * ARGUMENTS:
+   *   - memory data:
+   *       UINT8 *Memory;
+   * RETURNS:
+   *   (BOOL) TRUE if image is mapped, FALSE otherwise;
+   */
+  BOOL memory_image::Map( UINT8 *Memory ) const
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    // Private mapping pages are shared with image until they are written
+    for (const auto &[Offset, Size] : Ranges)
+      if (mmap(Memory + Offset, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, File, static_cast<off_t>(Offset)) == MAP_FAILED)
+        return FALSE;
+    return TRUE;
+#else // defined(WATAP_STANDARD_GUARD_PAGES)
+    return Ranges.empty();
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+  } /* End of 'Map' function */
+
+  /* Linear memory constructor (throws 'std::bad_alloc' if memory can't be allocated).
+   * ARGUMENTS:
+   *   - memory size limits (in pages):
+   *       const bin::limits &Limits;
+   *   - address space reservation policy:
+   *       memory_reservation Reservation;
+   *   - committed size granularity (in pages, used by maximum size reservation only):
+   *       UINT32 GrowthGranularity;
+   *   - initial content image (mapped if it's created, it must fit initial memory size):
+   *       const memory_image &Image;
+   */
+  linear_memory::linear_memory( const bin::limits &Limits, memory_reservation Reservation, UINT32 GrowthGranularity, const memory_image &Image ) :
+    MaxLength(std::min<SIZE_T>(Limits.Max, MaxPageCount) * PageSize),
+    GrowthGranularity(IsGuarded(Reservation) ? PageSize : std::max<SIZE_T>(GrowthGranularity, 1) * PageSize)
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    if (IsGuarded(Reservation))
+      InstallFaultHandler();
+
+    // Reserved pages aren't accounted as committed memory until they are made accessible
+    Reserved = IsGuarded(Reservation) ? ReservationSize : std::max(MaxLength, PageSize);
+
+    VOID *Memory = mmap(nullptr, Reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (Memory == MAP_FAILED)
+      throw std::bad_alloc();
+    Begin = static_cast<UINT8 *>(Memory);
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+    if (!Grow(Limits.Min) || !Image.Map(Begin))
+    {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+      munmap(Begin, Reserved);
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+      throw std::bad_alloc();
+    }
+  } /* End of 'linear_memory' function */
+
+  /* Linear memory destructor */
+  linear_memory::~linear_memory( VOID )
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    munmap(Begin, Reserved);
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+  } /* End of '~linear_memory' function */
+
+  /* Memory growing function (memory is grown in place, so data pointer isn't changed, if reservations are supported).
+   * ARGUMENTS:
+   *   - count of pages to add:
+   *       SIZE_T Delta;
+   * RETURNS:
+   *   (BOOL) TRUE if memory is grown, FALSE if it exceeds its maximum or pages can't be committed;
+   */
+  BOOL linear_memory::Grow( SIZE_T Delta )
+  {
+    if (Delta > (MaxLength - Length) / PageSize)
+      return FALSE;
+
+    const SIZE_T NewLength = Length + Delta * PageSize;
+
+    if (NewLength > Committed)
+    {
+      // Commit is rounded up to granularity, so memory growing by single pages doesn't commit (or copy) on every grow
+      const SIZE_T NewCommitted = std::min((NewLength + GrowthGranularity - 1) / GrowthGranularity * GrowthGranularity, MaxLength);
+
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+      // Anonymous pages are zero filled on first access
+      if (mprotect(Begin + Committed, NewCommitted - Committed, PROT_READ | PROT_WRITE) != 0)
+        return FALSE;
+#else // defined(WATAP_STANDARD_GUARD_PAGES)
+      Storage.reserve(NewCommitted);
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+      Committed = NewCommitted;
+    }
+#if !defined(WATAP_STANDARD_GUARD_PAGES)
+    Storage.resize(NewLength, 0x00);
+    Begin = Storage.data();
+#endif // !defined(WATAP_STANDARD_GUARD_PAGES)
+    Length = NewLength;
+    return TRUE;
+  } /* End of 'Grow' function */
+
+  /* Native code (faults of which are linear memory access ones) registration function.
+   * ARGUMENTS:
+   *   - code:
+   *       const VOID *Code;
+   *   - code size:
+   *       SIZE_T Size;
+   *   - code trap exit (execution is resumed at on linear memory access fault):
+   *       const VOID *TrapExit;
+   * RETURNS: None.
+   */
+  VOID memory_util::RegisterCode( const VOID *Code, SIZE_T Size, const VOID *TrapExit )
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    code_registry &Registry = GetCodeRegistry();
+    std::lock_guard Lock(Registry.Mutex);
+
+    Registry.Codes[reinterpret_cast<SIZE_T>(Code)] = registered_code { reinterpret_cast<SIZE_T>(Code) + Size, reinterpret_cast<SIZE_T>(TrapExit) };
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+  } /* End of 'RegisterCode' function */
+
+  /* Native code unregistration (called before code is unmapped) function.
+   * ARGUMENTS:
+   *   - code:
+   *       const VOID *Code;
+   * RETURNS: None.
+   */
+  VOID memory_util::UnregisterCode( const VOID *Code )
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    code_registry &Registry = GetCodeRegistry();
+    std::lock_guard Lock(Registry.Mutex);
+
+    Registry.Codes.erase(reinterpret_cast<SIZE_T>(Code));
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+  } /* End of 'UnregisterCode' function */
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_memory.cpp' FILE */
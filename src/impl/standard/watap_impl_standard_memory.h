@@ -0,0 +1,233 @@
+#ifndef __watap_impl_standard_memory_h_
+#define __watap_impl_standard_memory_h_
+
+#include "watap_impl_standard.h"
+
+#ifndef WATAP_IMPL_STANDARD
+#  error This file shouldn't be included in global project tree
+#endif // defined(WATAP_IMPL_STANDARD)
+
+/***
+ * Linear memory.
+ *
+ * Memory is placed at the start of address space reservation and grows in place (pages are committed
+ * inside reservation, data is never copied, so memory pointers stay valid). Guarded reservation covers
+ * every address native code can compute (32 bit address plus 32 bit offset plus access size). Pages above
+ * memory size are inaccessible, so out of bounds native code access faults instead of being checked.
+ * Fault handler finds faulted native code by instruction pointer (code is registered with its trap exit
+ * on publishing) and resumes execution at code trap exit, so fault becomes usual native code trap.
+ * Reservation of declared maximum size only is kept bounds checked, its commit is rounded up to growth
+ * granularity. Interpreters keep explicit bounds checks.
+ *
+ * Active data segments of module are written to memory image (anonymous memory file) once, and image
+ * pages, that contain data, are mapped to every instance memory privately, so they are shared by
+ * instances until written (copy-on-write) and instantiation doesn't depend on data size. Memory is
+ * initialized by copying, if image isn't supported or data is too small to be mapped. Instance snapshot
+ * memory is kept as image of its non zero pages the same way.
+ ***/
+
+/* Guard page protected linear memory support ('mmap' reservation, 'SIGSEGV' handler, native code only) */
+#if defined(__x86_64__) && defined(__linux__)
+#  define WATAP_STANDARD_GUARD_PAGES
+#endif // defined(__x86_64__) && defined(__linux__)
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* Data segment representation structure */
+  struct data_segment
+  {
+    std::vector<UINT8> Data;      // Segment bytes
+    std::optional<UINT32> Offset; // Linear memory offset of active segment (it initializes instance memory), std::nullopt for passive segment
+  }; /* End of 'data_segment' structure */
+
+  /* Linear memory initial content image (mapped to instance memories copy-on-write) representation class */
+  class memory_image
+  {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    INT File = -1;                                 // Image file descriptor, -1 if image isn't created
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+    std::vector<std::pair<SIZE_T, SIZE_T>> Ranges; // Host page aligned image ranges, that contain data (offsets and sizes, in ascending order)
+
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+    /* Image file building function.
+     * ARGUMENTS:
+     *   - host page aligned image ranges, that contain data (offsets and sizes, in ascending order, not empty):
+     *       std::vector<std::pair<SIZE_T, SIZE_T>> NewRanges;
+     *   - image data chunks (offsets and data, written in order, so later chunks replace earlier ones):
+     *       std::span<const std::pair<SIZE_T, std::span<const UINT8>>> Chunks;
+     * RETURNS:
+     *   (BOOL) TRUE if image is created, FALSE otherwise;
+     */
+    BOOL Build( std::vector<std::pair<SIZE_T, SIZE_T>> NewRanges, std::span<const std::pair<SIZE_T, std::span<const UINT8>>> Chunks );
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+
+  public:
+    /* Minimal size of active segment data, image is created for (smaller data is copied faster, than mapped) */
+    static constexpr SIZE_T MinDataSize = 65536;
+
+    /* Memory image default constructor (image isn't created) */
+    memory_image( VOID ) = default;
+
+    /* Memory image destructor */
+    ~memory_image( VOID );
+
+    /* Memory image copying is not allowed */
+    memory_image( const memory_image & ) = delete;
+    memory_image & operator=( const memory_image & ) = delete;
+
+    /* Image creation function.
+     * ARGUMENTS:
+     *   - data segments (active ones are written to image in order, passive ones are skipped):
+     *       std::span<const data_segment> Segments;
+     * RETURNS:
+     *   (BOOL) TRUE if image is created, FALSE if images aren't supported or data is too small (memory is initialized by copying then);
+     */
+    BOOL Create( std::span<const data_segment> Segments );
+
+    /* Image of memory content creation function.
+     * ARGUMENTS:
+     *   - memory content (host page aligned):
+     *       std::span<const UINT8> Memory;
+     * RETURNS:
+     *   (BOOL) TRUE if image is created, FALSE if images aren't supported or memory is zero filled (memory content is copied then);
+     */
+    BOOL Create( std::span<const UINT8> Memory );
+
+    /* Image creation checking function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (BOOL) TRUE if image is created, FALSE otherwise;
+     */
+    BOOL IsCreated( VOID ) const noexcept
+    {
+      return !Ranges.empty();
+    } /* End of 'IsCreated' function */
+
+    /* Image to memory mapping (image ranges replace memory pages, that must be accessible) function.
+     * ARGUMENTS:
+     *   - memory data:
+     *       UINT8 *Memory;
+     * RETURNS:
+     *   (BOOL) TRUE if image is mapped, FALSE otherwise;
+     */
+    BOOL Map( UINT8 *Memory ) const;
+  }; /* End of 'memory_image' class */
+
+  /* Linear memory representation class */
+  class linear_memory
+  {
+    UINT8 *Begin = nullptr;       // Memory data
+    SIZE_T Length = 0;            // Memory size (in bytes)
+    SIZE_T Committed = 0;         // Size of accessible memory pages (in bytes, not less than memory size)
+    SIZE_T Reserved = 0;          // Reserved address space size (in bytes)
+    SIZE_T MaxLength;             // Maximal memory size (in bytes)
+    SIZE_T GrowthGranularity;     // Committed size granularity (in bytes)
+#if !defined(WATAP_STANDARD_GUARD_PAGES)
+    std::vector<UINT8> Storage;   // Memory storage
+#endif // !defined(WATAP_STANDARD_GUARD_PAGES)
+
+  public:
+    /* WASM page size */
+    static constexpr SIZE_T PageSize = 65536;
+
+    /* Address space reservation size (maximal 32 bit address and offset sum, access size and guard page included) */
+    static constexpr SIZE_T ReservationSize = (8ULL << 30) + PageSize;
+
+    /* Maximal memory size (in pages) */
+    static constexpr SIZE_T MaxPageCount = 65536;
+
+    /* Linear memory constructor (throws 'std::bad_alloc' if memory can't be allocated).
+     * ARGUMENTS:
+     *   - memory size limits (in pages):
+     *       const bin::limits &Limits;
+     *   - address space reservation policy:
+     *       memory_reservation Reservation;
+     *   - committed size granularity (in pages, used by maximum size reservation only):
+     *       UINT32 GrowthGranularity;
+     *   - initial content image (mapped if it's created, it must fit initial memory size):
+     *       const memory_image &Image;
+     */
+    linear_memory( const bin::limits &Limits, memory_reservation Reservation, UINT32 GrowthGranularity, const memory_image &Image );
+
+    /* Linear memory destructor */
+    ~linear_memory( VOID );
+
+    /* Linear memory copying is not allowed */
+    linear_memory( const linear_memory & ) = delete;
+    linear_memory & operator=( const linear_memory & ) = delete;
+
+    /* Memory growing function (memory is grown in place, so data pointer isn't changed, if reservations are supported).
+     * ARGUMENTS:
+     *   - count of pages to add:
+     *       SIZE_T Delta;
+     * RETURNS:
+     *   (BOOL) TRUE if memory is grown, FALSE if it exceeds its maximum or pages can't be committed;
+     */
+    BOOL Grow( SIZE_T Delta );
+
+    /* Guarded reservation (out of bounds accesses fault) policy checking function.
+     * ARGUMENTS:
+     *   - address space reservation policy:
+     *       memory_reservation Reservation;
+     * RETURNS:
+     *   (BOOL) TRUE if memory of this policy is guarded, FALSE otherwise;
+     */
+    static constexpr BOOL IsGuarded( memory_reservation Reservation ) noexcept
+    {
+#if defined(WATAP_STANDARD_GUARD_PAGES)
+      return Reservation == memory_reservation::eGuarded;
+#else // defined(WATAP_STANDARD_GUARD_PAGES)
+      return FALSE;
+#endif // defined(WATAP_STANDARD_GUARD_PAGES)
+    } /* End of 'IsGuarded' function */
+
+    /* Memory data getting function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (UINT8 *) Memory data;
+     */
+    UINT8 * Data( VOID ) const noexcept
+    {
+      return Begin;
+    } /* End of 'Data' function */
+
+    /* Memory size getting function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (SIZE_T) Memory size in bytes;
+     */
+    SIZE_T Size( VOID ) const noexcept
+    {
+      return Length;
+    } /* End of 'Size' function */
+  }; /* End of 'linear_memory' class */
+
+  /* Linear memory utility function set */
+  namespace memory_util
+  {
+    /* Native code (faults of which are linear memory access ones) registration function.
+     * ARGUMENTS:
+     *   - code:
+     *       const VOID *Code;
+     *   - code size:
+     *       SIZE_T Size;
+     *   - code trap exit (execution is resumed at on linear memory access fault):
+     *       const VOID *TrapExit;
+     * RETURNS: None.
+     */
+    VOID RegisterCode( const VOID *Code, SIZE_T Size, const VOID *TrapExit );
+
+    /* Native code unregistration (called before code is unmapped) function.
+     * ARGUMENTS:
+     *   - code:
+     *       const VOID *Code;
+     * RETURNS: None.
+     */
+    VOID UnregisterCode( const VOID *Code );
+  } /* end of 'memory_util' namespace */
+} /* end of 'watap::impl::standard' namespace */
+
+#endif // !defined(__watap_impl_standard_memory_h_)
+
+/* END OF 'watap_impl_standard_memory.h' FILE */
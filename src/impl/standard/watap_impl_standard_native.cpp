@@ -0,0 +1,1178 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_interface.h"
+#include "watap_impl_standard_exec.h"
+#include "watap_impl_standard_x86.h"
+
+#include <algorithm>
+
+/***
+ * Native code.
+ *
+ * Single pass baseline compiler of validated stack bytecode to x86-64 machine code. Frame layout
+ * is the register bytecode one: 8 byte locals first, then one slot per operand stack position
+ * (operand stack depth is known for every instruction), so dispatch disappears completely.
+ *
+ * Operand stack is tracked at compile time: value is either in its frame slot, in register, local
+ * (read by value consumer, if local isn't changed before) or constant (encoded as immediate operand
+ * if possible). Values are allocated to caller-saved registers (and r15) and spilled to their slots
+ * under register pressure, before branches, at branch targets and before calls, so all paths meet
+ * with the same (all values in slots) operand stack state.
+ *
+ * Register usage (System V calling convention, registers with fixed roles are callee-saved):
+ *   rbx - local frame (reloaded after calls, as callee frame push may move local stack);
+ *   r12 - native code execution context ('native_context');
+ *   r13 - linear memory data, r14 - linear memory size (reloaded after calls and 'memory.grow').
+ * rcx, r11 and xmm0 are scratch registers of instruction sequences.
+ *
+ * Integer, floating point and memory access instructions with direct x86-64 counterpart are emitted
+ * inline, the rest of numeric instructions (division, truncation, rounding, bit counting, etc.) call
+ * helpers, generated from the same instruction lists as interpreter handlers. Calls and 'memory.grow'
+ * are performed by instance runtime helpers. Code is emitted to writable pages, which are made
+ * executable (and read only) after emission.
+ ***/
+
+/* Instruction list entry to 'case' label conversion macro */
+#define WATAP_STANDARD_NATIVE_CASE(NAME, ...) case bin::instruction::NAME:
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+#if defined(WATAP_STANDARD_NATIVE_CODE)
+  /* Native code operand stack value location enumeration */
+  enum class native_location : UINT8
+  {
+    eFrame,    // Frame slot (own operand stack slot or local, that isn't changed since value is pushed)
+    eGeneral,  // General purpose register
+    eVector,   // SSE register
+    eConstant, // Constant (it is materialized by value consumer)
+  }; /* End of 'native_location' enumeration */
+
+  /* Native code operand stack value representation structure */
+  struct native_value
+  {
+    native_location Location; // Value location
+    UINT64 Value;             // Frame slot index, register or constant (by location)
+  }; /* End of 'native_value' structure */
+
+  /* Registers available for operand stack values (rcx, r11 and xmm0 are scratch ones, rbx and r12-r14 have fixed roles) */
+  constexpr UINT32 NATIVE_GENERAL_REGISTERS = 1U << eRax | 1U << eRdx | 1U << eRsi | 1U << eRdi | 1U << eR8 | 1U << eR9 | 1U << eR10 | 1U << eR15;
+  constexpr UINT32 NATIVE_VECTOR_REGISTERS = 0xFFFE; // xmm1-xmm15
+#endif // defined(WATAP_STANDARD_NATIVE_CODE)
+
+  /* Stack bytecode to native code compilation function.
+   * ARGUMENTS:
+   *   - function to compile (validated stack bytecode, not fused, linking isn't required):
+   *       compiled_function_data &Function;
+   * RETURNS:
+   *   (BOOL) TRUE if native code is emitted, FALSE if native code isn't supported by host or function (function isn't changed then);
+   */
+  BOOL source_impl::CompileNative( compiled_function_data &Function ) const
+  {
+#if defined(WATAP_STANDARD_NATIVE_CODE)
+    // 128 bit locals don't fit frame slots
+    if (std::ranges::any_of(Function.LocalSizes, []( UINT32 Size ) { return Size > sizeof(UINT64); }))
+      return FALSE;
+
+    constexpr UINT32 UNKNOWN_DEPTH = ~0U;
+    constexpr native_location eFrame = native_location::eFrame;
+    constexpr native_location eGeneral = native_location::eGeneral;
+    constexpr native_location eVector = native_location::eVector;
+    constexpr native_location eConstant = native_location::eConstant;
+
+    const std::vector<compiled_instruction> &Code = Function.Instructions;
+    const SIZE_T LocalCount = Function.LocalSizes.size();
+    const SIZE_T TrapIp = Code.size();                     // Index of trap exit pseudo instruction
+
+    x86_assembler Asm;
+    std::vector<BOOL> IsTarget(Code.size(), FALSE);         // Is instruction branch target (operand stack is flushed before it)
+    std::vector<UINT32> Depths(Code.size(), UNKNOWN_DEPTH); // Operand stack depths at branch targets
+    std::vector<SIZE_T> Offsets(Code.size() + 1, SIZE_MAX); // Native code offsets of instructions (trap exit is the last one)
+    std::vector<std::pair<SIZE_T, SIZE_T>> Fixups;          // Jump displacement positions and indices of instructions they jump to
+    std::vector<native_value> Stack;                        // Operand stack
+    SIZE_T MaxDepth = 0;                                    // Maximal operand stack depth
+    UINT32 FreeGeneral = NATIVE_GENERAL_REGISTERS;          // Free general purpose registers mask
+    UINT32 FreeVector = NATIVE_VECTOR_REGISTERS;            // Free SSE registers mask
+    BOOL IsReachable = TRUE;                                // Is current instruction reachable by fallthrough
+    SIZE_T Ip = 0;                                          // Current instruction index
+
+    for (const branch_target &Target : Function.BranchTargets)
+      if (Target.Ip < Code.size())
+        IsTarget[Target.Ip] = TRUE;
+
+    auto Frame = [&]( UINT64 Index )
+      {
+        return x86_memory { .Base = eRbx, .Displacement = static_cast<INT32>(Index * sizeof(UINT64)) };
+      };
+
+    // Operand stack position frame slot index getting function
+    auto Slot = [&]( SIZE_T Position ) -> UINT64
+      {
+        MaxDepth = std::max(MaxDepth, Position + 1);
+        return LocalCount + Position;
+      };
+
+    auto Push = [&]( native_location Location, UINT64 Value )
+      {
+        Stack.push_back(native_value { Location, Value });
+      };
+
+    auto Pop = [&]( VOID )
+      {
+        const native_value Value = Stack.back();
+
+        Stack.pop_back();
+        return Value;
+      };
+
+    auto Release = [&]( const native_value &Value )
+      {
+        if (Value.Location == eGeneral)
+          FreeGeneral |= 1U << Value.Value;
+        else if (Value.Location == eVector)
+          FreeVector |= 1U << Value.Value;
+      };
+
+    // Value to frame memory storing function (whole 64 bit slot is written, rcx is used as scratch)
+    auto Store = [&]( const native_value &Value, x86_memory Destination )
+      {
+        switch (Value.Location)
+        {
+        case eGeneral:
+          Asm.Memory({0x89}, static_cast<UINT8>(Value.Value), Destination, TRUE);
+          break;
+
+        case eVector:
+          Asm.Memory({0x0F, 0x11}, static_cast<UINT8>(Value.Value), Destination, FALSE, 0xF2); // movsd [destination], xmm
+          break;
+
+        case eConstant:
+          if (static_cast<INT64>(Value.Value) == static_cast<INT32>(Value.Value))
+          {
+            Asm.Memory({0xC7}, 0, Destination, TRUE);                              // mov qword [destination], simm32
+            Asm.Dword(static_cast<UINT32>(Value.Value));
+            break;
+          }
+          Asm.MoveImmediate64(eRcx, Value.Value);
+          Asm.Memory({0x89}, eRcx, Destination, TRUE);
+          break;
+
+        case eFrame:
+          Asm.Memory({0x8B}, eRcx, Frame(Value.Value), TRUE);
+          Asm.Memory({0x89}, eRcx, Destination, TRUE);
+          break;
+        }
+      };
+
+    // Operand stack value to its own slot storing function
+    auto Spill = [&]( SIZE_T Position )
+      {
+        native_value &Value = Stack[Position];
+        const UINT64 Index = Slot(Position);
+
+        if (Value.Location == eFrame && Value.Value == Index)
+          return;
+        Store(Value, Frame(Index));
+        Release(Value);
+        Value = native_value { eFrame, Index };
+      };
+
+    // All operand stack values to slots storing function (performed before control transfers and calls)
+    auto Flush = [&]( VOID )
+      {
+        for (SIZE_T Position = 0; Position < Stack.size(); Position++)
+          Spill(Position);
+      };
+
+    // Register allocation function (register value at the lowest operand stack position is spilled if there are no free registers, rcx isn't changed)
+    auto Allocate = [&]( native_location Class ) -> UINT8
+      {
+        UINT32 &Free = Class == eGeneral ? FreeGeneral : FreeVector;
+
+        if (Free == 0)
+          for (SIZE_T Position = 0; Position < Stack.size(); Position++)
+            if (Stack[Position].Location == Class)
+            {
+              Spill(Position);
+              break;
+            }
+
+        const UINT8 Register = static_cast<UINT8>(std::countr_zero(Free));
+
+        Free &= Free - 1;
+        return Register;
+      };
+
+    // Value to register of class loading function (value register is taken if it has the same class, rcx is used as scratch)
+    auto Load = [&]( const native_value &Value, native_location Class ) -> UINT8
+      {
+        if (Value.Location == Class)
+          return static_cast<UINT8>(Value.Value);
+
+        const UINT8 Register = Allocate(Class);
+        const UINT8 Source = static_cast<UINT8>(Value.Value);
+
+        if (Class == eGeneral)
+          switch (Value.Location)
+          {
+          case eVector   : Asm.Register({0x0F, 0x7E}, Source, Register, TRUE, 0x66);                  break; // movq r64, xmm
+          case eConstant : Asm.MoveImmediate64(Register, Value.Value);                                 break;
+          default        : Asm.Memory({0x8B}, Register, Frame(Value.Value), TRUE);                     break;
+          }
+        else
+          switch (Value.Location)
+          {
+          case eGeneral  : Asm.Register({0x0F, 0x6E}, Register, Source, TRUE, 0x66);                  break; // movq xmm, r64
+          case eConstant :
+            if (Value.Value == 0)
+              Asm.Register({0x0F, 0x57}, Register, Register);                                                 // xorps xmm, xmm
+            else
+            {
+              Asm.MoveImmediate64(eRcx, Value.Value);
+              Asm.Register({0x0F, 0x6E}, Register, eRcx, TRUE, 0x66);
+            }
+            break;
+          default        : Asm.Memory({0x0F, 0x10}, Register, Frame(Value.Value), FALSE, 0xF2);        break; // movsd xmm, [frame]
+          }
+        Release(Value);
+        return Register;
+      };
+
+    // Instruction with register and value (register of class or frame memory) operands emission function (rcx and xmm0 are used as scratch)
+    auto Operand = [&]( std::initializer_list<UINT8> Opcode, UINT8 Reg, const native_value &Value, native_location Class, BOOL Wide = FALSE, UINT8 Prefix = 0 )
+      {
+        UINT8 Rm = static_cast<UINT8>(Value.Value);
+
+        if (Value.Location == eFrame)
+        {
+          Asm.Memory(Opcode, Reg, Frame(Value.Value), Wide, Prefix);
+          return;
+        }
+        if (Value.Location != Class)
+        {
+          if (Value.Location == eVector)
+            Asm.Register({0x0F, 0x7E}, Rm, eRcx, TRUE, 0x66);                       // movq rcx, xmm
+          else if (Value.Location == eGeneral)
+            Asm.Register({0x0F, 0x6E}, eXmm0, Rm, TRUE, 0x66);                      // movq xmm0, r64
+          else
+          {
+            Asm.MoveImmediate64(eRcx, Value.Value);
+            if (Class == eVector)
+              Asm.Register({0x0F, 0x6E}, eXmm0, eRcx, TRUE, 0x66);                  // movq xmm0, rcx
+          }
+          Rm = Class == eGeneral ? eRcx : eXmm0;
+        }
+        Asm.Register(Opcode, Reg, Rm, Wide, Prefix);
+      };
+
+    auto JumpTo = [&]( x86_condition Condition, SIZE_T TargetIp )
+      {
+        Fixups.push_back({Asm.Jump(Condition), TargetIp});
+      };
+
+    auto Epilogue = [&]( VOID )
+      {
+        Asm.Bytes({0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5B, 0xC3}); // pop r15, r14, r13, r12, rbx; ret
+      };
+
+    // Linear memory registers reloading function (memory may be resized by helper)
+    auto ReloadHeap = [&]( VOID )
+      {
+        Asm.Memory({0x8B}, eR13, x86_memory { .Base = eR12, .Displacement = static_cast<INT32>(offsetof(native_context, HeapData)) }, TRUE);
+        Asm.Memory({0x8B}, eR14, x86_memory { .Base = eR12, .Displacement = static_cast<INT32>(offsetof(native_context, HeapSize)) }, TRUE);
+      };
+
+    // Numeric helper call function (operand stack must be flushed, operands start from operand stack position)
+    auto CallHelper = [&]( native_helper Helper, SIZE_T Position )
+      {
+        Asm.Memory({0x8D}, eRdi, Frame(Slot(Position)), TRUE);                     // lea rdi, [slot]
+        Asm.Call(Helper);
+        Asm.Bytes({0x84, 0xC0});                                                   // test al, al
+        JumpTo(x86_condition::eEqual, TrapIp);
+      };
+
+    // Loop back edge counting (optimizing compiler is called when counter reaches threshold, call may be finished by optimized code) function, operand stack must be flushed
+    auto CountBackEdge = [&]( const branch_target &Target )
+      {
+        const x86_memory Counter { .Base = eR11 };
+
+        Asm.Memory({0x8B}, eR11, x86_memory { .Base = eR12, .Displacement = static_cast<INT32>(offsetof(native_context, BackEdgeCount)) }, TRUE);
+        Asm.Memory({0x83}, 0, Counter);                                            // add dword [r11], 1
+        Asm.Byte(1);
+        Asm.Memory({0x81}, 7, Counter);                                            // cmp dword [r11], threshold
+        Asm.Dword(TierUpBackEdgeCount);
+        const SIZE_T Skip = Asm.Jump(x86_condition::eNotEqual);
+        Asm.Register({0x89}, eR12, eRdi, TRUE);                                    // mov rdi, r12
+        Asm.MoveImmediate(eRsi, static_cast<UINT32>(&Target - Function.BranchTargets.data()));
+        Asm.Call(&instance_impl::NativeTierUp);
+        Asm.Register({0x85}, eRax, eRax);                                          // test eax, eax
+        const SIZE_T Continue = Asm.Jump(x86_condition::eEqual);
+        Asm.Register({0x83}, 7, eRax);                                             // cmp eax, 1
+        Asm.Byte(1);
+        JumpTo(x86_condition::eNotEqual, TrapIp);
+        Epilogue();                                                                // eax is TRUE already
+        Asm.Patch(Skip, Asm.Code.size());
+        Asm.Patch(Continue, Asm.Code.size());
+      };
+
+    // Is branch to target loop back edge, that must be counted
+    auto IsCounted = [&]( const branch_target &Target )
+      {
+        return TierUpBackEdgeCount != 0 && Target.Ip <= Ip;
+      };
+
+    // Branch (label values moving and jump) emission function, operand stack must be flushed, values are on its top
+    auto Branch = [&]( const branch_target &Target )
+      {
+        const SIZE_T Depth = Stack.size();
+        const SIZE_T TargetDepth = Depth - Target.DropCount;
+
+        if (Depths[Target.Ip] == UNKNOWN_DEPTH)
+          Depths[Target.Ip] = static_cast<UINT32>(TargetDepth);
+        if (Target.DropCount != 0)
+          for (SIZE_T i = 0; i < Target.KeepCount; i++)
+          {
+            Asm.Memory({0x8B}, eRcx, Frame(Slot(Depth - Target.KeepCount + i)), TRUE);
+            Asm.Memory({0x89}, eRcx, Frame(Slot(TargetDepth - Target.KeepCount + i)), TRUE);
+          }
+        if (IsCounted(Target))
+          CountBackEdge(Target);
+        JumpTo(x86_condition::eAlways, Target.Ip);
+      };
+
+    // 32 bit integer condition testing function (ZF is set if condition is zero)
+    auto Test = [&]( const native_value &Condition )
+      {
+        if (Condition.Location == eGeneral)
+          Asm.Register({0x85}, static_cast<UINT8>(Condition.Value), static_cast<UINT8>(Condition.Value)); // test r32, r32
+        else
+        {
+          Operand({0x83}, 7, Condition, eGeneral);                                 // cmp r/m32, 0
+          Asm.Byte(0);
+        }
+      };
+
+    // Comparison result (by condition flags) to register storing function
+    auto SetCondition = [&]( x86_condition Condition, UINT8 Register )
+      {
+        Asm.Register({0x0F, static_cast<UINT8>(0x90 | static_cast<UINT8>(Condition))}, 0, Register, FALSE, 0, TRUE); // setcc r8
+        Asm.Register({0x0F, 0xB6}, Register, Register, FALSE, 0, TRUE);                                           // movzx r32, r8
+      };
+
+    // Linear memory operand getting function (address is moved to rcx, r11 is used as scratch), bounds of guarded memory are checked by guard pages
+    auto HeapOperand = [&]( const native_value &Address, UINT32 Offset, UINT32 Size )
+      {
+        x86_memory Heap { .Base = eR13, .Index = eRcx };
+
+        Operand({0x8B}, eRcx, Address, eGeneral);                                  // mov ecx, address (zero extended)
+        if (static_cast<UINT64>(Offset) + Size <= 0x7FFFFFFF)
+          Heap.Displacement = static_cast<INT32>(Offset);
+        else
+        {
+          Asm.MoveImmediate(eR11, Offset);
+          Asm.Register({0x03}, eRcx, eR11, TRUE);                                  // add rcx, r11
+          Offset = 0;
+        }
+        if (!linear_memory::IsGuarded(MemoryReservation))
+        {
+          Asm.Memory({0x8D}, eR11, x86_memory { .Base = eRcx, .Displacement = static_cast<INT32>(Offset + Size) }, TRUE); // lea r11, [rcx + offset + size]
+          Asm.Register({0x3B}, eR11, eR14, TRUE);                                  // cmp r11, r14
+          JumpTo(x86_condition::eAbove, TrapIp);
+        }
+        return Heap;
+      };
+
+    // Local setting function (operand stack values, that refer to local, are spilled to their slots before)
+    auto SetLocal = [&]( UINT16 Index, const native_value &Value )
+      {
+        if (Value.Location == eFrame && Value.Value == Index)
+          return;
+        for (SIZE_T Position = 0; Position < Stack.size(); Position++)
+          if (Stack[Position].Location == eFrame && Stack[Position].Value == Index)
+            Spill(Position);
+        Store(Value, Frame(Index));
+      };
+
+    // Prologue: callee-saved registers (r15 is saved to keep stack aligned and is used for values), context and frame
+    Asm.Bytes({0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57});             // push rbx, r12, r13, r14, r15
+    Asm.Register({0x89}, eRdi, eR12, TRUE);                                        // mov r12, rdi
+    Asm.Register({0x89}, eRsi, eRbx, TRUE);                                        // mov rbx, rsi
+    ReloadHeap();
+
+    for (Ip = 0; Ip < Code.size(); Ip += GetCompiledInstructionLength(Code[Ip]))
+    {
+      const bin::instruction Instruction = Code[Ip].Instruction;
+
+      // Values are in slots at branch targets
+      if (IsTarget[Ip] && IsReachable)
+        Flush();
+
+      // Code after unconditional control transfer is reachable by branches only
+      if (Depths[Ip] != UNKNOWN_DEPTH)
+      {
+        if (!IsReachable)
+        {
+          Stack.clear();
+          for (SIZE_T Position = 0; Position < Depths[Ip]; Position++)
+            Push(eFrame, Slot(Position));
+          FreeGeneral = NATIVE_GENERAL_REGISTERS;
+          FreeVector = NATIVE_VECTOR_REGISTERS;
+        }
+        IsReachable = TRUE;
+      }
+      else if (!IsReachable)
+        continue;
+      Offsets[Ip] = Asm.Code.size();
+
+      switch (Instruction)
+      {
+      case bin::instruction::eNop:
+        break;
+
+      case bin::instruction::eUnreachable:
+        JumpTo(x86_condition::eAlways, TrapIp);
+        IsReachable = FALSE;
+        break;
+
+      case bin::instruction::eReturn:
+        if (Function.ReturnSize != 0)
+          Store(Stack.back(), Frame(0));
+        Asm.MoveImmediate(eRax, 1);                                                // mov eax, TRUE
+        Epilogue();
+        IsReachable = FALSE;
+        break;
+
+      case bin::instruction::eCall:
+        {
+          const UINT32 FunctionIndex = WATAP_STANDARD_IMM_U32(1);
+          const function_signature &Signature = FunctionSignatures[FunctionSignatureIndices[FunctionIndex]];
+
+          Flush();
+
+          const SIZE_T Base = Stack.size() - Signature.ArgumentTypes.size();
+
+          Asm.Register({0x89}, eR12, eRdi, TRUE);                                  // mov rdi, r12
+          Asm.Register({0x89}, eRbx, eRsi, TRUE);                                  // mov rsi, rbx
+          Asm.MoveImmediate(eRdx, FunctionIndex);
+          Asm.MoveImmediate(eRcx, static_cast<UINT32>(Slot(Base)));
+          Asm.Call(&instance_impl::NativeCall);
+          Asm.Register({0x85}, eRax, eRax, TRUE);                                  // test rax, rax
+          JumpTo(x86_condition::eEqual, TrapIp);
+          Asm.Register({0x89}, eRax, eRbx, TRUE);                                  // mov rbx, rax
+          ReloadHeap();
+
+          Stack.resize(Base);
+          if (Signature.ReturnType)
+            Push(eFrame, Slot(Base));
+          break;
+        }
+
+      case bin::instruction::eIf:
+        {
+          const branch_target &Target = Function.BranchTargets[WATAP_STANDARD_IMM_U32(1)];
+          const native_value Condition = Pop();
+
+          Flush();
+          Test(Condition);
+          Release(Condition);
+          if (Depths[Target.Ip] == UNKNOWN_DEPTH)
+            Depths[Target.Ip] = static_cast<UINT32>(Stack.size());
+          JumpTo(x86_condition::eEqual, Target.Ip);
+          break;
+        }
+
+      case bin::instruction::eBr:
+        Flush();
+        Branch(Function.BranchTargets[WATAP_STANDARD_IMM_U32(1)]);
+        IsReachable = FALSE;
+        break;
+
+      case bin::instruction::eBrIf:
+        {
+          const branch_target &Target = Function.BranchTargets[WATAP_STANDARD_IMM_U32(1)];
+          const native_value Condition = Pop();
+
+          Flush();
+          Test(Condition);
+          Release(Condition);
+
+          // Label values are moved and back edges are counted on taken branch only
+          if ((Target.DropCount != 0 && Target.KeepCount != 0) || IsCounted(Target))
+          {
+            const SIZE_T Skip = Asm.Jump(x86_condition::eEqual);
+
+            Branch(Target);
+            Asm.Patch(Skip, Asm.Code.size());
+          }
+          else
+          {
+            if (Depths[Target.Ip] == UNKNOWN_DEPTH)
+              Depths[Target.Ip] = static_cast<UINT32>(Stack.size() - Target.DropCount);
+            JumpTo(x86_condition::eNotEqual, Target.Ip);
+          }
+          break;
+        }
+
+      // Jump table of 32 bit offsets (relative to table) of per-label branch stubs, out of range index selects default label
+      case bin::instruction::eBrTable:
+        {
+          const UINT32 FirstTarget = WATAP_STANDARD_IMM_U32(1);
+          const UINT32 LabelCount = WATAP_STANDARD_IMM_U32(3);
+          const native_value Index = Pop();
+
+          Flush();
+          Operand({0x8B}, eRcx, Index, eGeneral);                                  // mov ecx, index
+          Release(Index);
+          Asm.MoveImmediate(eR11, LabelCount);
+          Asm.Register({0x3B}, eRcx, eR11);                                        // cmp ecx, r11d
+          Asm.Register({0x0F, 0x47}, eRcx, eR11);                                  // cmova ecx, r11d
+          Asm.Bytes({0x4C, 0x8D, 0x1D});                                           // lea r11, [rip + table]
+          const SIZE_T TableDisplacement = Asm.Code.size();
+          Asm.Dword(0);
+          Asm.Memory({0x63}, eRcx, x86_memory { .Base = eR11, .Index = eRcx, .Scale = 2 }, TRUE); // movsxd rcx, [r11 + rcx * 4]
+          Asm.Register({0x03}, eRcx, eR11, TRUE);                                  // add rcx, r11
+          Asm.Register({0xFF}, 4, eRcx);                                           // jmp rcx
+
+          const SIZE_T Table = Asm.Code.size();
+          Asm.Patch(TableDisplacement, Table);
+          Asm.Code.resize(Table + (LabelCount + 1) * sizeof(UINT32));
+          for (UINT32 i = 0; i <= LabelCount; i++)
+          {
+            Asm.SetDword(Table + i * sizeof(UINT32), static_cast<UINT32>(Asm.Code.size() - Table));
+            Branch(Function.BranchTargets[FirstTarget + i]);
+          }
+          IsReachable = FALSE;
+          break;
+        }
+
+      case bin::instruction::eDrop:
+        Release(Pop());
+        break;
+
+      // Values are selected in general purpose register by conditional move
+      case bin::instruction::eSelect:
+        {
+          const native_value Condition = Pop();
+          const native_value Rhs = Pop();
+          const native_value Lhs = Pop();
+
+          // Condition is 32 bit, upper half of constant isn't its part
+          if (Condition.Location == eConstant)
+          {
+            const BOOL IsTrue = static_cast<UINT32>(Condition.Value) != 0;
+
+            Release(IsTrue ? Rhs : Lhs);
+            Stack.push_back(IsTrue ? Lhs : Rhs);
+            break;
+          }
+
+          const UINT8 Result = Load(Lhs, eGeneral);
+
+          Test(Condition);
+          Operand({0x0F, 0x44}, Result, Rhs, eGeneral, TRUE);                      // cmove result, rhs
+          Release(Condition);
+          Release(Rhs);
+          Push(eGeneral, Result);
+          break;
+        }
+
+      // Locals are read by value consumers
+      case bin::instruction::eLocalGet:
+        Push(eFrame, WATAP_STANDARD_IMM_U16(1));
+        break;
+
+      case bin::instruction::eLocalSet:
+        {
+          const native_value Value = Pop();
+
+          SetLocal(WATAP_STANDARD_IMM_U16(1), Value);
+          Release(Value);
+          break;
+        }
+
+      case bin::instruction::eLocalTee:
+        {
+          const native_value Value = Pop();
+
+          SetLocal(WATAP_STANDARD_IMM_U16(1), Value);
+          Stack.push_back(Value);
+          break;
+        }
+
+      case bin::instruction::eMemorySize:
+        {
+          const UINT8 Result = Allocate(eGeneral);
+
+          Asm.Register({0x89}, eR14, Result, TRUE);                                // mov result, r14
+          Asm.Register({0xC1}, 5, Result, TRUE);                                   // shr result, 16
+          Asm.Byte(16);
+          Push(eGeneral, Result);
+          break;
+        }
+
+      case bin::instruction::eMemoryGrow:
+        Flush();
+        Asm.Register({0x89}, eR12, eRdi, TRUE);                                    // mov rdi, r12
+        Asm.Memory({0x8D}, eRsi, Frame(Slot(Stack.size() - 1)), TRUE);            // lea rsi, [delta]
+        Asm.Call(&instance_impl::NativeGrowMemory);
+        ReloadHeap();
+        break;
+
+      // Bulk memory instructions are executed by instance (memory isn't resized, so heap isn't reloaded)
+      case bin::instruction::eSystem:
+        {
+          const bin::system_instruction SystemInstruction = Code[Ip].SystemInstruction;
+          const SIZE_T Base = Stack.size() - (SystemInstruction == bin::system_instruction::eDataDrop ? 0 : 3);
+
+          Flush();
+          Asm.Register({0x89}, eR12, eRdi, TRUE);                                  // mov rdi, r12
+          Asm.Memory({0x8D}, eRsi, Frame(Slot(Base)), TRUE);                       // lea rsi, [operands]
+          Asm.MoveImmediate(eRdx, static_cast<UINT32>(SystemInstruction));
+          Asm.MoveImmediate(eRcx, GetCompiledInstructionLength(Code[Ip]) > 1 ? WATAP_STANDARD_IMM_U32(1) : 0);
+          Asm.Call(&instance_impl::NativeBulkMemory);
+          Asm.Bytes({0x84, 0xC0});                                                 // test al, al
+          JumpTo(x86_condition::eEqual, TrapIp);
+          Stack.resize(Base);
+          break;
+        }
+
+      // 32 bit constants are sign extended (upper halves of 32 bit values are ignored), so they fit instruction immediates
+      case bin::instruction::eI32Const:
+      case bin::instruction::eF32Const:
+        Push(eConstant, static_cast<UINT64>(static_cast<INT64>(static_cast<INT32>(WATAP_STANDARD_IMM_U32(1)))));
+        break;
+
+      case bin::instruction::eRefNull:
+        Push(eConstant, 0);
+        break;
+
+      case bin::instruction::eRefFunc:
+        Push(eConstant, WATAP_STANDARD_IMM_U32(1) + 1);
+        break;
+
+      case bin::instruction::eI64Const:
+      case bin::instruction::eF64Const:
+        Push(eConstant, WATAP_STANDARD_IMM_U64(1));
+        break;
+
+      WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_NATIVE_CASE)
+        {
+          // Conversion to floating point value (result register is cleared to break dependency on its previous value)
+          auto Convert = [&]( std::initializer_list<UINT8> Opcode, UINT8 Prefix, native_location SourceClass, BOOL Wide )
+            {
+              const native_value Value = Pop();
+              const UINT8 Result = Allocate(eVector);
+
+              Asm.Register({0x0F, 0x57}, Result, Result);                          // xorps result, result
+              Operand(Opcode, Result, Value, SourceClass, Wide, Prefix);
+              Release(Value);
+              Push(eVector, Result);
+            };
+
+          // Integer sign extension (by 'movsx'/'movsxd' opcode)
+          auto Extend = [&]( std::initializer_list<UINT8> Opcode, BOOL Wide )
+            {
+              const UINT8 Result = Load(Pop(), eGeneral);
+
+              Asm.Register(Opcode, Result, Result, Wide, 0, TRUE);
+              Push(eGeneral, Result);
+            };
+
+          // Floating point sign bit modification (by 'bt*' opcode extension)
+          auto SignBit = [&]( UINT8 Extension, BOOL Wide )
+            {
+              const UINT8 Result = Load(Pop(), eGeneral);
+
+              Asm.Register({0x0F, 0xBA}, Extension, Result, Wide);
+              Asm.Byte(Wide ? 63 : 31);
+              Push(eGeneral, Result);
+            };
+
+          auto SquareRoot = [&]( UINT8 Prefix )
+            {
+              const UINT8 Result = Load(Pop(), eVector);
+
+              Asm.Register({0x0F, 0x51}, Result, Result, FALSE, Prefix);
+              Push(eVector, Result);
+            };
+
+          switch (Instruction)
+          {
+          case bin::instruction::eI32Eqz         :
+          case bin::instruction::eI64Eqz         :
+          case bin::instruction::eRefIsNull      :
+            {
+              const UINT8 Result = Load(Pop(), eGeneral);
+
+              Asm.Register({0x85}, Result, Result, Instruction == bin::instruction::eI64Eqz); // test result, result
+              SetCondition(x86_condition::eEqual, Result);
+              Push(eGeneral, Result);
+              break;
+            }
+
+          case bin::instruction::eF32Abs         : SignBit(6, FALSE); break;         // btr
+          case bin::instruction::eF32Neg         : SignBit(7, FALSE); break;         // btc
+          case bin::instruction::eF64Abs         : SignBit(6, TRUE);  break;
+          case bin::instruction::eF64Neg         : SignBit(7, TRUE);  break;
+
+          case bin::instruction::eF32Sqrt        : SquareRoot(0xF3); break;
+          case bin::instruction::eF64Sqrt        : SquareRoot(0xF2); break;
+
+          case bin::instruction::eF32ConvertI32S : Convert({0x0F, 0x2A}, 0xF3, eGeneral, FALSE); break;
+          case bin::instruction::eF32ConvertI64S : Convert({0x0F, 0x2A}, 0xF3, eGeneral, TRUE);  break;
+          case bin::instruction::eF64ConvertI32S : Convert({0x0F, 0x2A}, 0xF2, eGeneral, FALSE); break;
+          case bin::instruction::eF64ConvertI64S : Convert({0x0F, 0x2A}, 0xF2, eGeneral, TRUE);  break;
+          case bin::instruction::eF32DemoteF64   : Convert({0x0F, 0x5A}, 0xF2, eVector, FALSE);  break;
+          case bin::instruction::eF64PromoteF32  : Convert({0x0F, 0x5A}, 0xF3, eVector, FALSE);  break;
+
+          // Unsigned 32 bit integer is converted as zero extended 64 bit one
+          case bin::instruction::eF32ConvertI32U :
+          case bin::instruction::eF64ConvertI32U :
+            {
+              const native_value Value = Pop();
+              const UINT8 Result = Allocate(eVector);
+              const UINT8 Prefix = Instruction == bin::instruction::eF32ConvertI32U ? 0xF3 : 0xF2;
+
+              Operand({0x8B}, eRcx, Value, eGeneral);                              // mov ecx, value
+              Release(Value);
+              Asm.Register({0x0F, 0x57}, Result, Result);                          // xorps result, result
+              Asm.Register({0x0F, 0x2A}, Result, eRcx, TRUE, Prefix);              // cvtsi2ss/cvtsi2sd result, rcx
+              Push(eVector, Result);
+              break;
+            }
+
+          // Upper halves of 32 bit values are ignored, so wrap is no-op (constant is sign extended as 32 bit one)
+          case bin::instruction::eI32WrapI64     :
+            if (Stack.back().Location == eConstant)
+              Stack.back().Value = static_cast<UINT64>(static_cast<INT64>(static_cast<INT32>(Stack.back().Value)));
+            break;
+
+          case bin::instruction::eI64ExtendI32U  :
+            {
+              const UINT8 Result = Load(Pop(), eGeneral);
+
+              Asm.Register({0x89}, Result, Result);                                // mov r32, r32 (upper half is zeroed)
+              Push(eGeneral, Result);
+              break;
+            }
+
+          case bin::instruction::eI64ExtendI32S  : Extend({0x63}, TRUE);        break;
+          case bin::instruction::eI32Extend8S    : Extend({0x0F, 0xBE}, FALSE); break;
+          case bin::instruction::eI32Extend16S   : Extend({0x0F, 0xBF}, FALSE); break;
+          case bin::instruction::eI64Extend8S    : Extend({0x0F, 0xBE}, TRUE);  break;
+          case bin::instruction::eI64Extend16S   : Extend({0x0F, 0xBF}, TRUE);  break;
+          case bin::instruction::eI64Extend32S   : Extend({0x63}, TRUE);        break;
+
+          default:
+            Flush();
+            CallHelper(NativeHelpers[static_cast<UINT8>(Instruction)], Stack.size() - 1);
+            break;
+          }
+          break;
+        }
+
+      WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_NATIVE_CASE)
+        {
+          // Integer operation, returns register with result (opcode extension selects immediate form of operation, 'imul' one is marked by ~0)
+          auto Integer = [&]( std::initializer_list<UINT8> Opcode, UINT8 Extension, BOOL Wide )
+            {
+              const native_value Rhs = Pop();
+              const UINT8 Result = Load(Pop(), eGeneral);
+              const INT32 Immediate = static_cast<INT32>(Rhs.Value);
+
+              if (Rhs.Location == eConstant && (!Wide || static_cast<INT64>(Rhs.Value) == Immediate))
+              {
+                if (Extension != 0xFF && Immediate >= -128 && Immediate <= 127)
+                {
+                  Asm.Register({0x83}, Extension, Result, Wide);                   // op result, simm8
+                  Asm.Byte(static_cast<UINT8>(Immediate));
+                }
+                else
+                {
+                  if (Extension == 0xFF)
+                    Asm.Register({0x69}, Result, Result, Wide);                    // imul result, result, imm32
+                  else
+                    Asm.Register({0x81}, Extension, Result, Wide);                 // op result, imm32
+                  Asm.Dword(static_cast<UINT32>(Immediate));
+                }
+              }
+              else
+                Operand(Opcode, Result, Rhs, eGeneral, Wide);
+              Release(Rhs);
+              return Result;
+            };
+
+          // Integer shift or rotation (by 'C1'/'D3' opcode extension), count is taken by module of bit count by processor
+          auto Shift = [&]( UINT8 Extension, BOOL Wide )
+            {
+              const native_value Rhs = Pop();
+              const UINT8 Result = Load(Pop(), eGeneral);
+
+              if (Rhs.Location == eConstant)
+              {
+                Asm.Register({0xC1}, Extension, Result, Wide);
+                Asm.Byte(static_cast<UINT8>(Rhs.Value & (Wide ? 63 : 31)));
+              }
+              else
+              {
+                Operand({0x8B}, eRcx, Rhs, eGeneral);                              // mov ecx, count
+                Asm.Register({0xD3}, Extension, Result, Wide);
+              }
+              Release(Rhs);
+              Push(eGeneral, Result);
+            };
+
+          auto IntegerCompare = [&]( x86_condition Condition, BOOL Wide )
+            {
+              const UINT8 Result = Integer({0x3B}, 7, Wide);
+
+              SetCondition(Condition, Result);
+              Push(eGeneral, Result);
+            };
+
+          // Floating point operation (prefix selects precision)
+          auto Float = [&]( UINT8 Opcode, UINT8 Prefix )
+            {
+              const native_value Rhs = Pop();
+              const UINT8 Result = Load(Pop(), eVector);
+
+              Operand({0x0F, Opcode}, Result, Rhs, eVector, FALSE, Prefix);
+              Release(Rhs);
+              Push(eVector, Result);
+            };
+
+          // Floating point comparison ('less' ones are 'greater' ones with swapped operands, so unordered operands compare false)
+          auto FloatCompare = [&]( x86_condition Condition, BOOL IsDouble, BOOL IsSwapped )
+            {
+              const native_value Rhs = Pop();
+              const native_value Lhs = Pop();
+              const native_value First = IsSwapped ? Rhs : Lhs;
+              const native_value Second = IsSwapped ? Lhs : Rhs;
+              const UINT8 Register = Load(First, eVector);
+
+              Operand({0x0F, 0x2E}, Register, Second, eVector, FALSE, IsDouble ? 0x66 : 0); // ucomiss/ucomisd
+              FreeVector |= 1U << Register;
+              Release(Second);
+
+              const UINT8 Result = Allocate(eGeneral);
+
+              Asm.Register({0x0F, static_cast<UINT8>(0x90 | static_cast<UINT8>(Condition))}, 0, Result, FALSE, 0, TRUE);
+              if (Condition == x86_condition::eEqual || Condition == x86_condition::eNotEqual)
+              {
+                // Parity flag is set for unordered operands
+                const BOOL IsEqual = Condition == x86_condition::eEqual;
+
+                Asm.Register({0x0F, static_cast<UINT8>(IsEqual ? 0x9B : 0x9A)}, 0, eRcx);           // setnp/setp cl
+                Asm.Register({static_cast<UINT8>(IsEqual ? 0x20 : 0x08)}, eRcx, Result, FALSE, 0, TRUE); // and/or result8, cl
+              }
+              Asm.Register({0x0F, 0xB6}, Result, Result, FALSE, 0, TRUE);                          // movzx r32, r8
+              Push(eGeneral, Result);
+            };
+
+          switch (Instruction)
+          {
+          case bin::instruction::eI32Add  : Push(eGeneral, Integer({0x03}, 0, FALSE));          break;
+          case bin::instruction::eI32Sub  : Push(eGeneral, Integer({0x2B}, 5, FALSE));          break;
+          case bin::instruction::eI32Mul  : Push(eGeneral, Integer({0x0F, 0xAF}, 0xFF, FALSE)); break;
+          case bin::instruction::eI32And  : Push(eGeneral, Integer({0x23}, 4, FALSE));          break;
+          case bin::instruction::eI32Or   : Push(eGeneral, Integer({0x0B}, 1, FALSE));          break;
+          case bin::instruction::eI32Xor  : Push(eGeneral, Integer({0x33}, 6, FALSE));          break;
+          case bin::instruction::eI64Add  : Push(eGeneral, Integer({0x03}, 0, TRUE));           break;
+          case bin::instruction::eI64Sub  : Push(eGeneral, Integer({0x2B}, 5, TRUE));           break;
+          case bin::instruction::eI64Mul  : Push(eGeneral, Integer({0x0F, 0xAF}, 0xFF, TRUE));  break;
+          case bin::instruction::eI64And  : Push(eGeneral, Integer({0x23}, 4, TRUE));           break;
+          case bin::instruction::eI64Or   : Push(eGeneral, Integer({0x0B}, 1, TRUE));           break;
+          case bin::instruction::eI64Xor  : Push(eGeneral, Integer({0x33}, 6, TRUE));           break;
+
+          case bin::instruction::eI32Shl  : Shift(4, FALSE); break;
+          case bin::instruction::eI32ShrS : Shift(7, FALSE); break;
+          case bin::instruction::eI32ShrU : Shift(5, FALSE); break;
+          case bin::instruction::eI32Rotl : Shift(0, FALSE); break;
+          case bin::instruction::eI32Rotr : Shift(1, FALSE); break;
+          case bin::instruction::eI64Shl  : Shift(4, TRUE);  break;
+          case bin::instruction::eI64ShrS : Shift(7, TRUE);  break;
+          case bin::instruction::eI64ShrU : Shift(5, TRUE);  break;
+          case bin::instruction::eI64Rotl : Shift(0, TRUE);  break;
+          case bin::instruction::eI64Rotr : Shift(1, TRUE);  break;
+
+          case bin::instruction::eI32Eq   : IntegerCompare(x86_condition::eEqual, FALSE);        break;
+          case bin::instruction::eI32Ne   : IntegerCompare(x86_condition::eNotEqual, FALSE);     break;
+          case bin::instruction::eI32LtS  : IntegerCompare(x86_condition::eLess, FALSE);         break;
+          case bin::instruction::eI32LtU  : IntegerCompare(x86_condition::eBelow, FALSE);        break;
+          case bin::instruction::eI32GtS  : IntegerCompare(x86_condition::eGreater, FALSE);      break;
+          case bin::instruction::eI32GtU  : IntegerCompare(x86_condition::eAbove, FALSE);        break;
+          case bin::instruction::eI32LeS  : IntegerCompare(x86_condition::eLessEqual, FALSE);    break;
+          case bin::instruction::eI32LeU  : IntegerCompare(x86_condition::eBelowEqual, FALSE);   break;
+          case bin::instruction::eI32GeS  : IntegerCompare(x86_condition::eGreaterEqual, FALSE); break;
+          case bin::instruction::eI32GeU  : IntegerCompare(x86_condition::eAboveEqual, FALSE);   break;
+          case bin::instruction::eI64Eq   : IntegerCompare(x86_condition::eEqual, TRUE);         break;
+          case bin::instruction::eI64Ne   : IntegerCompare(x86_condition::eNotEqual, TRUE);      break;
+          case bin::instruction::eI64LtS  : IntegerCompare(x86_condition::eLess, TRUE);          break;
+          case bin::instruction::eI64LtU  : IntegerCompare(x86_condition::eBelow, TRUE);         break;
+          case bin::instruction::eI64GtS  : IntegerCompare(x86_condition::eGreater, TRUE);       break;
+          case bin::instruction::eI64GtU  : IntegerCompare(x86_condition::eAbove, TRUE);         break;
+          case bin::instruction::eI64LeS  : IntegerCompare(x86_condition::eLessEqual, TRUE);     break;
+          case bin::instruction::eI64LeU  : IntegerCompare(x86_condition::eBelowEqual, TRUE);    break;
+          case bin::instruction::eI64GeS  : IntegerCompare(x86_condition::eGreaterEqual, TRUE);  break;
+          case bin::instruction::eI64GeU  : IntegerCompare(x86_condition::eAboveEqual, TRUE);    break;
+
+          case bin::instruction::eF32Add  : Float(0x58, 0xF3); break;
+          case bin::instruction::eF32Sub  : Float(0x5C, 0xF3); break;
+          case bin::instruction::eF32Mul  : Float(0x59, 0xF3); break;
+          case bin::instruction::eF32Div  : Float(0x5E, 0xF3); break;
+          case bin::instruction::eF64Add  : Float(0x58, 0xF2); break;
+          case bin::instruction::eF64Sub  : Float(0x5C, 0xF2); break;
+          case bin::instruction::eF64Mul  : Float(0x59, 0xF2); break;
+          case bin::instruction::eF64Div  : Float(0x5E, 0xF2); break;
+
+          case bin::instruction::eF32Eq   : FloatCompare(x86_condition::eEqual, FALSE, FALSE);       break;
+          case bin::instruction::eF32Ne   : FloatCompare(x86_condition::eNotEqual, FALSE, FALSE);    break;
+          case bin::instruction::eF32Lt   : FloatCompare(x86_condition::eAbove, FALSE, TRUE);        break;
+          case bin::instruction::eF32Gt   : FloatCompare(x86_condition::eAbove, FALSE, FALSE);       break;
+          case bin::instruction::eF32Le   : FloatCompare(x86_condition::eAboveEqual, FALSE, TRUE);   break;
+          case bin::instruction::eF32Ge   : FloatCompare(x86_condition::eAboveEqual, FALSE, FALSE);  break;
+          case bin::instruction::eF64Eq   : FloatCompare(x86_condition::eEqual, TRUE, FALSE);        break;
+          case bin::instruction::eF64Ne   : FloatCompare(x86_condition::eNotEqual, TRUE, FALSE);     break;
+          case bin::instruction::eF64Lt   : FloatCompare(x86_condition::eAbove, TRUE, TRUE);         break;
+          case bin::instruction::eF64Gt   : FloatCompare(x86_condition::eAbove, TRUE, FALSE);        break;
+          case bin::instruction::eF64Le   : FloatCompare(x86_condition::eAboveEqual, TRUE, TRUE);    break;
+          case bin::instruction::eF64Ge   : FloatCompare(x86_condition::eAboveEqual, TRUE, FALSE);   break;
+
+          default:
+            Flush();
+            CallHelper(NativeHelpers[static_cast<UINT8>(Instruction)], Stack.size() - 2);
+            Stack.pop_back();
+            break;
+          }
+          break;
+        }
+
+      // Floating point values are loaded to SSE registers, integer ones are loaded to general purpose registers (address register is reused)
+      WATAP_STANDARD_LOAD_INSTRUCTIONS(WATAP_STANDARD_NATIVE_CASE)
+        {
+          const native_value Address = Pop();
+          const BOOL IsFloat = Instruction == bin::instruction::eF32Load || Instruction == bin::instruction::eF64Load;
+          const BOOL IsReused = !IsFloat && Address.Location == eGeneral;
+          const UINT8 Result = IsReused ? static_cast<UINT8>(Address.Value) : Allocate(IsFloat ? eVector : eGeneral);
+          const x86_memory Heap = HeapOperand(Address, WATAP_STANDARD_IMM_U32(1), GetAccessSize(Instruction));
+
+          if (!IsReused)
+            Release(Address);
+          switch (Instruction)
+          {
+          case bin::instruction::eF32Load    : Asm.Memory({0x0F, 0x10}, Result, Heap, FALSE, 0xF3); break; // movss
+          case bin::instruction::eF64Load    : Asm.Memory({0x0F, 0x10}, Result, Heap, FALSE, 0xF2); break; // movsd
+          case bin::instruction::eI32Load    :
+          case bin::instruction::eI64Load32U : Asm.Memory({0x8B}, Result, Heap);                    break;
+          case bin::instruction::eI64Load    : Asm.Memory({0x8B}, Result, Heap, TRUE);              break;
+          case bin::instruction::eI32Load8S  : Asm.Memory({0x0F, 0xBE}, Result, Heap);              break;
+          case bin::instruction::eI32Load16S : Asm.Memory({0x0F, 0xBF}, Result, Heap);              break;
+          case bin::instruction::eI32Load8U  :
+          case bin::instruction::eI64Load8U  : Asm.Memory({0x0F, 0xB6}, Result, Heap);              break;
+          case bin::instruction::eI32Load16U :
+          case bin::instruction::eI64Load16U : Asm.Memory({0x0F, 0xB7}, Result, Heap);              break;
+          case bin::instruction::eI64Load8S  : Asm.Memory({0x0F, 0xBE}, Result, Heap, TRUE);        break;
+          case bin::instruction::eI64Load16S : Asm.Memory({0x0F, 0xBF}, Result, Heap, TRUE);        break;
+          case bin::instruction::eI64Load32S : Asm.Memory({0x63}, Result, Heap, TRUE);              break;
+          default:
+            return FALSE;
+          }
+          Push(IsFloat ? eVector : eGeneral, Result);
+          break;
+        }
+
+      // Floating point values in SSE registers are stored directly, the rest are loaded to general purpose registers
+      WATAP_STANDARD_STORE_INSTRUCTIONS(WATAP_STANDARD_NATIVE_CASE)
+        {
+          const UINT32 Size = GetAccessSize(Instruction);
+          const native_value Value = Pop();
+          const native_value Address = Pop();
+          const BOOL IsVector = Value.Location == eVector
+            && (Instruction == bin::instruction::eF32Store || Instruction == bin::instruction::eF64Store);
+          const UINT8 Register = IsVector ? static_cast<UINT8>(Value.Value) : Load(Value, eGeneral);
+          const x86_memory Heap = HeapOperand(Address, WATAP_STANDARD_IMM_U32(1), Size);
+
+          if (IsVector)
+            Asm.Memory({0x0F, 0x11}, Register, Heap, FALSE, Size == 8 ? 0xF2 : 0xF3); // movss/movsd [heap], xmm
+          else if (Size == 1)
+            Asm.Memory({0x88}, Register, Heap, FALSE, 0, TRUE);                    // mov [heap], r8
+          else if (Size == 2)
+            Asm.Memory({0x89}, Register, Heap, FALSE, 0x66);                       // mov [heap], r16
+          else
+            Asm.Memory({0x89}, Register, Heap, Size == 8);
+          Release(native_value { IsVector ? eVector : eGeneral, Register });
+          Release(Address);
+          break;
+        }
+
+      default:
+        // Instruction isn't supported by native code
+        return FALSE;
+      }
+    }
+
+    // Trap exit
+    Offsets[TrapIp] = Asm.Code.size();
+    Asm.Bytes({0x31, 0xC0});                                                       // xor eax, eax
+    Epilogue();
+
+    for (const auto &[Position, TargetIp] : Fixups)
+    {
+      if (Offsets[TargetIp] == SIZE_MAX)
+        return FALSE;
+      Asm.Patch(Position, Offsets[TargetIp]);
+    }
+
+    if (LocalCount + MaxDepth > 0x0FFFFFFF)
+      return FALSE;
+
+    Function.NativeCode = PublishCode(Asm.Code, Offsets[TrapIp]);
+    if (Function.NativeCode == nullptr)
+      return FALSE;
+    Function.NativeEntry = reinterpret_cast<native_entry>(const_cast<VOID *>(Function.NativeCode.get()));
+    Function.Bytecode = bytecode_type::eNative;
+    Function.FrameSlotCount = static_cast<UINT32>(LocalCount + MaxDepth);
+    return TRUE;
+#else // defined(WATAP_STANDARD_NATIVE_CODE)
+    return FALSE;
+#endif // defined(WATAP_STANDARD_NATIVE_CODE)
+  } /* End of 'CompileNative' function */
+
+  /* Native function (on call stack top) execution function.
+   * ARGUMENTS:
+   *   - instance to execute code of:
+   *       instance_impl *Instance;
+   * RETURNS:
+   *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+   */
+  BOOL instance_impl::ExecuteNative( instance_impl *Instance )
+  {
+    const call Call = Instance->CallStack.Top();
+    const compiled_function_data &Function = std::get<compiled_function_data>(Instance->Source.Functions[Call.FunctionIndex]);
+    native_context Context { Instance, Instance->Heap.Data(), Instance->Heap.Size(), 0, &Instance->BackEdgeCounts[Call.FunctionIndex] };
+
+    if (!Function.NativeEntry(&Context, Instance->LocalStack.Get<UINT64>() - Function.FrameSlotCount))
+    {
+      Instance->Trap();
+      return FALSE;
+    }
+
+    // Frame may be moved by calls, so result is read from local stack top
+    Instance->PopCall(Function, Instance->LocalStack.Get<UINT64>() - Function.FrameSlotCount);
+    return TRUE;
+  } /* End of 'ExecuteNative' function */
+
+  /* Function calling from native code function (arguments and result are passed through caller frame slots).
+   * ARGUMENTS:
+   *   - native code execution context:
+   *       native_context *Context;
+   *   - caller frame:
+   *       UINT64 *Frame;
+   *   - index of function to call:
+   *       UINT32 FunctionIndex;
+   *   - caller frame slot of the first argument (result is stored to it):
+   *       UINT32 Base;
+   * RETURNS:
+   *   (UINT64 *) Caller frame (it may be moved by callee), nullptr if callee trapped;
+   */
+  UINT64 * instance_impl::NativeCall( native_context *Context, UINT64 *Frame, UINT32 FunctionIndex, UINT32 Base )
+  {
+    instance_impl *Instance = Context->Instance;
+    const compiled_function_data *Callee = Instance->Source.GetFunction(FunctionIndex);
+
+    if (Callee == nullptr)
+      return nullptr;
+
+    // Host callee reads arguments from and stores result to caller frame slots, no instance call frame is pushed
+    if (IsHostFunction(*Callee))
+    {
+      const host_function &Host = Instance->FunctionImports[Callee->ImportIndex];
+
+      Instance->CallHost(Host, Frame + Base);
+      return Frame;
+    }
+
+    const SIZE_T CallerSlotCount = Instance->CallStack.Top().LocalStackFrameSize / sizeof(UINT64);
+
+    // Callee is executed by engine of its bytecode format, arguments and result are passed by evaluation stack
+    for (UINT32 i = 0; i < Callee->ArgumentCount; i++)
+      Instance->PushValue(Frame + Base + i, Callee->LocalSizes[i]);
+    if (Instance->PushCall(FunctionIndex) == nullptr)
+      return nullptr;
+
+    const BOOL IsFinished = (Instance->Dispatch == dispatch_type::eThreaded && !Callee->Handlers.empty())
+      ? ExecuteTop<dispatch_type::eThreaded>(Instance, *Callee)
+      : ExecuteTop<dispatch_type::eSwitch>(Instance, *Callee);
+
+    if (!IsFinished)
+      return nullptr;
+
+    Frame = Instance->LocalStack.Get<UINT64>() - CallerSlotCount;
+    Instance->PopValue(Frame + Base, Callee->ReturnSize);
+    Context->HeapData = Instance->Heap.Data();
+    Context->HeapSize = Instance->Heap.Size();
+    return Frame;
+  } /* End of 'NativeCall' function */
+
+  /* Linear memory growing from native code function.
+   * ARGUMENTS:
+   *   - native code execution context:
+   *       native_context *Context;
+   *   - frame slot with count of pages to add (previous memory size in pages or ~0 is stored to it):
+   *       UINT64 *Slot;
+   * RETURNS: None.
+   */
+  VOID instance_impl::NativeGrowMemory( native_context *Context, UINT64 *Slot )
+  {
+    instance_impl *Instance = Context->Instance;
+
+    exec_util::WriteSlot<UINT32>(Slot, Instance->GrowMemory(exec_util::ReadSlot<UINT32>(Slot)));
+    Context->HeapData = Instance->Heap.Data();
+    Context->HeapSize = Instance->Heap.Size();
+  } /* End of 'NativeGrowMemory' function */
+
+  /* Bulk memory instruction execution from native code function.
+   * ARGUMENTS:
+   *   - native code execution context:
+   *       native_context *Context;
+   *   - operand slots (in operand stack order):
+   *       const UINT64 *Operands;
+   *   - instruction (system instruction code):
+   *       UINT32 Instruction;
+   *   - data segment index ('memory.init' and 'data.drop' only):
+   *       UINT32 SegmentIndex;
+   * RETURNS:
+   *   (BOOL) TRUE if instruction is executed, FALSE on trap;
+   */
+  BOOL instance_impl::NativeBulkMemory( native_context *Context, const UINT64 *Operands, UINT32 Instruction, UINT32 SegmentIndex )
+  {
+    return Context->Instance->BulkMemory(static_cast<bin::system_instruction>(Instruction), SegmentIndex, Operands);
+  } /* End of 'NativeBulkMemory' function */
+
+  /* Loop tier-up from native code (called when back edge counter reaches threshold) function.
+   * ARGUMENTS:
+   *   - native code execution context:
+   *       native_context *Context;
+   *   - loop header branch target index:
+   *       UINT32 TargetIndex;
+   * RETURNS:
+   *   (UINT32) 0 if native code continues execution, 1 if call is finished by optimized code (result is stored to frame first slot), 2 on trap;
+   */
+  UINT32 instance_impl::NativeTierUp( native_context *Context, UINT32 TargetIndex )
+  {
+    instance_impl *Instance = Context->Instance;
+    const compiled_function_data &Function = std::get<compiled_function_data>(Instance->Source.Functions[Instance->CallStack.Top().FunctionIndex]);
+    const native_entry Entry = Instance->TierUpLoop(TargetIndex);
+
+    if (Entry == nullptr)
+      return 0;
+    if (!Entry(Context, Instance->LocalStack.Get<UINT64>() - Function.FrameSlotCount))
+      return 2;
+
+    // Frame may be moved by calls of optimized code
+    exec_util::CopyValue(Instance->LocalStack.Get<UINT64>() - Function.FrameSlotCount, &Context->Result, Function.ReturnSize);
+    return 1;
+  } /* End of 'NativeTierUp' function */
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_native.cpp' FILE */
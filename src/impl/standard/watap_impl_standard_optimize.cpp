@@ -0,0 +1,374 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_interface.h"
+#include "watap_impl_standard_exec.h"
+
+/***
+ * Constant folding and peephole optimization of validated stack bytecode.
+ *
+ * Instructions are moved to output one by one, and every rule is applied to the output tail until
+ * nothing changes, so folding results take part in further folding. Rules never look behind
+ * branch targets (they are relocated to optimized code after all) and through control transfer
+ * instructions. Instructions that may trap are folded only if they don't trap on folded operands.
+ ***/
+
+/* Folding implementations (by 'WATAP_STANDARD_*_INSTRUCTIONS' list KIND), operand bit patterns are 'Lhs' and 'Rhs' ('Value' for unary) */
+#define WATAP_STANDARD_FOLD_OP_BINARY(TYPE, OP) return MakeConstant<TYPE>(static_cast<TYPE>(Get<TYPE>(Lhs) OP Get<TYPE>(Rhs)));
+#define WATAP_STANDARD_FOLD_FN_BINARY(TYPE, FN) return MakeConstant<TYPE>(static_cast<TYPE>(FN(Get<TYPE>(Lhs), Get<TYPE>(Rhs))));
+#define WATAP_STANDARD_FOLD_SHIFT(TYPE, OP) return MakeConstant<TYPE>(static_cast<TYPE>(Get<TYPE>(Lhs) OP (Get<TYPE>(Rhs) & (sizeof(TYPE) * 8 - 1))));
+#define WATAP_STANDARD_FOLD_ROTATE(TYPE, FN) return MakeConstant<TYPE>(FN(Get<TYPE>(Lhs), static_cast<INT>(Get<TYPE>(Rhs) & (sizeof(TYPE) * 8 - 1))));
+#define WATAP_STANDARD_FOLD_COMPARE(TYPE, OP) return MakeConstant<UINT32>(Get<TYPE>(Lhs) OP Get<TYPE>(Rhs));
+
+#define WATAP_STANDARD_FOLD_DIV_S(TYPE)                                                                          \
+  if (Get<TYPE>(Rhs) == 0 || (Get<TYPE>(Rhs) == -1 && Get<TYPE>(Lhs) == std::numeric_limits<TYPE>::min()))       \
+    return std::nullopt;                                                                                         \
+  return MakeConstant<TYPE>(Get<TYPE>(Lhs) / Get<TYPE>(Rhs));
+
+#define WATAP_STANDARD_FOLD_REM_S(TYPE)                                                                          \
+  if (Get<TYPE>(Rhs) == 0)                                                                                       \
+    return std::nullopt;                                                                                         \
+  return MakeConstant<TYPE>(Get<TYPE>(Rhs) == -1 ? 0 : Get<TYPE>(Lhs) % Get<TYPE>(Rhs));
+
+#define WATAP_STANDARD_FOLD_DIV_U(TYPE, OP)                                                                      \
+  if (Get<TYPE>(Rhs) == 0)                                                                                       \
+    return std::nullopt;                                                                                         \
+  return MakeConstant<TYPE>(Get<TYPE>(Lhs) OP Get<TYPE>(Rhs));
+
+#define WATAP_STANDARD_FOLD_FN_UNARY(TYPE, FN) return MakeConstant<TYPE>(static_cast<TYPE>(FN(Get<TYPE>(Value))));
+#define WATAP_STANDARD_FOLD_EQZ(TYPE) return MakeConstant<UINT32>(Get<TYPE>(Value) == 0);
+#define WATAP_STANDARD_FOLD_I_EXTEND(BASE, SUB) return MakeConstant<BASE>(static_cast<BASE>(Get<SUB>(Value)));
+#define WATAP_STANDARD_FOLD_CAST(FROM, TO) return MakeConstant<TO>(static_cast<TO>(Get<FROM>(Value)));
+
+#define WATAP_STANDARD_FOLD_TRUNC(FROM, TO)                                                                      \
+  if (!exec_util::IsTruncatable<TO>(Get<FROM>(Value)))                                                           \
+    return std::nullopt;                                                                                         \
+  return MakeConstant<TO>(static_cast<TO>(Get<FROM>(Value)));
+
+/* Folding instruction list entry implementation macro */
+#define WATAP_STANDARD_FOLD_INSTRUCTION(NAME, KIND, ...) case bin::instruction::NAME: { WATAP_STANDARD_FOLD_##KIND(__VA_ARGS__) }
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* Decoded stack bytecode instruction representation structure */
+  struct optimizer_instruction
+  {
+    compiled_instruction Instruction;    // Instruction
+    std::array<UINT16, 4> Immediates {}; // Immediate slots (count is defined by instruction)
+
+    /* Constant value getting function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (std::optional<UINT64>) Constant value bit pattern if instruction is numeric constant, std::nullopt otherwise;
+     */
+    std::optional<UINT64> GetConstant( VOID ) const noexcept
+    {
+      switch (Instruction.Instruction)
+      {
+      case bin::instruction::eI32Const:
+      case bin::instruction::eF32Const:
+        return static_cast<UINT64>(Immediates[0]) | static_cast<UINT64>(Immediates[1]) << 16;
+
+      case bin::instruction::eI64Const:
+      case bin::instruction::eF64Const:
+        return
+          static_cast<UINT64>(Immediates[0])       | static_cast<UINT64>(Immediates[1]) << 16 |
+          static_cast<UINT64>(Immediates[2]) << 32 | static_cast<UINT64>(Immediates[3]) << 48;
+
+      default:
+        return std::nullopt;
+      }
+    } /* End of 'GetConstant' function */
+
+    /* Is instruction of certain kind checking function.
+     * ARGUMENTS:
+     *   - instruction:
+     *       bin::instruction Other;
+     * RETURNS:
+     *   (BOOL) TRUE if instruction is Other;
+     */
+    BOOL Is( bin::instruction Other ) const noexcept
+    {
+      return Instruction.Instruction == Other;
+    } /* End of 'Is' function */
+  }; /* End of 'optimizer_instruction' structure */
+
+  /* Constant value from bit pattern getting function.
+   * ARGUMENTS:
+   *   - constant bit pattern:
+   *       UINT64 Bits;
+   * RETURNS:
+   *   (type) Constant value;
+   */
+  template <typename type>
+    static type Get( UINT64 Bits ) noexcept
+    {
+      return exec_util::ReadSlot<type>(&Bits);
+    } /* End of 'Get' function */
+
+  /* Constant instruction creation function.
+   * ARGUMENTS:
+   *   - constant value:
+   *       type Value;
+   * RETURNS:
+   *   (optimizer_instruction) Constant instruction of value type;
+   */
+  template <typename type>
+    static optimizer_instruction MakeConstant( type Value ) noexcept
+    {
+      UINT64 Bits = 0;
+      exec_util::WriteSlot<type>(&Bits, Value);
+
+      optimizer_instruction Result {};
+      if constexpr (sizeof(type) == 4)
+        Result.Instruction.Instruction = std::is_floating_point_v<type> ? bin::instruction::eF32Const : bin::instruction::eI32Const;
+      else
+        Result.Instruction.Instruction = std::is_floating_point_v<type> ? bin::instruction::eF64Const : bin::instruction::eI64Const;
+      for (SIZE_T i = 0; i < 4; i++)
+        Result.Immediates[i] = static_cast<UINT16>(Bits >> i * 16);
+      return Result;
+    } /* End of 'MakeConstant' function */
+
+  /* Unary instruction folding function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       bin::instruction Instruction;
+   *   - operand bit pattern:
+   *       UINT64 Value;
+   * RETURNS:
+   *   (std::optional<optimizer_instruction>) Result constant, std::nullopt if instruction isn't foldable or traps;
+   */
+  static std::optional<optimizer_instruction> FoldUnary( bin::instruction Instruction, UINT64 Value )
+  {
+    switch (Instruction)
+    {
+    WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_FOLD_INSTRUCTION)
+
+    default:
+      return std::nullopt;
+    }
+  } /* End of 'FoldUnary' function */
+
+  /* Binary instruction folding function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       bin::instruction Instruction;
+   *   - operand bit patterns:
+   *       UINT64 Lhs, Rhs;
+   * RETURNS:
+   *   (std::optional<optimizer_instruction>) Result constant, std::nullopt if instruction isn't foldable or traps;
+   */
+  static std::optional<optimizer_instruction> FoldBinary( bin::instruction Instruction, UINT64 Lhs, UINT64 Rhs )
+  {
+    switch (Instruction)
+    {
+    WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_FOLD_INSTRUCTION)
+
+    default:
+      return std::nullopt;
+    }
+  } /* End of 'FoldBinary' function */
+
+  /* Right operand identity (integer operation with it doesn't change left operand) checking function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       bin::instruction Instruction;
+   *   - right operand bit pattern:
+   *       UINT64 Rhs;
+   * RETURNS:
+   *   (BOOL) TRUE if operation result is always equal to left operand;
+   */
+  static BOOL IsRightIdentity( bin::instruction Instruction, UINT64 Rhs ) noexcept
+  {
+    switch (Instruction)
+    {
+    case bin::instruction::eI32Add  : case bin::instruction::eI64Add  :
+    case bin::instruction::eI32Sub  : case bin::instruction::eI64Sub  :
+    case bin::instruction::eI32Or   : case bin::instruction::eI64Or   :
+    case bin::instruction::eI32Xor  : case bin::instruction::eI64Xor  :
+    case bin::instruction::eI32Shl  : case bin::instruction::eI64Shl  :
+    case bin::instruction::eI32ShrS : case bin::instruction::eI64ShrS :
+    case bin::instruction::eI32ShrU : case bin::instruction::eI64ShrU :
+    case bin::instruction::eI32Rotl : case bin::instruction::eI64Rotl :
+    case bin::instruction::eI32Rotr : case bin::instruction::eI64Rotr :
+      return Rhs == 0;
+
+    case bin::instruction::eI32Mul  : case bin::instruction::eI64Mul  :
+    case bin::instruction::eI32DivS : case bin::instruction::eI64DivS :
+    case bin::instruction::eI32DivU : case bin::instruction::eI64DivU :
+      return Rhs == 1;
+
+    case bin::instruction::eI32And  :
+      return Rhs == 0xFFFFFFFF;
+
+    case bin::instruction::eI64And  :
+      return Rhs == ~0ULL;
+
+    default:
+      return FALSE;
+    }
+  } /* End of 'IsRightIdentity' function */
+
+  /* Stack bytecode constant folding and peephole optimization function.
+   * ARGUMENTS:
+   *   - function to optimize (validated stack bytecode, linking isn't required):
+   *       compiled_function_data &Function;
+   * RETURNS:
+   *   (SIZE_T) Count of instructions removed;
+   */
+  SIZE_T source_impl::Optimize( compiled_function_data &Function ) const
+  {
+    const std::vector<compiled_instruction> &Code = Function.Instructions;
+    std::vector<optimizer_instruction> Output;
+    SIZE_T InputCount = 0;
+    BOOL IsUnreachable = FALSE;
+
+    // Branch targets (by instruction index) and output instruction indices they are relocated to
+    std::map<UINT32, SIZE_T> TargetOutputIndices;
+    SIZE_T Barrier = 0; // Index of first output instruction, rules may be applied to
+
+    for (const branch_target &Target : Function.BranchTargets)
+      TargetOutputIndices[Target.Ip] = 0;
+
+    // Output tail rewriting function
+    auto Rewrite = [&]( VOID ) -> BOOL
+      {
+        const SIZE_T Size = Output.size();
+        const SIZE_T Count = Size - Barrier;
+        optimizer_instruction &Last = Output[Size - 1];
+        optimizer_instruction *const Previous = Count >= 2 ? &Output[Size - 2] : nullptr;
+        optimizer_instruction *const PrePrevious = Count >= 3 ? &Output[Size - 3] : nullptr;
+
+        // Nop
+        if (Last.Is(bin::instruction::eNop))
+        {
+          Output.pop_back();
+          return TRUE;
+        }
+
+        if (Previous == nullptr)
+          return FALSE;
+
+        // Unary constant folding
+        if (auto Value = Previous->GetConstant())
+          if (auto Folded = FoldUnary(Last.Instruction.Instruction, *Value))
+          {
+            Output.pop_back();
+            Output.back() = *Folded;
+            return TRUE;
+          }
+
+        // Binary constant folding
+        if (PrePrevious != nullptr)
+          if (auto Lhs = PrePrevious->GetConstant())
+            if (auto Rhs = Previous->GetConstant())
+              if (auto Folded = FoldBinary(Last.Instruction.Instruction, *Lhs, *Rhs))
+              {
+                Output.resize(Size - 2);
+                Output.back() = *Folded;
+                return TRUE;
+              }
+
+        // Operation with identity right operand
+        if (auto Rhs = Previous->GetConstant(); Rhs && IsRightIdentity(Last.Instruction.Instruction, *Rhs))
+        {
+          Output.resize(Size - 2);
+          return TRUE;
+        }
+
+        // Unused value without side effects
+        if (Last.Is(bin::instruction::eDrop))
+        {
+          if (Previous->GetConstant() || Previous->Is(bin::instruction::eLocalGet) || Previous->Is(bin::instruction::eRefNull) || Previous->Is(bin::instruction::eRefFunc))
+          {
+            Output.resize(Size - 2);
+            return TRUE;
+          }
+          if (Previous->Is(bin::instruction::eLocalTee))
+          {
+            Previous->Instruction.Instruction = bin::instruction::eLocalSet;
+            Output.pop_back();
+            return TRUE;
+          }
+        }
+
+        // Local variable access pairs
+        if (Previous->Immediates[0] == Last.Immediates[0])
+        {
+          // Value is stored and loaded back
+          if (Previous->Is(bin::instruction::eLocalSet) && Last.Is(bin::instruction::eLocalGet))
+          {
+            Previous->Instruction.Instruction = bin::instruction::eLocalTee;
+            Output.pop_back();
+            return TRUE;
+          }
+
+          // Value is loaded and stored back
+          if (Previous->Is(bin::instruction::eLocalGet) && Last.Is(bin::instruction::eLocalSet))
+          {
+            Output.resize(Size - 2);
+            return TRUE;
+          }
+
+          // Value is stored twice
+          if (Previous->Is(bin::instruction::eLocalTee) && Last.Is(bin::instruction::eLocalSet))
+          {
+            Previous->Instruction.Instruction = bin::instruction::eLocalSet;
+            Output.pop_back();
+            return TRUE;
+          }
+        }
+
+        return FALSE;
+      };
+
+    for (SIZE_T Ip = 0; Ip < Code.size(); Ip += GetCompiledInstructionLength(Code[Ip]))
+    {
+      optimizer_instruction Instruction { Code[Ip] };
+      for (SIZE_T i = 1; i < GetCompiledInstructionLength(Code[Ip]); i++)
+        Instruction.Immediates[i - 1] = Code[Ip + i].InstructionID;
+      InputCount++;
+
+      // Code after unconditional control transfer is dead until branch target
+      if (auto Target = TargetOutputIndices.find(static_cast<UINT32>(Ip)); Target != TargetOutputIndices.end())
+      {
+        Target->second = Barrier = Output.size();
+        IsUnreachable = FALSE;
+      }
+      if (IsUnreachable)
+        continue;
+      if (Instruction.Is(bin::instruction::eReturn) || Instruction.Is(bin::instruction::eReturnCall) || Instruction.Is(bin::instruction::eUnreachable) || Instruction.Is(bin::instruction::eBr) || Instruction.Is(bin::instruction::eBrTable))
+        IsUnreachable = TRUE;
+
+      Output.push_back(Instruction);
+      while (Output.size() > Barrier && Rewrite())
+        ;
+    }
+
+    if (Output.size() == InputCount)
+      return 0;
+
+    // Encode optimized instructions
+    std::vector<compiled_instruction> Result;
+    std::vector<UINT32> OutputIps; // Instruction indices of output instructions
+
+    Result.reserve(Code.size());
+    OutputIps.reserve(Output.size() + 1);
+    for (const optimizer_instruction &Instruction : Output)
+    {
+      OutputIps.push_back(static_cast<UINT32>(Result.size()));
+      Result.push_back(Instruction.Instruction);
+      for (SIZE_T i = 1; i < GetCompiledInstructionLength(Instruction.Instruction); i++)
+        Result.push_back(compiled_instruction { .InstructionID = Instruction.Immediates[i - 1] });
+    }
+    OutputIps.push_back(static_cast<UINT32>(Result.size()));
+    Function.Instructions = std::move(Result);
+
+    for (branch_target &Target : Function.BranchTargets)
+      Target.Ip = OutputIps[TargetOutputIndices[Target.Ip]];
+
+    return InputCount - Output.size();
+  } /* End of 'Optimize' function */
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_optimize.cpp' FILE */
@@ -0,0 +1,638 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_interface.h"
+#include "watap_impl_standard_exec.h"
+
+/***
+ * Register bytecode.
+ *
+ * Every function frame consists of 8 byte slots: locals first, then one slot per operand stack
+ * position (stack depth is known for every instruction after validation). Instruction operands
+ * are slot indices, so 'local.get' disappears (operand is local slot itself) and 'local.set'
+ * usually becomes destination slot of previous instruction.
+ *
+ * Layout (in 16 bit instruction slots):
+ *   unary      [op][dst][src]
+ *   binary     [op][dst][lhs][rhs]
+ *   load       [op][dst][address][offset:2]
+ *   store      [op][address][value][offset:2]
+ *   local.set  [op][dst][src]                  (slot copy)
+ *   i32.const  [op][dst][value:2]              (also f32.const, ref.null, ref.func)
+ *   i64.const  [op][dst][value:4]              (also f64.const)
+ *   select     [op][dst][lhs][rhs][condition]
+ *   call       [op][function:2][base]          (arguments are in slots from base, result is put to base)
+ *   return     [op][src]                       (data is 1 if function returns value)
+ *   memory.*   [op][dst] / [op][dst][delta]
+ ***/
+
+/* Register operand reading/writing macros */
+#define WATAP_STANDARD_REG_GET(TYPE, SLOT) exec_util::ReadSlot<TYPE>(Frame + WATAP_STANDARD_IMM_U16(SLOT))
+#define WATAP_STANDARD_REG_SET(TYPE, SLOT, VALUE) exec_util::WriteSlot<TYPE>(Frame + WATAP_STANDARD_IMM_U16(SLOT), (VALUE))
+
+/* Register binary operator implementation generation macro */
+#define WATAP_STANDARD_REG_OP_BINARY(TYPE, OP) { WATAP_STANDARD_REG_SET(TYPE, 1, WATAP_STANDARD_REG_GET(TYPE, 2) OP WATAP_STANDARD_REG_GET(TYPE, 3)); WATAP_STANDARD_NEXT(4) }
+
+/* Register binary function implementation generation macro */
+#define WATAP_STANDARD_REG_FN_BINARY(TYPE, FN) { WATAP_STANDARD_REG_SET(TYPE, 1, FN(WATAP_STANDARD_REG_GET(TYPE, 2), WATAP_STANDARD_REG_GET(TYPE, 3))); WATAP_STANDARD_NEXT(4) }
+
+/* Register shift operator implementation generation macro (shift count is taken by module of bit count) */
+#define WATAP_STANDARD_REG_SHIFT(TYPE, OP) { WATAP_STANDARD_REG_SET(TYPE, 1, WATAP_STANDARD_REG_GET(TYPE, 2) OP (WATAP_STANDARD_REG_GET(TYPE, 3) & (sizeof(TYPE) * 8 - 1))); WATAP_STANDARD_NEXT(4) }
+
+/* Register rotation implementation generation macro */
+#define WATAP_STANDARD_REG_ROTATE(TYPE, FN) { WATAP_STANDARD_REG_SET(TYPE, 1, FN(WATAP_STANDARD_REG_GET(TYPE, 2), static_cast<INT>(WATAP_STANDARD_REG_GET(TYPE, 3) & (sizeof(TYPE) * 8 - 1)))); WATAP_STANDARD_NEXT(4) }
+
+/* Register comparison operator implementation generation macro */
+#define WATAP_STANDARD_REG_COMPARE(TYPE, OP) { WATAP_STANDARD_REG_SET(UINT32, 1, WATAP_STANDARD_REG_GET(TYPE, 2) OP WATAP_STANDARD_REG_GET(TYPE, 3)); WATAP_STANDARD_NEXT(4) }
+
+/* Register signed division implementation generation macro (traps on zero division and overflow) */
+#define WATAP_STANDARD_REG_DIV_S(TYPE)                                                \
+{                                                                                     \
+  const TYPE Lhs = WATAP_STANDARD_REG_GET(TYPE, 2);                                   \
+  const TYPE Rhs = WATAP_STANDARD_REG_GET(TYPE, 3);                                   \
+  if (Rhs == 0 || (Rhs == -1 && Lhs == std::numeric_limits<TYPE>::min()))             \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_REG_SET(TYPE, 1, Lhs / Rhs);                                         \
+  WATAP_STANDARD_NEXT(4)                                                              \
+}
+
+/* Register signed remainder implementation generation macro (traps on zero division) */
+#define WATAP_STANDARD_REG_REM_S(TYPE)                                                \
+{                                                                                     \
+  const TYPE Lhs = WATAP_STANDARD_REG_GET(TYPE, 2);                                   \
+  const TYPE Rhs = WATAP_STANDARD_REG_GET(TYPE, 3);                                   \
+  if (Rhs == 0)                                                                       \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_REG_SET(TYPE, 1, Rhs == -1 ? 0 : Lhs % Rhs);                         \
+  WATAP_STANDARD_NEXT(4)                                                              \
+}
+
+/* Register unsigned division/remainder implementation generation macro (traps on zero division) */
+#define WATAP_STANDARD_REG_DIV_U(TYPE, OP)                                            \
+{                                                                                     \
+  const TYPE Lhs = WATAP_STANDARD_REG_GET(TYPE, 2);                                   \
+  const TYPE Rhs = WATAP_STANDARD_REG_GET(TYPE, 3);                                   \
+  if (Rhs == 0)                                                                       \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_REG_SET(TYPE, 1, Lhs OP Rhs);                                        \
+  WATAP_STANDARD_NEXT(4)                                                              \
+}
+
+/* Register unary function implementation generation macro */
+#define WATAP_STANDARD_REG_FN_UNARY(TYPE, FN) { WATAP_STANDARD_REG_SET(TYPE, 1, static_cast<TYPE>(FN(WATAP_STANDARD_REG_GET(TYPE, 2)))); WATAP_STANDARD_NEXT(3) }
+
+/* Register 'equal to zero' implementation generation macro */
+#define WATAP_STANDARD_REG_EQZ(TYPE) { WATAP_STANDARD_REG_SET(UINT32, 1, WATAP_STANDARD_REG_GET(TYPE, 2) == 0); WATAP_STANDARD_NEXT(3) }
+
+/* Register integer extend generation macro definition */
+#define WATAP_STANDARD_REG_I_EXTEND(BASE, SUB) { WATAP_STANDARD_REG_SET(BASE, 1, static_cast<BASE>(WATAP_STANDARD_REG_GET(SUB, 2))); WATAP_STANDARD_NEXT(3) }
+
+/* Register value conversion implementation generation macro */
+#define WATAP_STANDARD_REG_CAST(FROM, TO) { WATAP_STANDARD_REG_SET(TO, 1, static_cast<TO>(WATAP_STANDARD_REG_GET(FROM, 2))); WATAP_STANDARD_NEXT(3) }
+
+/* Register floating point to integer truncation implementation generation macro (traps on unrepresentable result) */
+#define WATAP_STANDARD_REG_TRUNC(FROM, TO)                                            \
+{                                                                                     \
+  const FROM Value = WATAP_STANDARD_REG_GET(FROM, 2);                                 \
+  if (!exec_util::IsTruncatable<TO>(Value))                                           \
+    WATAP_STANDARD_TRAP();                                                            \
+  WATAP_STANDARD_REG_SET(TO, 1, static_cast<TO>(Value));                              \
+  WATAP_STANDARD_NEXT(3)                                                              \
+}
+
+/* Register heap loading with builtin conversion implementaion function */
+#define WATAP_STANDARD_REG_LOAD(TYPE, FROM)                                                               \
+{                                                                                                         \
+  const UINT64 Address = static_cast<UINT64>(WATAP_STANDARD_REG_GET(UINT32, 2)) + WATAP_STANDARD_IMM_U32(3); \
+  if (Address + sizeof(FROM) > Heap.Size())                                                               \
+    WATAP_STANDARD_TRAP();                                                                                \
+  FROM Value;                                                                                             \
+  std::memcpy(&Value, Heap.Data() + Address, sizeof(FROM));                                               \
+  WATAP_STANDARD_REG_SET(TYPE, 1, static_cast<TYPE>(Value));                                              \
+  WATAP_STANDARD_NEXT(5)                                                                                  \
+}
+
+/* Register heap storing with builtin conversion implementaion function */
+#define WATAP_STANDARD_REG_STORE(TYPE, TO)                                                                \
+{                                                                                                         \
+  const UINT64 Address = static_cast<UINT64>(WATAP_STANDARD_REG_GET(UINT32, 1)) + WATAP_STANDARD_IMM_U32(3); \
+  const TO Value = static_cast<TO>(WATAP_STANDARD_REG_GET(TYPE, 2));                                      \
+  if (Address + sizeof(TO) > Heap.Size())                                                                 \
+    WATAP_STANDARD_TRAP();                                                                                \
+  std::memcpy(Heap.Data() + Address, &Value, sizeof(TO));                                                 \
+  WATAP_STANDARD_NEXT(5)                                                                                  \
+}
+
+/* Register bytecode instruction list entry implementation macro */
+#define WATAP_STANDARD_REG_INSTRUCTION(NAME, KIND, ...) WATAP_STANDARD_OP(NAME) WATAP_STANDARD_REG_##KIND(__VA_ARGS__)
+
+/* List of non-numeric instructions supported by register bytecode execution engine */
+#define WATAP_STANDARD_REG_INSTRUCTIONS(X) \
+  X(eUnreachable) X(eReturn) X(eCall) X(eSelect) X(eLocalSet) \
+  X(eMemorySize) X(eMemoryGrow) X(eI32Const) X(eI64Const)
+
+/* Instruction list entry to 'case' label conversion macro */
+#define WATAP_STANDARD_REG_CASE(NAME, ...) case bin::instruction::NAME:
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* Register bytecode instruction length (in instruction slots, operands and immediates included) getting function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       compiled_instruction Instruction;
+   * RETURNS:
+   *   (SIZE_T) Count of slots occupied by instruction;
+   */
+  SIZE_T GetRegisterInstructionLength( compiled_instruction Instruction ) noexcept
+  {
+    switch (Instruction.Instruction)
+    {
+    WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_REG_CASE)
+    case bin::instruction::eLocalSet   :
+    case bin::instruction::eMemoryGrow :
+      return 3;
+
+    WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_REG_CASE)
+    case bin::instruction::eI32Const   :
+    case bin::instruction::eCall       :
+      return 4;
+
+    WATAP_STANDARD_LOAD_INSTRUCTIONS(WATAP_STANDARD_REG_CASE)
+    WATAP_STANDARD_STORE_INSTRUCTIONS(WATAP_STANDARD_REG_CASE)
+    case bin::instruction::eSelect     :
+      return 5;
+
+    case bin::instruction::eI64Const   :
+      return 6;
+
+    case bin::instruction::eReturn     :
+    case bin::instruction::eMemorySize :
+      return 2;
+
+    default:
+      return 1;
+    }
+  } /* End of 'GetRegisterInstructionLength' function */
+
+  /* Stack bytecode to register bytecode lowering function.
+   * ARGUMENTS:
+   *   - function to lower (validated stack bytecode, linking isn't required):
+   *       compiled_function_data &Function;
+   * RETURNS:
+   *   (BOOL) TRUE if function is lowered, FALSE if function contains instructions register bytecode doesn't support (function isn't changed then);
+   */
+  BOOL source_impl::LowerToRegisters( compiled_function_data &Function ) const
+  {
+    const std::vector<compiled_instruction> &Code = Function.Instructions;
+    const SIZE_T LocalCount = Function.LocalSizes.size();
+
+    std::vector<compiled_instruction> Result; // Register bytecode
+    std::vector<UINT16> Operands;             // Slots of values on operand stack (local slot or own stack slot)
+    SIZE_T MaxDepth = 0;                      // Maximal operand stack depth
+    SIZE_T ProducerStart = SIZE_MAX;          // Start of last emitted instruction if it has destination slot operand
+
+    // Slot for operand stack position getting function
+    auto GetStackSlot = [&]( SIZE_T Depth ) -> UINT16
+      {
+        MaxDepth = std::max(MaxDepth, Depth + 1);
+        return static_cast<UINT16>(LocalCount + Depth);
+      };
+
+    auto Emit = [&]( bin::instruction Instruction, UINT8 Data = 0 )
+      {
+        Result.push_back(compiled_instruction {Instruction, Data});
+      };
+
+    auto EmitU16 = [&]( UINT16 Value )
+      {
+        Result.push_back(compiled_instruction { .InstructionID = Value });
+      };
+
+    auto EmitU32 = [&]( UINT32 Value )
+      {
+        EmitU16(static_cast<UINT16>(Value));
+        EmitU16(static_cast<UINT16>(Value >> 16));
+      };
+
+    // Destination slot emission function (value is pushed to operand stack)
+    auto EmitDestination = [&]( VOID )
+      {
+        const UINT16 Slot = GetStackSlot(Operands.size());
+
+        EmitU16(Slot);
+        Operands.push_back(Slot);
+        return Slot;
+      };
+
+    // Copy of stack position value to its own slot (for value not depending on local anymore)
+    auto Materialize = [&]( SIZE_T Depth )
+      {
+        const UINT16 Slot = GetStackSlot(Depth);
+
+        if (Operands[Depth] == Slot)
+          return;
+        Emit(bin::instruction::eLocalSet);
+        EmitU16(Slot);
+        EmitU16(Operands[Depth]);
+        Operands[Depth] = Slot;
+        ProducerStart = SIZE_MAX;
+      };
+
+    // Local writing function
+    auto SetLocal = [&]( UINT16 Local, UINT16 Src )
+      {
+        // Values that reference local must be saved before local change
+        for (SIZE_T Depth = 0; Depth < Operands.size(); Depth++)
+          if (Operands[Depth] == Local)
+            Materialize(Depth);
+
+        if (Src == Local)
+          return;
+
+        // Previous instruction result is redirected to local
+        if (Src >= LocalCount && ProducerStart != SIZE_MAX && Result[ProducerStart + 1].InstructionID == Src)
+        {
+          Result[ProducerStart + 1].InstructionID = Local;
+          return;
+        }
+
+        Emit(bin::instruction::eLocalSet);
+        EmitU16(Local);
+        EmitU16(Src);
+      };
+
+    auto Pop = [&]( VOID )
+      {
+        if (Operands.empty())
+          throw compile_status::eNoOperandsForUnary;
+        const UINT16 Slot = Operands.back();
+        Operands.pop_back();
+        return Slot;
+      };
+
+    try
+    {
+      for (SIZE_T Ip = 0; Ip < Code.size(); Ip += GetCompiledInstructionLength(Code[Ip]))
+      {
+        const bin::instruction Instruction = Code[Ip].Instruction;
+        const SIZE_T Start = Result.size();
+        const UINT32 ImmU32 = Ip + 2 < Code.size()
+          ? ReadImmediate<UINT32>(&Code[Ip + 1])
+          : 0;
+        BOOL IsProducer = TRUE;
+
+        switch (Instruction)
+        {
+        case bin::instruction::eNop:
+          IsProducer = FALSE;
+          break;
+
+        case bin::instruction::eUnreachable:
+          Emit(Instruction);
+          IsProducer = FALSE;
+          break;
+
+        case bin::instruction::eReturn:
+          Emit(Instruction, Function.ReturnSize != 0);
+          EmitU16(Function.ReturnSize != 0 ? Operands.at(Operands.size() - 1) : 0);
+          IsProducer = FALSE;
+          break;
+
+        case bin::instruction::eDrop:
+          Pop();
+          IsProducer = FALSE;
+          break;
+
+        case bin::instruction::eLocalGet:
+          Operands.push_back(Code[Ip + 1].InstructionID);
+          IsProducer = FALSE;
+          break;
+
+        case bin::instruction::eLocalSet:
+          SetLocal(Code[Ip + 1].InstructionID, Pop());
+          IsProducer = FALSE;
+          break;
+
+        case bin::instruction::eLocalTee:
+          SetLocal(Code[Ip + 1].InstructionID, Operands.at(Operands.size() - 1));
+          Operands.back() = Code[Ip + 1].InstructionID;
+          IsProducer = FALSE;
+          break;
+
+        case bin::instruction::eI32Const:
+        case bin::instruction::eF32Const:
+        case bin::instruction::eRefFunc:
+          Emit(bin::instruction::eI32Const);
+          EmitDestination();
+          EmitU32(Instruction == bin::instruction::eRefFunc ? ImmU32 + 1 : ImmU32);
+          break;
+
+        case bin::instruction::eRefNull:
+          Emit(bin::instruction::eI32Const);
+          EmitDestination();
+          EmitU32(0);
+          break;
+
+        case bin::instruction::eI64Const:
+        case bin::instruction::eF64Const:
+          Emit(bin::instruction::eI64Const);
+          EmitDestination();
+          for (SIZE_T i = 1; i <= 4; i++)
+            EmitU16(Code[Ip + i].InstructionID);
+          break;
+
+        case bin::instruction::eSelect:
+          {
+            const UINT16 Condition = Pop();
+            const UINT16 Rhs = Pop();
+            const UINT16 Lhs = Pop();
+
+            Emit(Instruction);
+            EmitDestination();
+            EmitU16(Lhs);
+            EmitU16(Rhs);
+            EmitU16(Condition);
+            break;
+          }
+
+        case bin::instruction::eMemorySize:
+          Emit(Instruction);
+          EmitDestination();
+          break;
+
+        case bin::instruction::eMemoryGrow:
+          {
+            const UINT16 Delta = Pop();
+
+            Emit(Instruction);
+            EmitDestination();
+            EmitU16(Delta);
+            break;
+          }
+
+        case bin::instruction::eCall:
+          {
+            const function_signature &Signature = FunctionSignatures[FunctionSignatureIndices[ImmU32]];
+            const SIZE_T ArgumentCount = Signature.ArgumentTypes.size();
+
+            if (Operands.size() < ArgumentCount)
+              throw compile_status::eNoFunctionArguments;
+
+            // Arguments must occupy consecutive slots
+            const SIZE_T Base = Operands.size() - ArgumentCount;
+            for (SIZE_T Depth = Base; Depth < Operands.size(); Depth++)
+              Materialize(Depth);
+            Operands.resize(Base);
+
+            const UINT16 BaseSlot = GetStackSlot(Base);
+            Emit(Instruction);
+            EmitU32(ImmU32);
+            EmitU16(BaseSlot);
+            if (Signature.ReturnType)
+              Operands.push_back(BaseSlot);
+            IsProducer = FALSE;
+            break;
+          }
+
+        WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_REG_CASE)
+          {
+            const UINT16 Src = Pop();
+
+            Emit(Instruction);
+            EmitDestination();
+            EmitU16(Src);
+            break;
+          }
+
+        WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_REG_CASE)
+          {
+            const UINT16 Rhs = Pop();
+            const UINT16 Lhs = Pop();
+
+            Emit(Instruction);
+            EmitDestination();
+            EmitU16(Lhs);
+            EmitU16(Rhs);
+            break;
+          }
+
+        WATAP_STANDARD_LOAD_INSTRUCTIONS(WATAP_STANDARD_REG_CASE)
+          {
+            const UINT16 Address = Pop();
+
+            Emit(Instruction);
+            EmitDestination();
+            EmitU16(Address);
+            EmitU32(ImmU32);
+            break;
+          }
+
+        WATAP_STANDARD_STORE_INSTRUCTIONS(WATAP_STANDARD_REG_CASE)
+          {
+            const UINT16 Value = Pop();
+            const UINT16 Address = Pop();
+
+            Emit(Instruction);
+            EmitU16(Address);
+            EmitU16(Value);
+            EmitU32(ImmU32);
+            IsProducer = FALSE;
+            break;
+          }
+
+        default:
+          // Instruction isn't supported by register bytecode
+          return FALSE;
+        }
+
+        ProducerStart = IsProducer ? Start : SIZE_MAX;
+      }
+    }
+    catch (...)
+    {
+      return FALSE;
+    }
+
+    if (LocalCount + MaxDepth > 0xFFFF)
+      return FALSE;
+
+    Function.Instructions = std::move(Result);
+    Function.Bytecode = bytecode_type::eRegister;
+    Function.FrameSlotCount = static_cast<UINT32>(LocalCount + MaxDepth);
+    return TRUE;
+  } /* End of 'LowerToRegisters' function */
+
+  /* Register bytecode function execution function (executes functions from call stack top until call stack shrinks below initial size).
+   * TEMPLATE ARGUMENTS:
+   *   - instruction dispatch technique:
+   *       dispatch_type DISPATCH;
+   * ARGUMENTS:
+   *   - instance to execute code of (nullptr if handler table requested only):
+   *       instance_impl *Instance;
+   *   - handler table (256 entries, indexed by instruction) output pointer, not nullptr only if requested:
+   *       const VOID *const **HandlerTable;
+   * RETURNS:
+   *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+   */
+  template <dispatch_type DISPATCH>
+    BOOL instance_impl::ExecuteRegister( instance_impl *Instance, const VOID *const **HandlerTable )
+    {
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+      WATAP_STANDARD_HANDLER_TABLE(
+        WATAP_STANDARD_REG_INSTRUCTIONS(WATAP_STANDARD_HANDLER_TABLE_ENTRY)
+        WATAP_STANDARD_NUMERIC_INSTRUCTIONS(WATAP_STANDARD_HANDLER_TABLE_ENTRY)
+      )
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+      const source_impl &Source = Instance->Source;
+      local_stack &LocalStack = Instance->LocalStack;
+      local_stack &EvaluationStack = Instance->EvaluationStack;
+      linear_memory &Heap = Instance->Heap;
+      fixed_stack<call> &CallStack = Instance->CallStack;
+      const SIZE_T RootDepth = CallStack.Size();
+
+      const compiled_function_data *Function;   // Current function
+      const compiled_instruction *Code;         // Current function code
+      const VOID *const *Handlers;              // Current function handlers
+      SIZE_T Ip;                                // Instruction pointer (index)
+      UINT64 *Frame;                            // Local variable frame
+
+      // Execution state by call stack top loading
+      auto LoadState = [&]( VOID )
+        {
+          const call &Call = CallStack.Top();
+
+          Function = &std::get<compiled_function_data>(Source.Functions[Call.FunctionIndex]);
+          Code = Function->Instructions.data();
+          Handlers = Function->Handlers.data();
+          Ip = Call.InstructionIndex;
+          Frame = LocalStack.Get<UINT64>() - Function->FrameSlotCount;
+        };
+
+      LoadState();
+
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+      if constexpr (DISPATCH == dispatch_type::eThreaded)
+        goto *Handlers[Ip];
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+
+      while (TRUE)
+      {
+        switch (static_cast<UINT8>(Code[Ip].Instruction))
+        {
+        WATAP_STANDARD_OP(eUnreachable)
+          WATAP_STANDARD_TRAP();
+
+        WATAP_STANDARD_OP(eReturn)
+          {
+            const UINT64 Value = Frame[WATAP_STANDARD_IMM_U16(1)];
+            const SIZE_T ReturnSize = Function->ReturnSize;
+
+            LocalStack.Pop(CallStack.Top().LocalStackFrameSize);
+            CallStack.Pop();
+
+            // Return to another engine, result is passed by evaluation stack
+            if (CallStack.Size() < RootDepth)
+            {
+              Instance->PushValue(&Value, ReturnSize);
+              return TRUE;
+            }
+
+            // Return to call instruction
+            LoadState();
+            if (ReturnSize != 0)
+              Frame[WATAP_STANDARD_IMM_U16(3)] = Value;
+            WATAP_STANDARD_NEXT(4)
+          }
+
+        WATAP_STANDARD_OP(eCall)
+          {
+            const UINT32 FunctionIndex = WATAP_STANDARD_IMM_U32(1);
+            const UINT16 Base = WATAP_STANDARD_IMM_U16(3);
+            const compiled_function_data *Callee = Source.GetFunction(FunctionIndex);
+
+            if (Callee == nullptr)
+              WATAP_STANDARD_TRAP();
+
+            CallStack.Top().InstructionIndex = Ip;
+
+            if (Callee->Bytecode == bytecode_type::eRegister && Callee->OptimizedEntry == nullptr)
+            {
+              Instance->CountCall(FunctionIndex);
+
+              const SIZE_T FrameSize = Callee->FrameSlotCount * sizeof(UINT64);
+              const SIZE_T CallerSlotCount = Function->FrameSlotCount;
+              UINT64 *CalleeFrame = LocalStack.Push<UINT64>(FrameSize) - Callee->FrameSlotCount;
+              const UINT64 *Arguments = CalleeFrame - CallerSlotCount + Base; // Caller frame may be moved by push
+
+              std::memset(CalleeFrame, 0, FrameSize);
+              std::memcpy(CalleeFrame, Arguments, Callee->ArgumentCount * sizeof(UINT64));
+
+              if (!CallStack.Push(call {
+                .FunctionIndex = FunctionIndex,
+                .InstructionIndex = 0,
+                .LocalStackFrameSize = FrameSize,
+                .EvaluationStackBase = EvaluationStack.Size(),
+              }))
+                WATAP_STANDARD_TRAP();
+              LoadState();
+              WATAP_STANDARD_NEXT(0)
+            }
+
+            // Callee of another bytecode format is executed by its own engine
+            for (UINT32 i = 0; i < Callee->ArgumentCount; i++)
+              Instance->PushValue(Frame + Base + i, Callee->LocalSizes[i]);
+            if (Instance->PushCall(FunctionIndex) == nullptr)
+              WATAP_STANDARD_TRAP();
+            if (!ExecuteTop<DISPATCH>(Instance, *Callee))
+              return FALSE;
+
+            LoadState();
+            Instance->PopValue(Frame + Base, Callee->ReturnSize);
+            WATAP_STANDARD_NEXT(4)
+          }
+
+        WATAP_STANDARD_OP(eSelect)
+          Frame[WATAP_STANDARD_IMM_U16(1)] = WATAP_STANDARD_REG_GET(UINT32, 4) != 0
+            ? Frame[WATAP_STANDARD_IMM_U16(2)]
+            : Frame[WATAP_STANDARD_IMM_U16(3)];
+          WATAP_STANDARD_NEXT(5)
+
+        WATAP_STANDARD_OP(eLocalSet)
+          Frame[WATAP_STANDARD_IMM_U16(1)] = Frame[WATAP_STANDARD_IMM_U16(2)];
+          WATAP_STANDARD_NEXT(3)
+
+        WATAP_STANDARD_OP(eMemorySize)
+          WATAP_STANDARD_REG_SET(UINT32, 1, static_cast<UINT32>(Heap.Size() / 65536));
+          WATAP_STANDARD_NEXT(2)
+
+        WATAP_STANDARD_OP(eMemoryGrow)
+          WATAP_STANDARD_REG_SET(UINT32, 1, Instance->GrowMemory(WATAP_STANDARD_REG_GET(UINT32, 2)));
+          WATAP_STANDARD_NEXT(3)
+
+        WATAP_STANDARD_OP(eI32Const)
+          WATAP_STANDARD_REG_SET(UINT32, 1, WATAP_STANDARD_IMM_U32(2));
+          WATAP_STANDARD_NEXT(4)
+
+        WATAP_STANDARD_OP(eI64Const)
+          WATAP_STANDARD_REG_SET(UINT64, 1, WATAP_STANDARD_IMM_U64(2));
+          WATAP_STANDARD_NEXT(6)
+
+        WATAP_STANDARD_NUMERIC_INSTRUCTIONS(WATAP_STANDARD_REG_INSTRUCTION)
+
+        default:
+#if defined(WATAP_STANDARD_THREADED_DISPATCH)
+        L_Invalid:
+#endif // defined(WATAP_STANDARD_THREADED_DISPATCH)
+          // Lowering emitted instruction that isn't supported by execution engine
+          WATAP_STANDARD_TRAP();
+        }
+      }
+    } /* End of 'ExecuteRegister' function */
+
+  /* Engine instantiations, engines are referenced from other bytecode format engines */
+  template BOOL instance_impl::ExecuteRegister<dispatch_type::eSwitch>( instance_impl *, const VOID *const ** );
+  template BOOL instance_impl::ExecuteRegister<dispatch_type::eThreaded>( instance_impl *, const VOID *const ** );
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_register.cpp' FILE */
@@ -2,6 +2,8 @@
 
 #include "watap_impl_standard_interface.h"
 
+#include <algorithm>
+
 namespace watap::impl::standard
 {
   struct compilation_context
@@ -684,6 +686,230 @@ namespace watap::impl::standard
     } /* Block compilation function */
   }; /* End of 'CompileBlock' function */
 
+  /* Validation type stack representation class */
+  class type_stack : public std::stack<bin::value_type, std::vector<bin::value_type>>
+  {
+    SIZE_T MaxHeight = 0; // Maximal stack height reached
+
+  public:
+    /* Type pushing function (maximal stack height is tracked).
+     * ARGUMENTS:
+     *   - type to push:
+     *       bin::value_type Type;
+     * RETURNS: None.
+     */
+    VOID push( bin::value_type Type )
+    {
+      c.push_back(Type);
+      MaxHeight = std::max(MaxHeight, c.size());
+    } /* End of 'push' function */
+
+    /* Values, pushed by compiler-emitted sequence above stack top, accounting function.
+     * ARGUMENTS:
+     *   - count of values, sequence pushes above current stack top at most:
+     *       SIZE_T Count;
+     * RETURNS: None.
+     */
+    VOID AccountTemporaries( SIZE_T Count ) noexcept
+    {
+      MaxHeight = std::max(MaxHeight, c.size() + Count);
+    } /* End of 'AccountTemporaries' function */
+
+    /* Maximal stack height getting function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (SIZE_T) Maximal count of values, that were on stack at once;
+     */
+    SIZE_T GetMaxHeight( VOID ) const noexcept
+    {
+      return MaxHeight;
+    } /* End of 'GetMaxHeight' function */
+
+    /* Stack top types checking function.
+     * ARGUMENTS:
+     *   - types that must be on stack top (last type is top one):
+     *       std::span<const bin::value_type> Types;
+     *   - stack height that values must be above of:
+     *       SIZE_T Height;
+     * RETURNS:
+     *   (BOOL) TRUE if stack top values are of required types;
+     */
+    BOOL IsTop( std::span<const bin::value_type> Types, SIZE_T Height ) const noexcept
+    {
+      if (c.size() < Height + Types.size())
+        return FALSE;
+      return std::equal(Types.begin(), Types.end(), c.end() - Types.size());
+    } /* End of 'IsTop' function */
+
+    /* Stack truncation function.
+     * ARGUMENTS:
+     *   - height to truncate stack to:
+     *       SIZE_T Height;
+     * RETURNS: None.
+     */
+    VOID Truncate( SIZE_T Height ) noexcept
+    {
+      c.resize(std::min(Height, c.size()));
+    } /* End of 'Truncate' function */
+  }; /* End of 'type_stack' class */
+
+  /* Structured control flow frame (block, loop, if or function body) representation structure */
+  struct control_frame
+  {
+    bin::instruction Instruction;               // Frame opening instruction (eElse after 'else' in 'if' frame)
+    std::vector<bin::value_type> ParamTypes;    // Types of values consumed by frame
+    std::vector<bin::value_type> ResultTypes;   // Types of values produced by frame
+    SIZE_T Height = 0;                          // Type stack height at frame start (parameters excluded)
+    UINT32 LoopIp = 0;                          // Index of loop start instruction (branch target of 'loop' frame)
+    UINT32 ElseTarget = ~0U;                    // Branch target of 'if' condition failure
+    std::vector<UINT32> EndTargets;             // Branch targets, that are resolved to frame end
+    BOOL IsUnreachable = FALSE;                 // Is rest of frame unreachable (code is skipped until 'else' or 'end')
+  }; /* End of 'control_frame' structure */
+
+  /* Maximal depth of inlined calls (calls in inlined function bodies are inlined too) */
+  #define WATAP_STANDARD_INLINE_DEPTH 4
+
+  /* Function body compilation context (compiled function or function, inlined into it) representation structure */
+  struct inline_context
+  {
+    UINT32 FunctionIndex;             // Index of function, body of which is compiled
+    const UINT8 *InstructionPointer;  // Caller instruction pointer to continue compilation from after body end (inlined function only)
+    const UINT8 *InstructionEnd;      // Caller code end (inlined function only)
+    SIZE_T FrameIndex;                // Index of body control frame
+    UINT32 LocalBase;                 // Index of the first function local in compiled function frame
+    UINT32 LocalCount;                // Count of function locals (arguments included)
+  }; /* End of 'inline_context' structure */
+
+  /* Function local variable types parsing function.
+   * ARGUMENTS:
+   *   - function code stream (local declarations are skipped):
+   *       binary_input_stream &Stream;
+   *   - types to append local variable types (arguments excluded) to:
+   *       std::vector<bin::value_type> &LocalTypes;
+   * RETURNS:
+   *   (BOOL) TRUE if local declarations are parsed, FALSE otherwise;
+   */
+  static BOOL ParseLocalTypes( binary_input_stream &Stream, std::vector<bin::value_type> &LocalTypes )
+  {
+    UINT32 LocalBatchCount = 0;
+    WATAP_SET_OR_RETURN(LocalBatchCount, bin_util::ParseUint(Stream), FALSE);
+    while (LocalBatchCount--)
+    {
+      UINT32 BatchSize = 0;
+      WATAP_SET_OR_RETURN(BatchSize, bin_util::ParseUint(Stream), FALSE);
+
+      bin::value_type ValueType = bin::value_type::eI32;
+      WATAP_SET_OR_RETURN(ValueType, Stream.Get<bin::value_type>(), FALSE);
+
+      while (BatchSize--)
+        LocalTypes.push_back(ValueType);
+    }
+    return TRUE;
+  } /* End of 'ParseLocalTypes' function */
+
+  /* Instruction immediates skipping function (used for unreachable code, that isn't compiled).
+   * ARGUMENTS:
+   *   - pointer to instruction immediates:
+   *       const UINT8 *InstructionPointer;
+   *   - instruction:
+   *       bin::instruction Instruction;
+   * RETURNS:
+   *   (const UINT8 *) Pointer to next instruction;
+   */
+  static const UINT8 * SkipImmediates( const UINT8 *InstructionPointer, bin::instruction Instruction )
+  {
+    auto SkipLeb = [&]( VOID )
+      {
+        while (*InstructionPointer++ & 0x80)
+          ;
+      };
+
+    switch (Instruction)
+    {
+    case bin::instruction::eBlock       :
+    case bin::instruction::eLoop        :
+    case bin::instruction::eIf          :
+    case bin::instruction::eBr          :
+    case bin::instruction::eBrIf        :
+    case bin::instruction::eCall        :
+    case bin::instruction::eReturnCall  :
+    case bin::instruction::eLocalGet    :
+    case bin::instruction::eLocalSet    :
+    case bin::instruction::eLocalTee    :
+    case bin::instruction::eGlobalGet   :
+    case bin::instruction::eGlobalSet   :
+    case bin::instruction::eTableGet    :
+    case bin::instruction::eTableSet    :
+    case bin::instruction::eI32Const    :
+    case bin::instruction::eI64Const    :
+    case bin::instruction::eRefFunc     :
+      SkipLeb();
+      break;
+
+    case bin::instruction::eBrTable     :
+      {
+        auto [Count, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+        InstructionPointer += Offset;
+        for (SIZE_T i = 0; i <= Count; i++)
+          SkipLeb();
+        break;
+      }
+
+    case bin::instruction::eCallIndirect      :
+    case bin::instruction::eReturnCallIndirect:
+      SkipLeb();
+      SkipLeb();
+      break;
+
+    case bin::instruction::eSelectTyped :
+      {
+        auto [Count, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+        InstructionPointer += Offset + Count;
+        break;
+      }
+
+    case bin::instruction::eMemorySize  :
+    case bin::instruction::eMemoryGrow  :
+    case bin::instruction::eRefNull     :
+      InstructionPointer += 1;
+      break;
+
+    case bin::instruction::eF32Const    : InstructionPointer += 4; break;
+    case bin::instruction::eF64Const    : InstructionPointer += 8; break;
+
+    // Bulk memory instructions have data segment index and memory index immediates
+    case bin::instruction::eSystem      :
+      {
+        auto [SystemInstruction, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+        InstructionPointer += Offset;
+
+        switch (static_cast<bin::system_instruction>(SystemInstruction))
+        {
+        case bin::system_instruction::eMemoryInit : SkipLeb(); InstructionPointer += 1; break;
+        case bin::system_instruction::eDataDrop   : SkipLeb();                          break;
+        case bin::system_instruction::eMemoryCopy : InstructionPointer += 2;            break;
+        case bin::system_instruction::eMemoryFill : InstructionPointer += 1;            break;
+        default                                   : throw compile_status::eUnsupportedFeature;
+        }
+        break;
+      }
+
+    case bin::instruction::eVector      :
+      throw compile_status::eUnsupportedFeature;
+
+    default:
+      // Memory access instructions have alignment and offset immediates
+      if (Instruction >= bin::instruction::eI32Load && Instruction <= bin::instruction::eI64Store32)
+      {
+        SkipLeb();
+        SkipLeb();
+      }
+      break;
+    }
+
+    return InstructionPointer;
+  } /* End of 'SkipImmediates' function */
+
   /* Just in time compilation function.
    * ARGUMENTS:
    *   - function to compile index:
@@ -698,7 +924,7 @@ namespace watap::impl::standard
     if (RawData == nullptr)
       return compile_status::eOk;
 
-    std::stack<bin::value_type> TypeStack;
+    type_stack TypeStack;
 
     auto &Signature = FunctionSignatures[RawData->SignatureIndex];
 
@@ -714,21 +940,8 @@ namespace watap::impl::standard
     std::vector<UINT32> LocalSizes;                 // Sizes of arguments
 
     // Parse local batches
-    {
-      UINT32 LocalBatchCount = 0;
-      WATAP_SET_OR_RETURN(LocalBatchCount, bin_util::ParseUint(Stream), compile_status::eLocalParsingError);
-      while (LocalBatchCount--)
-      {
-        UINT32 BatchSize = 0;
-        WATAP_SET_OR_RETURN(BatchSize, bin_util::ParseUint(Stream), compile_status::eLocalParsingError);
-
-        bin::value_type ValueType = bin::value_type::eI32;
-        WATAP_SET_OR_RETURN(ValueType, Stream.Get<bin::value_type>(), compile_status::eLocalParsingError);
-
-        while (BatchSize--)
-          LocalTypes.push_back(ValueType);
-      }
-    }
+    if (!ParseLocalTypes(Stream, LocalTypes))
+      return compile_status::eLocalParsingError;
 
     for (auto LocalType : LocalTypes)
       Function.LocalSizes.push_back(static_cast<UINT32>(bin::GetValueTypeSize(LocalType)));
@@ -737,8 +950,8 @@ namespace watap::impl::standard
 
     // Parse actual instructions
 
-    const UINT8 *InstructionPointer = RawData->Instructions.data();
-    const UINT8 *InstructionEnd = InstructionPointer + RawData->Instructions.size();
+    const UINT8 *InstructionPointer = Stream.CurrentPtr();
+    const UINT8 *InstructionEnd = RawData->Instructions.data() + RawData->Instructions.size();
 
     auto PassInstruction = [&]( bin::instruction Instruction, UINT8 AdditionalData = 0 )
       {
@@ -764,6 +977,15 @@ namespace watap::impl::standard
         Function.Instructions.push_back(compiled_instruction { .InstructionID = static_cast<UINT16>(Constant >> 48) });
       };
 
+    // Control frame stack, function body is the outermost block
+    std::vector<control_frame> Frames;
+
+    // Count of operands, current frame can pop (values below frame height belong to enclosing frames)
+    auto GetOperandCount = [&]( VOID ) -> SIZE_T
+      {
+        return TypeStack.size() - Frames.back().Height;
+      };
+
     auto CheckType = [&]( bin::value_type Type ) -> BOOL
       {
         return TypeStack.top() == Type;
@@ -771,7 +993,7 @@ namespace watap::impl::standard
 
     auto UnaryOperator = [&]( bin::instruction Instruction, bin::value_type SrcType, bin::value_type DstType )
       {
-        if (TypeStack.empty())
+        if (GetOperandCount() == 0)
           throw compile_status::eNoOperandsForUnary;
 
         if (TypeStack.top() != SrcType)
@@ -783,7 +1005,7 @@ namespace watap::impl::standard
 
     auto UnaryOperatorNoAdd = [&]( bin::value_type SrcType, bin::value_type DstType )
       {
-        if (TypeStack.empty())
+        if (GetOperandCount() == 0)
           throw compile_status::eNoOperandsForUnary;
 
         if (TypeStack.top() != SrcType)
@@ -795,7 +1017,7 @@ namespace watap::impl::standard
 
     auto BinaryOperator = [&]( bin::instruction Instruction, bin::value_type LhsType, bin::value_type RhsType, bin::value_type DstType )
       {
-        if (TypeStack.size() < 2)
+        if (GetOperandCount() < 2)
           throw compile_status::eNoOperandsForBinary;
 
         if (TypeStack.top() != LhsType)
@@ -810,6 +1032,170 @@ namespace watap::impl::standard
         Function.Instructions.push_back(compiled_instruction {Instruction});
       };
 
+    SIZE_T UnreachableDepth = 0; // Count of blocks opened in skipped unreachable code
+    std::optional<UINT16> ScratchLocal; // Hidden local for 'br_table' operand (linear scan lowering only)
+
+    Frames.push_back(control_frame { .Instruction = bin::instruction::eBlock });
+    if (Signature.ReturnType)
+      Frames.back().ResultTypes.push_back(*Signature.ReturnType);
+
+    // Compiled function body context, inlined function contexts are pushed on top of it
+    std::vector<inline_context> Contexts;
+
+    Contexts.push_back(inline_context {
+      .FunctionIndex = FunctionIndex,
+      .InstructionPointer = nullptr,
+      .InstructionEnd = nullptr,
+      .FrameIndex = 0,
+      .LocalBase = 0,
+      .LocalCount = static_cast<UINT32>(LocalTypes.size()),
+    });
+
+    // Block type parsing function (frame types are set)
+    auto ParseBlockType = [&]( control_frame &Frame )
+      {
+        const UINT8 Type = *InstructionPointer;
+
+        if (Type == 0x40)
+          InstructionPointer += 1;
+        else if (bin::GetValueTypeSize(static_cast<bin::value_type>(Type)) != 0)
+        {
+          Frame.ResultTypes.push_back(static_cast<bin::value_type>(Type));
+          InstructionPointer += 1;
+        }
+        else
+        {
+          auto [TypeIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+          InstructionPointer += Offset;
+
+          if (TypeIndex >= FunctionSignatures.size())
+            throw compile_status::eInvalidBlockType;
+          Frame.ParamTypes = FunctionSignatures[TypeIndex].ArgumentTypes;
+          if (auto ReturnType = FunctionSignatures[TypeIndex].ReturnType)
+            Frame.ResultTypes.push_back(*ReturnType);
+        }
+      };
+
+    // Branch target creation function (label values must be on stack top)
+    auto AddBranchTarget = [&]( SIZE_T Depth ) -> UINT32
+      {
+        if (Depth >= Frames.size())
+          throw compile_status::eInvalidLabelIndex;
+
+        control_frame &Frame = Frames[Frames.size() - 1 - Depth];
+        const std::vector<bin::value_type> &LabelTypes = Frame.Instruction == bin::instruction::eLoop ? Frame.ParamTypes : Frame.ResultTypes;
+
+        if (!TypeStack.IsTop(LabelTypes, Frames.back().Height))
+          throw compile_status::eNoOperandsForBranch;
+
+        const UINT32 Target = static_cast<UINT32>(Function.BranchTargets.size());
+
+        Function.BranchTargets.push_back(branch_target {
+          .Ip = Frame.LoopIp,
+          .DropCount = static_cast<UINT32>(TypeStack.size() - Frame.Height - LabelTypes.size()),
+          .KeepCount = static_cast<UINT32>(LabelTypes.size()),
+        });
+        if (Frame.Instruction != bin::instruction::eLoop)
+          Frame.EndTargets.push_back(Target);
+        return Target;
+      };
+
+    // Call inlining function (callee arguments are moved to callee locals, appended to frame, callee body is compiled as block), returns FALSE if call isn't inlined
+    auto InlineCall = [&]( UINT32 CalleeIndex, const function_signature &CallSignature ) -> BOOL
+      {
+        if (Contexts.size() > WATAP_STANDARD_INLINE_DEPTH)
+          return FALSE;
+
+        // Recursive calls aren't inlined
+        for (const inline_context &Context : Contexts)
+          if (Context.FunctionIndex == CalleeIndex)
+            return FALSE;
+
+        const raw_function_data *Callee = GetInlineBody(CalleeIndex);
+
+        if (Callee == nullptr)
+          return FALSE;
+
+        binary_input_stream CalleeStream {Callee->Instructions};
+        std::vector<bin::value_type> CalleeLocalTypes = CallSignature.ArgumentTypes;
+
+        if (!ParseLocalTypes(CalleeStream, CalleeLocalTypes) || LocalTypes.size() + CalleeLocalTypes.size() > 0x10000)
+          return FALSE;
+        for (bin::value_type Type : CalleeLocalTypes)
+          if (Type != bin::value_type::eI32 && Type != bin::value_type::eI64 && Type != bin::value_type::eF32 && Type != bin::value_type::eF64)
+            return FALSE;
+
+        const UINT32 LocalBase = static_cast<UINT32>(LocalTypes.size());
+
+        for (bin::value_type Type : CalleeLocalTypes)
+        {
+          LocalTypes.push_back(Type);
+          Function.LocalSizes.push_back(static_cast<UINT32>(bin::GetValueTypeSize(Type)));
+        }
+
+        // Arguments are taken from stack top in reverse order, other locals are reset, as inlined body may be executed many times by one call
+        TypeStack.AccountTemporaries(1);
+        for (SIZE_T i = CallSignature.ArgumentTypes.size(); i-- > 0; )
+        {
+          PassInstruction(bin::instruction::eLocalSet, static_cast<UINT8>(Function.LocalSizes[LocalBase + i]));
+          PassU16(static_cast<UINT16>(LocalBase + i));
+        }
+        for (SIZE_T i = CallSignature.ArgumentTypes.size(); i < CalleeLocalTypes.size(); i++)
+        {
+          if (Function.LocalSizes[LocalBase + i] == sizeof(UINT32))
+          {
+            PassInstruction(bin::instruction::eI32Const);
+            PassU32(0);
+          }
+          else
+          {
+            PassInstruction(bin::instruction::eI64Const);
+            PassU64(0);
+          }
+          PassInstruction(bin::instruction::eLocalSet, static_cast<UINT8>(Function.LocalSizes[LocalBase + i]));
+          PassU16(static_cast<UINT16>(LocalBase + i));
+        }
+
+        control_frame Frame { .Instruction = bin::instruction::eBlock, .Height = TypeStack.size() };
+        if (CallSignature.ReturnType)
+          Frame.ResultTypes.push_back(*CallSignature.ReturnType);
+
+        Contexts.push_back(inline_context {
+          .FunctionIndex = CalleeIndex,
+          .InstructionPointer = InstructionPointer,
+          .InstructionEnd = InstructionEnd,
+          .FrameIndex = Frames.size(),
+          .LocalBase = LocalBase,
+          .LocalCount = static_cast<UINT32>(CalleeLocalTypes.size()),
+        });
+        Frames.push_back(std::move(Frame));
+
+        InstructionPointer = CalleeStream.CurrentPtr();
+        InstructionEnd = Callee->Instructions.data() + Callee->Instructions.size();
+
+        if (OptimizationReport != nullptr)
+          OptimizationReport->InlinedFunctions[FunctionIndex].push_back(CalleeIndex);
+        return TRUE;
+      };
+
+    // Rest of current frame unreachability marking function
+    auto SetUnreachable = [&]( VOID )
+      {
+        Frames.back().IsUnreachable = TRUE;
+        TypeStack.Truncate(Frames.back().Height);
+      };
+
+    // Frame end validation function (frame results must be on stack)
+    auto CheckFrameResults = [&]( const control_frame &Frame )
+      {
+        if (Frame.IsUnreachable)
+          return;
+        if (!TypeStack.IsTop(Frame.ResultTypes, Frame.Height))
+          throw compile_status::eInvalidOperandType;
+        if (TypeStack.size() != Frame.Height + Frame.ResultTypes.size())
+          throw compile_status::eStackNotEmpty;
+      };
+
     while (InstructionPointer < InstructionEnd)
     {
       bin::instruction Instruction = *reinterpret_cast<const bin::instruction *>(InstructionPointer);
@@ -818,65 +1204,340 @@ namespace watap::impl::standard
 
       try
       {
+        if (Frames.empty())
+          throw compile_status::eUnbalancedBlocks;
+
+        // Unreachable code is skipped until end of current frame
+        if (Frames.back().IsUnreachable)
+        {
+          if (Instruction == bin::instruction::eBlock || Instruction == bin::instruction::eLoop || Instruction == bin::instruction::eIf)
+            UnreachableDepth++;
+          else if (Instruction == bin::instruction::eExpressionEnd && UnreachableDepth > 0)
+          {
+            UnreachableDepth--;
+            continue;
+          }
+
+          if (UnreachableDepth > 0 || (Instruction != bin::instruction::eExpressionEnd && Instruction != bin::instruction::eElse))
+          {
+            InstructionPointer = SkipImmediates(InstructionPointer, Instruction);
+            continue;
+          }
+        }
+
         switch (Instruction)
         {
-        case bin::instruction::eUnreachable   :
         case bin::instruction::eNop           :
+          PassInstruction(Instruction);
+          break;
+
+        case bin::instruction::eUnreachable   :
+          PassInstruction(Instruction);
+          SetUnreachable();
+          break;
+
         case bin::instruction::eReturn        :
+          // Inlined function returns by branch to its body end
+          if (Contexts.size() > 1)
+          {
+            const UINT32 Target = AddBranchTarget(Frames.size() - 1 - Contexts.back().FrameIndex);
+
+            PassInstruction(bin::instruction::eBr);
+            PassU32(Target);
+            SetUnreachable();
+            break;
+          }
+          if (Signature.ReturnType && (GetOperandCount() == 0 || TypeStack.top() != *Signature.ReturnType))
+            throw compile_status::eWrongReturnValueType;
           PassInstruction(Instruction);
+          SetUnreachable();
           break;
 
-        case bin::instruction::eMemoryGrow    :
         case bin::instruction::eMemorySize    :
+          InstructionPointer += 1; // Memory index, always 0
           PassInstruction(Instruction);
           TypeStack.push(bin::value_type::eI32);
           break;
 
-        // TODO TC4 WASM
+        case bin::instruction::eMemoryGrow    :
+          InstructionPointer += 1; // Memory index, always 0
+          UnaryOperator(Instruction, bin::value_type::eI32, bin::value_type::eI32);
+          break;
+
+        // Blocks emit no code, branches to them are resolved at frame end ('loop' branches are resolved to frame start)
         case bin::instruction::eBlock         :
         case bin::instruction::eLoop          :
         case bin::instruction::eIf            :
+          {
+            control_frame Frame { .Instruction = Instruction };
+            ParseBlockType(Frame);
+
+            if (Instruction == bin::instruction::eIf)
+            {
+              if (TypeStack.size() <= Frames.back().Height || TypeStack.top() != bin::value_type::eI32)
+                throw compile_status::eInvalidOperandType;
+              TypeStack.pop();
+            }
+
+            if (!TypeStack.IsTop(Frame.ParamTypes, Frames.back().Height))
+              throw compile_status::eInvalidOperandType;
+            Frame.Height = TypeStack.size() - Frame.ParamTypes.size();
+            Frame.LoopIp = static_cast<UINT32>(Function.Instructions.size());
+
+            // 'if' jumps to 'else' branch (or frame end) if condition is zero
+            if (Instruction == bin::instruction::eIf)
+            {
+              Frame.ElseTarget = static_cast<UINT32>(Function.BranchTargets.size());
+              Function.BranchTargets.push_back(branch_target {});
+              PassInstruction(bin::instruction::eIf);
+              PassU32(Frame.ElseTarget);
+            }
+
+            Frames.push_back(std::move(Frame));
+            break;
+          }
+
         case bin::instruction::eElse          :
+          {
+            control_frame &Frame = Frames.back();
+
+            if (Frame.Instruction != bin::instruction::eIf)
+              throw compile_status::eUnexpectedElse;
+            CheckFrameResults(Frame);
+
+            // 'then' branch jumps over 'else' one
+            if (!Frame.IsUnreachable)
+            {
+              const UINT32 Target = AddBranchTarget(0);
+
+              PassInstruction(bin::instruction::eBr);
+              PassU32(Target);
+            }
+
+            Function.BranchTargets[Frame.ElseTarget].Ip = static_cast<UINT32>(Function.Instructions.size());
+            Frame.Instruction = bin::instruction::eElse;
+            Frame.IsUnreachable = FALSE;
+            TypeStack.Truncate(Frame.Height);
+            for (bin::value_type Type : Frame.ParamTypes)
+              TypeStack.push(Type);
+            break;
+          }
+
         case bin::instruction::eExpressionEnd :
+          {
+            control_frame &Frame = Frames.back();
+            const UINT32 EndIp = static_cast<UINT32>(Function.Instructions.size());
+
+            CheckFrameResults(Frame);
+
+            // 'if' without 'else' passes parameters through
+            if (Frame.Instruction == bin::instruction::eIf)
+            {
+              if (Frame.ParamTypes != Frame.ResultTypes)
+                throw compile_status::eInvalidBlockType;
+              Function.BranchTargets[Frame.ElseTarget].Ip = EndIp;
+            }
+
+            for (UINT32 Target : Frame.EndTargets)
+              Function.BranchTargets[Target].Ip = EndIp;
+
+            TypeStack.Truncate(Frame.Height);
+            for (bin::value_type Type : Frame.ResultTypes)
+              TypeStack.push(Type);
+            Frames.pop_back();
+
+            // Inlined function body end, compilation continues after call
+            if (Contexts.size() > 1 && Frames.size() == Contexts.back().FrameIndex)
+            {
+              if (InstructionPointer != InstructionEnd)
+                throw compile_status::eUnbalancedBlocks;
+              InstructionPointer = Contexts.back().InstructionPointer;
+              InstructionEnd = Contexts.back().InstructionEnd;
+              Contexts.pop_back();
+              break;
+            }
+
+            // Function body end
+            if (Frames.empty())
+            {
+              if (InstructionPointer != InstructionEnd)
+                throw compile_status::eUnbalancedBlocks;
+              PassInstruction(bin::instruction::eReturn);
+            }
+            break;
+          }
+
         case bin::instruction::eBr            :
         case bin::instruction::eBrIf          :
+          {
+            auto [Depth, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+            InstructionPointer += Offset;
+
+            if (Instruction == bin::instruction::eBrIf)
+            {
+              if (TypeStack.size() <= Frames.back().Height || TypeStack.top() != bin::value_type::eI32)
+                throw compile_status::eInvalidOperandType;
+              TypeStack.pop();
+            }
+
+            const UINT32 Target = AddBranchTarget(Depth);
+
+            PassInstruction(Instruction);
+            PassU32(Target);
+            if (Instruction == bin::instruction::eBr)
+              SetUnreachable();
+            break;
+          }
+
+        // Branch targets are stored sequentially, default target is the last one
         case bin::instruction::eBrTable       :
-          throw compile_status::eUnsupportedFeature;
+          {
+            auto [LabelCount, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+            InstructionPointer += Offset;
+
+            if (TypeStack.size() <= Frames.back().Height || TypeStack.top() != bin::value_type::eI32)
+              throw compile_status::eInvalidOperandType;
+            TypeStack.pop();
+
+            const UINT32 FirstTarget = static_cast<UINT32>(Function.BranchTargets.size());
+            std::optional<SIZE_T> LabelArity;
+
+            for (SIZE_T i = 0; i <= LabelCount; i++)
+            {
+              auto [Depth, DepthOffset] = leb128::DecodeUnsigned(InstructionPointer);
+              InstructionPointer += DepthOffset;
+
+              AddBranchTarget(Depth);
+
+              const control_frame &Frame = Frames[Frames.size() - 1 - Depth];
+              const SIZE_T Arity = (Frame.Instruction == bin::instruction::eLoop ? Frame.ParamTypes : Frame.ResultTypes).size();
+
+              if (LabelArity.value_or(Arity) != Arity)
+                throw compile_status::eInvalidBlockType;
+              LabelArity = Arity;
+            }
+
+            if (BranchTable == branch_table_lowering::eLinearScan)
+            {
+              // Operand is stored to scratch local and compared with every label index
+              if (!ScratchLocal)
+              {
+                ScratchLocal = static_cast<UINT16>(Function.LocalSizes.size());
+                LocalTypes.push_back(bin::value_type::eI32);
+                Function.LocalSizes.push_back(sizeof(UINT32));
+              }
+
+              TypeStack.AccountTemporaries(2);
+              PassInstruction(bin::instruction::eLocalSet, sizeof(UINT32));
+              PassU16(*ScratchLocal);
+              for (UINT32 i = 0; i < LabelCount; i++)
+              {
+                PassInstruction(bin::instruction::eLocalGet, sizeof(UINT32));
+                PassU16(*ScratchLocal);
+                PassInstruction(bin::instruction::eI32Const);
+                PassU32(i);
+                PassInstruction(bin::instruction::eI32Eq);
+                PassInstruction(bin::instruction::eBrIf);
+                PassU32(FirstTarget + i);
+              }
+              PassInstruction(bin::instruction::eBr);
+              PassU32(FirstTarget + static_cast<UINT32>(LabelCount));
+            }
+            else
+            {
+              PassInstruction(bin::instruction::eBrTable);
+              PassU32(FirstTarget);
+              PassU32(static_cast<UINT32>(LabelCount));
+            }
+            SetUnreachable();
+            break;
+          }
 
         // Match type stack with called function signature
         case bin::instruction::eCall          :
           {
-            auto [FunctionIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+            auto [CalleeIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
             InstructionPointer += Offset;
 
-            if (FunctionIndex >= Functions.size())
+            if (CalleeIndex >= Functions.size())
               throw compile_status::eInvalidFunctionIndex;
 
-            auto &CallSignature = FunctionSignatures[FunctionSignatureIndices[FunctionIndex]];
+            auto &CallSignature = FunctionSignatures[FunctionSignatureIndices[CalleeIndex]];
 
-            if (TypeStack.size() < CallSignature.ArgumentTypes.size())
+            if (GetOperandCount() < CallSignature.ArgumentTypes.size())
               throw compile_status::eNoFunctionArguments;
 
-            for (auto Arg : CallSignature.ArgumentTypes)
+            for (auto Arg = CallSignature.ArgumentTypes.rbegin(); Arg != CallSignature.ArgumentTypes.rend(); Arg++)
             {
-              if (TypeStack.top() != Arg)
+              if (TypeStack.top() != *Arg)
                 throw compile_status::eInvalidFunctionArgumentsType;
               TypeStack.pop();
             }
 
+            if (InlineCall(static_cast<UINT32>(CalleeIndex), CallSignature))
+              break;
+
             if (CallSignature.ReturnType)
               TypeStack.push(*CallSignature.ReturnType);
             PassInstruction(Instruction);
-            PassU32(static_cast<UINT32>(FunctionIndex));
+            PassU32(static_cast<UINT32>(CalleeIndex));
+            break;
+          }
+
+        // Tail call reuses caller frame, so callee must return the same type caller does
+        case bin::instruction::eReturnCall    :
+          {
+            auto [CalleeIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+            InstructionPointer += Offset;
+
+            if (CalleeIndex >= Functions.size())
+              throw compile_status::eInvalidFunctionIndex;
+
+            auto &CallSignature = FunctionSignatures[FunctionSignatureIndices[CalleeIndex]];
+            auto &CallerSignature = FunctionSignatures[FunctionSignatureIndices[Contexts.back().FunctionIndex]];
+
+            if (CallSignature.ReturnType != CallerSignature.ReturnType)
+              throw compile_status::eWrongReturnValueType;
+
+            if (GetOperandCount() < CallSignature.ArgumentTypes.size())
+              throw compile_status::eNoFunctionArguments;
+
+            for (auto Arg = CallSignature.ArgumentTypes.rbegin(); Arg != CallSignature.ArgumentTypes.rend(); Arg++)
+            {
+              if (TypeStack.top() != *Arg)
+                throw compile_status::eInvalidFunctionArgumentsType;
+              TypeStack.pop();
+            }
+
+            // Inlined function has no frame of its own, so tail call is compiled as call and return by branch to its body end
+            if (Contexts.size() > 1)
+            {
+              if (CallSignature.ReturnType)
+                TypeStack.push(*CallSignature.ReturnType);
+              PassInstruction(bin::instruction::eCall);
+              PassU32(static_cast<UINT32>(CalleeIndex));
+
+              const UINT32 Target = AddBranchTarget(Frames.size() - 1 - Contexts.back().FrameIndex);
+
+              PassInstruction(bin::instruction::eBr);
+              PassU32(Target);
+              SetUnreachable();
+              break;
+            }
+
+            PassInstruction(Instruction);
+            PassU32(static_cast<UINT32>(CalleeIndex));
+            SetUnreachable();
             break;
           }
 
-        case bin::instruction::eCallIndirect  :
+        case bin::instruction::eCallIndirect       :
+        case bin::instruction::eReturnCallIndirect :
           throw compile_status::eUnsupportedFeature;
 
         case bin::instruction::eDrop          :
           {
-            if (TypeStack.empty())
+            if (GetOperandCount() == 0)
                 throw compile_status::eNoOperandsForUnary;
 
             PassInstruction(bin::instruction::eDrop, static_cast<UINT8>(bin::GetValueTypeSize(TypeStack.top())));
@@ -885,7 +1546,21 @@ namespace watap::impl::standard
           }
 
         case bin::instruction::eSelect        :
-          throw compile_status::eUnsupportedFeature;
+          {
+            if (GetOperandCount() < 3)
+              throw compile_status::eNoOperandsForBinary;
+            if (TypeStack.top() != bin::value_type::eI32)
+              throw compile_status::eInvalidOperandType;
+            TypeStack.pop();
+
+            const bin::value_type Type = TypeStack.top();
+            TypeStack.pop();
+            if (TypeStack.top() != Type)
+              throw compile_status::eInvalidOperandType;
+
+            PassInstruction(bin::instruction::eSelect, static_cast<UINT8>(bin::GetValueTypeSize(Type)));
+            break;
+          }
 
         case bin::instruction::eSelectTyped   :
           throw compile_status::eUnsupportedFeature;
@@ -895,13 +1570,16 @@ namespace watap::impl::standard
             auto [LocalIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
             InstructionPointer += Offset;
 
-            if (LocalTypes.size() >= LocalIndex)
+            if (LocalIndex >= Contexts.back().LocalCount)
               throw compile_status::eInvalidLocalIndex;
 
-            TypeStack.push(LocalTypes[LocalIndex]);
+            // Locals of inlined function are placed after caller ones
+            const UINT32 Local = Contexts.back().LocalBase + static_cast<UINT32>(LocalIndex);
+
+            TypeStack.push(LocalTypes[Local]);
 
-            PassInstruction(bin::instruction::eLocalGet);
-            PassU16(static_cast<UINT16>(LocalIndex));
+            PassInstruction(bin::instruction::eLocalGet, static_cast<UINT8>(bin::GetValueTypeSize(LocalTypes[Local])));
+            PassU16(static_cast<UINT16>(Local));
             break;
           }
 
@@ -911,17 +1589,22 @@ namespace watap::impl::standard
             auto [LocalIndex, Offset] = leb128::DecodeUnsigned(InstructionPointer);
             InstructionPointer += Offset;
 
-            if (Function.LocalSizes.size() >= LocalIndex)
+            if (LocalIndex >= Contexts.back().LocalCount)
               throw compile_status::eInvalidLocalIndex;
 
-            if (TypeStack.top() != LocalTypes[LocalIndex])
+            const UINT32 Local = Contexts.back().LocalBase + static_cast<UINT32>(LocalIndex);
+
+            if (GetOperandCount() == 0)
+              throw compile_status::eNoOperandsForUnary;
+
+            if (TypeStack.top() != LocalTypes[Local])
               throw compile_status::eInvalidOperandType;
 
             if (Instruction != bin::instruction::eLocalTee)
               TypeStack.pop();
 
-            PassInstruction(bin::instruction::eLocalSet, static_cast<UINT8>(bin::GetValueTypeSize(LocalTypes[LocalIndex])));
-            PassU16(static_cast<UINT16>(LocalIndex));
+            PassInstruction(Instruction, static_cast<UINT8>(bin::GetValueTypeSize(LocalTypes[Local])));
+            PassU16(static_cast<UINT16>(Local));
             break;
           }
 
@@ -947,8 +1630,10 @@ namespace watap::impl::standard
         case bin::instruction::eI64Load32S :
         case bin::instruction::eI64Load32U :
           {
-            auto [Ptr, Offset] = leb128::DecodeUnsigned(InstructionPointer);
-            InstructionPointer += Offset;
+            auto [Align, AlignLength] = leb128::DecodeUnsigned(InstructionPointer);
+            InstructionPointer += AlignLength;
+            auto [MemoryOffset, MemoryOffsetLength] = leb128::DecodeUnsigned(InstructionPointer);
+            InstructionPointer += MemoryOffsetLength;
 
             bin::value_type StackType;
 
@@ -970,11 +1655,11 @@ namespace watap::impl::standard
             case bin::instruction::eI64Load32U : StackType = bin::value_type::eI64; break;
             }
 
-            TypeStack.push(StackType);
+            UnaryOperatorNoAdd(bin::value_type::eI32, StackType);
 
             PassInstruction(Instruction);
-            PassU32(static_cast<UINT32>(Ptr));
-            break; // = 0x2B, // Load F64 from variable
+            PassU32(static_cast<UINT32>(MemoryOffset));
+            break;
           }
 
         case bin::instruction::eI32Store   :
@@ -987,8 +1672,10 @@ namespace watap::impl::standard
         case bin::instruction::eI64Store16 :
         case bin::instruction::eI64Store32 :
           {
-            auto [Ptr, Offset] = leb128::DecodeUnsigned(InstructionPointer);
-            InstructionPointer += Offset;
+            auto [Align, AlignLength] = leb128::DecodeUnsigned(InstructionPointer);
+            InstructionPointer += AlignLength;
+            auto [MemoryOffset, MemoryOffsetLength] = leb128::DecodeUnsigned(InstructionPointer);
+            InstructionPointer += MemoryOffsetLength;
 
             bin::value_type RequiredType;
             switch (Instruction)
@@ -1004,14 +1691,19 @@ namespace watap::impl::standard
             case bin::instruction::eI64Store32 : RequiredType = bin::value_type::eI64; break;
             }
 
-            if (TypeStack.empty())
-              throw compile_status::eNoOperandsForUnary;
+            if (GetOperandCount() < 2)
+              throw compile_status::eNoOperandsForBinary;
 
             if (TypeStack.top() != RequiredType)
               throw compile_status::eInvalidOperandType;
+            TypeStack.pop();
 
+            if (TypeStack.top() != bin::value_type::eI32)
+              throw compile_status::eInvalidOperandType;
             TypeStack.pop();
+
             PassInstruction(Instruction);
+            PassU32(static_cast<UINT32>(MemoryOffset));
             break;
           }
 
@@ -1040,7 +1732,7 @@ namespace watap::impl::standard
             auto [Value, Offset] = leb128::DecodeSigned<64>(InstructionPointer);
             InstructionPointer += Offset;
 
-            TypeStack.push(bin::value_type::eI32);
+            TypeStack.push(bin::value_type::eI64);
             PassInstruction(bin::instruction::eI64Const);
             PassU64(Value);
             break;
@@ -1051,7 +1743,7 @@ namespace watap::impl::standard
             TypeStack.push(bin::value_type::eF64);
             PassInstruction(bin::instruction::eF64Const);
             PassU64(*reinterpret_cast<const UINT64 *>(InstructionPointer));
-            InstructionPointer += 4;
+            InstructionPointer += 8;
             break;
           }
 
@@ -1059,6 +1751,10 @@ namespace watap::impl::standard
           UnaryOperator(Instruction, bin::value_type::eI32, bin::value_type::eI32);
           break;
 
+        case bin::instruction::eI64Eqz             :
+          UnaryOperator(Instruction, bin::value_type::eI64, bin::value_type::eI32);
+          break;
+
         case bin::instruction::eI32Eq              :
         case bin::instruction::eI32Ne              :
         case bin::instruction::eI32LtS             :
@@ -1072,7 +1768,6 @@ namespace watap::impl::standard
           BinaryOperator(Instruction, bin::value_type::eI32, bin::value_type::eI32, bin::value_type::eI32);
           break;
 
-        case bin::instruction::eI64Eqz             :
         case bin::instruction::eI64Eq              :
         case bin::instruction::eI64Ne              :
         case bin::instruction::eI64LtS             :
@@ -1181,7 +1876,7 @@ namespace watap::impl::standard
         case bin::instruction::eF64Trunc           :
         case bin::instruction::eF64Nearest         :
         case bin::instruction::eF64Sqrt            :
-          UnaryOperator(Instruction, bin::value_type::eF32, bin::value_type::eF32);
+          UnaryOperator(Instruction, bin::value_type::eF64, bin::value_type::eF64);
           break;
 
         case bin::instruction::eF64Add             :
@@ -1191,7 +1886,7 @@ namespace watap::impl::standard
         case bin::instruction::eF64Min             :
         case bin::instruction::eF64Max             :
         case bin::instruction::eF64CopySign        :
-          BinaryOperator(Instruction, bin::value_type::eF32, bin::value_type::eF32, bin::value_type::eF32);
+          BinaryOperator(Instruction, bin::value_type::eF64, bin::value_type::eF64, bin::value_type::eF64);
           break;
 
         case bin::instruction::eI32WrapI64         :
@@ -1270,6 +1965,7 @@ namespace watap::impl::standard
         case bin::instruction::eRefNull   :
         {
           bin::reference_type RefType = *reinterpret_cast<const bin::reference_type *>(InstructionPointer);
+          InstructionPointer += 1;
 
           TypeStack.push(static_cast<bin::value_type>(RefType));
           PassInstruction(bin::instruction::eRefNull);
@@ -1278,7 +1974,7 @@ namespace watap::impl::standard
 
         case bin::instruction::eRefIsNull :
         {
-          if (TypeStack.empty())
+          if (GetOperandCount() == 0)
             throw compile_status::eNoOperandsForUnary;
 
           if (TypeStack.top() != bin::value_type::eFuncRef && TypeStack.top() != bin::value_type::eExternRef)
@@ -1291,7 +1987,7 @@ namespace watap::impl::standard
 
         case bin::instruction::eRefFunc   :
         {
-          auto [Value, Offset] = leb128::DecodeSigned<32>(InstructionPointer);
+          auto [Value, Offset] = leb128::DecodeUnsigned(InstructionPointer);
           InstructionPointer += Offset;
 
           TypeStack.push(bin::value_type::eFuncRef);
@@ -1300,7 +1996,61 @@ namespace watap::impl::standard
           break;
         }
 
+        // Bulk memory instructions (memory index immediates are always 0), truncation with saturation and table instructions aren't supported
         case bin::instruction::eSystem :
+          {
+            auto [Value, Offset] = leb128::DecodeUnsigned(InstructionPointer);
+            InstructionPointer += Offset;
+
+            const bin::system_instruction SystemInstruction = static_cast<bin::system_instruction>(Value);
+            UINT32 SegmentIndex = 0;
+            UINT32 OperandCount = 3;
+
+            switch (SystemInstruction)
+            {
+            case bin::system_instruction::eMemoryInit :
+            case bin::system_instruction::eDataDrop   :
+              {
+                auto [Index, IndexLength] = leb128::DecodeUnsigned(InstructionPointer);
+                InstructionPointer += IndexLength;
+
+                if (Index >= DataSegments.size())
+                  throw compile_status::eInvalidDataSegmentIndex;
+                SegmentIndex = static_cast<UINT32>(Index);
+                if (SystemInstruction == bin::system_instruction::eMemoryInit)
+                  InstructionPointer += 1;
+                else
+                  OperandCount = 0;
+                break;
+              }
+
+            case bin::system_instruction::eMemoryCopy :
+              InstructionPointer += 2;
+              break;
+
+            case bin::system_instruction::eMemoryFill :
+              InstructionPointer += 1;
+              break;
+
+            default:
+              throw compile_status::eUnsupportedFeature;
+            }
+
+            if (GetOperandCount() < OperandCount)
+              throw compile_status::eNoOperandsForBinary;
+            for (UINT32 i = 0; i < OperandCount; i++)
+            {
+              if (TypeStack.top() != bin::value_type::eI32)
+                throw compile_status::eInvalidOperandType;
+              TypeStack.pop();
+            }
+
+            PassInstruction(Instruction, static_cast<UINT8>(SystemInstruction));
+            if (GetCompiledInstructionLength(Function.Instructions.back()) > 1)
+              PassU32(SegmentIndex);
+            break;
+          }
+
         case bin::instruction::eVector :
           throw compile_status::eUnsupportedFeature;
         }
@@ -1311,6 +2061,9 @@ namespace watap::impl::standard
       }
     }
 
+    if (!Frames.empty())
+      return compile_status::eUnbalancedBlocks;
+
     /* Validate stack size */
     if (TypeStack.size() > 1)
       return compile_status::eStackNotEmpty;
@@ -1325,9 +2078,79 @@ namespace watap::impl::standard
       if (!TypeStack.empty())
         return compile_status::eStackNotEmpty;
 
-    Functions[FunctionIndex] = Function;
+    if (Optimization)
+    {
+      const SIZE_T RemovedCount = Optimize(Function);
+
+      if (OptimizationReport != nullptr)
+        OptimizationReport->RemovedInstructionCounts[FunctionIndex] = RemovedCount;
+    }
+
+    Function.FrameSlotCount = static_cast<UINT32>(Function.LocalSizes.size());
+    Function.MaxStackHeight = static_cast<UINT32>(TypeStack.GetMaxHeight());
+
+    // Bytecode is kept for optimizing compiler before it's converted
+    if (TierUpCallCount != 0 || TierUpBackEdgeCount != 0)
+    {
+      Function.StackBytecode = std::make_shared<const stack_bytecode>(stack_bytecode {
+        .Instructions = Function.Instructions,
+        .BranchTargets = Function.BranchTargets,
+        .LocalTypes = std::move(LocalTypes),
+      });
+    }
+
+    if (Bytecode == bytecode_type::eRegister)
+      LowerToRegisters(Function);
+    else if (Bytecode == bytecode_type::eCachedStack)
+      CacheStackTop(Function);
+    else if (Bytecode == bytecode_type::eNative)
+      CompileNative(Function);
+    if (Function.Bytecode == bytecode_type::eStack)
+    {
+      if (FusionStatistics != nullptr)
+        RecordFusionStatistics(Function);
+      if (Fusion)
+        Fuse(Function);
+    }
+    instance_impl::Link(Function);
+
+    // Small function code is kept for inlining into its callers
+    if (RawData->Instructions.size() <= InlineBudget)
+      InlineBodies.emplace(FunctionIndex, std::move(*RawData));
+
+    Functions[FunctionIndex] = std::move(Function);
     return compile_status::eOk;
   } /* End of 'CompileJIT' function */
+
+  /* Inlined function code getting function (function is compiled first, so its code is validated).
+   * ARGUMENTS:
+   *   - called function index:
+   *       UINT32 FunctionIndex;
+   * RETURNS:
+   *   (const raw_function_data *) Function code, nullptr if function is too large or can't be compiled;
+   */
+  const raw_function_data * source_impl::GetInlineBody( UINT32 FunctionIndex )
+  {
+    if (InlineBudget == 0)
+      return nullptr;
+
+    // Compilations of inlined callees don't compile their own callees, so compilation doesn't recurse
+    if (const raw_function_data *RawData = std::get_if<raw_function_data>(&Functions[FunctionIndex]))
+    {
+      if (RawData->Instructions.size() > InlineBudget || InlineCompileDepth != 0)
+        return nullptr;
+
+      InlineCompileDepth++;
+      const compile_status Status = CompileJIT(FunctionIndex);
+      InlineCompileDepth--;
+
+      if (Status != compile_status::eOk)
+        return nullptr;
+    }
+
+    auto Iter = InlineBodies.find(FunctionIndex);
+    return Iter != InlineBodies.end() ? &Iter->second : nullptr;
+  } /* End of 'GetInlineBody' function */
 } /* end of 'watap::impl::standard' namespace */
 
 /* END OF 'watap_impl_standard_source.cpp' FILE */
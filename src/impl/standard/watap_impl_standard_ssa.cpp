@@ -0,0 +1,1142 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_interface.h"
+#include "watap_impl_standard_ssa.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+/***
+ * SSA form construction and optimization.
+ *
+ * SSA form is built from validated stack bytecode in a single pass (Braun et al. "Simple and Efficient
+ * Construction of Static Single Assignment Form"): locals and operand stack positions are variables,
+ * blocks start at branch targets and after conditional branches. Blocks, that are targets of backward
+ * branches (loop headers), are sealed after the whole function is read, the rest are sealed when they
+ * are started, as all their predecessors are known at that moment. Trivial phis are removed afterwards.
+ *
+ * Optimizations (in order):
+ *   - global value numbering: pure instructions, equal to instruction of dominating block, are removed;
+ *   - loop-invariant code motion: pure non-trapping instructions with operands, defined outside of loop,
+ *     are moved to the immediate dominator of loop header (inner loops are processed first);
+ *   - dead code elimination;
+ *   - comparison and conditional branch fusion (comparison result isn't materialized).
+ ***/
+
+/* Instruction result class (is result floating point) by 'WATAP_STANDARD_*_INSTRUCTIONS' list KIND */
+#define WATAP_STANDARD_SSA_FLOAT_OP_BINARY(TYPE, ...) std::is_floating_point_v<TYPE>
+#define WATAP_STANDARD_SSA_FLOAT_FN_BINARY(TYPE, ...) std::is_floating_point_v<TYPE>
+#define WATAP_STANDARD_SSA_FLOAT_FN_UNARY(TYPE, ...)  std::is_floating_point_v<TYPE>
+#define WATAP_STANDARD_SSA_FLOAT_SHIFT(TYPE, ...)     FALSE
+#define WATAP_STANDARD_SSA_FLOAT_ROTATE(TYPE, ...)    FALSE
+#define WATAP_STANDARD_SSA_FLOAT_COMPARE(TYPE, ...)   FALSE
+#define WATAP_STANDARD_SSA_FLOAT_DIV_S(TYPE)          FALSE
+#define WATAP_STANDARD_SSA_FLOAT_REM_S(TYPE)          FALSE
+#define WATAP_STANDARD_SSA_FLOAT_DIV_U(TYPE, ...)     FALSE
+#define WATAP_STANDARD_SSA_FLOAT_EQZ(TYPE)            FALSE
+#define WATAP_STANDARD_SSA_FLOAT_I_EXTEND(BASE, SUB)  FALSE
+#define WATAP_STANDARD_SSA_FLOAT_TRUNC(FROM, TO)      FALSE
+#define WATAP_STANDARD_SSA_FLOAT_CAST(FROM, TO)       std::is_floating_point_v<TO>
+#define WATAP_STANDARD_SSA_FLOAT_LOAD(TYPE, MEMORY)   std::is_floating_point_v<TYPE>
+
+/* Can instruction trap (by 'WATAP_STANDARD_*_INSTRUCTIONS' list KIND) */
+#define WATAP_STANDARD_SSA_TRAPS_OP_BINARY FALSE
+#define WATAP_STANDARD_SSA_TRAPS_FN_BINARY FALSE
+#define WATAP_STANDARD_SSA_TRAPS_FN_UNARY  FALSE
+#define WATAP_STANDARD_SSA_TRAPS_SHIFT     FALSE
+#define WATAP_STANDARD_SSA_TRAPS_ROTATE    FALSE
+#define WATAP_STANDARD_SSA_TRAPS_COMPARE   FALSE
+#define WATAP_STANDARD_SSA_TRAPS_DIV_S     TRUE
+#define WATAP_STANDARD_SSA_TRAPS_REM_S     TRUE
+#define WATAP_STANDARD_SSA_TRAPS_DIV_U     TRUE
+#define WATAP_STANDARD_SSA_TRAPS_EQZ       FALSE
+#define WATAP_STANDARD_SSA_TRAPS_I_EXTEND  FALSE
+#define WATAP_STANDARD_SSA_TRAPS_TRUNC     TRUE
+#define WATAP_STANDARD_SSA_TRAPS_CAST      FALSE
+
+/* Instruction list entry to 'case' label conversion macro */
+#define WATAP_STANDARD_SSA_CASE(NAME, ...) case bin::instruction::NAME:
+
+/* Instruction list entry to result class 'case' conversion macro */
+#define WATAP_STANDARD_SSA_FLOAT_CASE(NAME, KIND, ...) case bin::instruction::NAME: return WATAP_STANDARD_SSA_FLOAT_##KIND(__VA_ARGS__);
+
+/* Instruction list entry to trapping property 'case' conversion macro */
+#define WATAP_STANDARD_SSA_TRAPS_CASE(NAME, KIND, ...) case bin::instruction::NAME: return WATAP_STANDARD_SSA_TRAPS_##KIND;
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* Numeric instruction result class getting function.
+   * ARGUMENTS:
+   *   - numeric or memory loading instruction:
+   *       bin::instruction Instruction;
+   * RETURNS:
+   *   (BOOL) TRUE if instruction result is floating point value, FALSE otherwise;
+   */
+  static BOOL IsFloatResult( bin::instruction Instruction ) noexcept
+  {
+    switch (Instruction)
+    {
+    WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_SSA_FLOAT_CASE)
+    WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_SSA_FLOAT_CASE)
+    WATAP_STANDARD_LOAD_INSTRUCTIONS(WATAP_STANDARD_SSA_FLOAT_CASE)
+    default:
+      return FALSE;
+    }
+  } /* End of 'IsFloatResult' function */
+
+  /* Pure (result depends on operands only, there are no side effects but trap) instruction checking function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       bin::instruction Instruction;
+   * RETURNS:
+   *   (BOOL) TRUE if instruction is pure, FALSE otherwise;
+   */
+  static BOOL IsPure( bin::instruction Instruction ) noexcept
+  {
+    switch (Instruction)
+    {
+    WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_SSA_CASE)
+    WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_SSA_CASE)
+    case bin::instruction::eSelect:
+      return TRUE;
+    default:
+      return FALSE;
+    }
+  } /* End of 'IsPure' function */
+
+  /* Pure instruction trapping checking function.
+   * ARGUMENTS:
+   *   - pure instruction:
+   *       bin::instruction Instruction;
+   * RETURNS:
+   *   (BOOL) TRUE if instruction may trap, FALSE otherwise;
+   */
+  static BOOL IsTrapping( bin::instruction Instruction ) noexcept
+  {
+    switch (Instruction)
+    {
+    WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_SSA_TRAPS_CASE)
+    WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_SSA_TRAPS_CASE)
+    default:
+      return FALSE;
+    }
+  } /* End of 'IsTrapping' function */
+
+  /* Commutative integer instruction checking function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       bin::instruction Instruction;
+   * RETURNS:
+   *   (BOOL) TRUE if instruction operands may be swapped, FALSE otherwise;
+   */
+  static BOOL IsCommutative( bin::instruction Instruction ) noexcept
+  {
+    switch (Instruction)
+    {
+    case bin::instruction::eI32Add : case bin::instruction::eI64Add :
+    case bin::instruction::eI32Mul : case bin::instruction::eI64Mul :
+    case bin::instruction::eI32And : case bin::instruction::eI64And :
+    case bin::instruction::eI32Or  : case bin::instruction::eI64Or  :
+    case bin::instruction::eI32Xor : case bin::instruction::eI64Xor :
+    case bin::instruction::eI32Eq  : case bin::instruction::eI64Eq  :
+    case bin::instruction::eI32Ne  : case bin::instruction::eI64Ne  :
+      return TRUE;
+    default:
+      return FALSE;
+    }
+  } /* End of 'IsCommutative' function */
+
+  /* Comparison, that may be fused with conditional branch (it's emitted as flag setting instruction), checking function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       bin::instruction Instruction;
+   * RETURNS:
+   *   (BOOL) TRUE if instruction is fusable comparison, FALSE otherwise;
+   */
+  static BOOL IsFusable( bin::instruction Instruction ) noexcept
+  {
+    // Floating point (in)equality requires parity flag check, so it isn't fused
+    return (Instruction >= bin::instruction::eI32Eqz && Instruction <= bin::instruction::eI64GeU)
+      || (Instruction >= bin::instruction::eF32Lt && Instruction <= bin::instruction::eF32Ge)
+      || (Instruction >= bin::instruction::eF64Lt && Instruction <= bin::instruction::eF64Ge);
+  } /* End of 'IsFusable' function */
+
+  /* Stack bytecode to SSA form converter representation class */
+  class ssa_builder
+  {
+    /* Block construction state representation structure */
+    struct block_state
+    {
+      std::unordered_map<UINT32, UINT32> Definitions;        // Current variable definitions (at block end, if block is finished)
+      std::vector<std::pair<UINT32, UINT32>> IncompletePhis; // Variables and phis of unsealed block, that get operands on sealing
+      BOOL IsSealed = FALSE;                                 // Are all block predecessors known
+      BOOL IsLoopHeader = FALSE;                             // Is block target of backward branch (it's sealed after function end)
+      UINT32 Depth = SSA_NONE;                               // Operand stack depth at block start
+    }; /* End of 'block_state' structure */
+
+    ssa_function &Ssa;                                          // Function to build
+    std::vector<block_state> States;                            // Block construction states
+    std::map<std::pair<UINT64, BOOL>, UINT32> Constants;        // Constant values (by bits and class)
+    BOOL IsValid = TRUE;                                        // Is built function valid (stack depths of block predecessors match)
+
+  public:
+    /* SSA builder constructor.
+     * ARGUMENTS:
+     *   - function to build:
+     *       ssa_function &Ssa;
+     */
+    ssa_builder( ssa_function &Ssa ) : Ssa(Ssa)
+    {
+    } /* End of 'ssa_builder' function */
+
+    /* Block adding function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (UINT32) New block index;
+     */
+    UINT32 AddBlock( VOID )
+    {
+      Ssa.Blocks.emplace_back();
+      States.emplace_back();
+      return static_cast<UINT32>(Ssa.Blocks.size() - 1);
+    } /* End of 'AddBlock' function */
+
+    /* Block state getting function.
+     * ARGUMENTS:
+     *   - block index:
+     *       UINT32 Block;
+     * RETURNS:
+     *   (block_state &) Block construction state;
+     */
+    block_state & State( UINT32 Block )
+    {
+      return States[Block];
+    } /* End of 'State' function */
+
+    /* Validity getting function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (BOOL) TRUE if built function is valid, FALSE otherwise;
+     */
+    BOOL GetIsValid( VOID ) const
+    {
+      return IsValid;
+    } /* End of 'GetIsValid' function */
+
+    /* Value adding function.
+     * ARGUMENTS:
+     *   - value:
+     *       ssa_value Value;
+     * RETURNS:
+     *   (UINT32) New value index;
+     */
+    UINT32 AddValue( ssa_value Value )
+    {
+      Ssa.Values.push_back(std::move(Value));
+      return static_cast<UINT32>(Ssa.Values.size() - 1);
+    } /* End of 'AddValue' function */
+
+    /* Constant getting function (constants with the same bits and class are shared).
+     * ARGUMENTS:
+     *   - constant bits:
+     *       UINT64 Bits;
+     *   - is constant floating point:
+     *       BOOL IsFloat;
+     * RETURNS:
+     *   (UINT32) Constant value index;
+     */
+    UINT32 Constant( UINT64 Bits, BOOL IsFloat )
+    {
+      if (auto Iter = Constants.find({Bits, IsFloat}); Iter != Constants.end())
+        return Iter->second;
+      return Constants[{Bits, IsFloat}] = AddValue(ssa_value { .Kind = ssa_kind::eConstant, .IsFloat = IsFloat, .Immediate = Bits });
+    } /* End of 'Constant' function */
+
+    /* Control flow edge adding function.
+     * ARGUMENTS:
+     *   - source and destination blocks:
+     *       UINT32 From, To;
+     *   - operand stack depth on edge:
+     *       SIZE_T Depth;
+     * RETURNS: None.
+     */
+    VOID AddEdge( UINT32 From, UINT32 To, SIZE_T Depth )
+    {
+      std::vector<UINT32> &Predecessors = Ssa.Blocks[To].Predecessors;
+
+      if (States[To].Depth == SSA_NONE)
+        States[To].Depth = static_cast<UINT32>(Depth);
+      else if (States[To].Depth != Depth)
+        IsValid = FALSE;
+      if (std::ranges::find(Predecessors, From) == Predecessors.end())
+        Predecessors.push_back(From);
+    } /* End of 'AddEdge' function */
+
+    /* Phi adding function.
+     * ARGUMENTS:
+     *   - block to add phi to:
+     *       UINT32 Block;
+     * RETURNS:
+     *   (UINT32) New phi value index;
+     */
+    UINT32 AddPhi( UINT32 Block )
+    {
+      const UINT32 Phi = AddValue(ssa_value { .Kind = ssa_kind::ePhi, .Block = Block });
+
+      Ssa.Blocks[Block].Phis.push_back(Phi);
+      return Phi;
+    } /* End of 'AddPhi' function */
+
+    /* Variable writing function.
+     * ARGUMENTS:
+     *   - block, variable is defined in:
+     *       UINT32 Block;
+     *   - variable (local index or local count + operand stack position):
+     *       UINT32 Variable;
+     *   - value:
+     *       UINT32 Value;
+     * RETURNS: None.
+     */
+    VOID Write( UINT32 Block, UINT32 Variable, UINT32 Value )
+    {
+      States[Block].Definitions[Variable] = Value;
+    } /* End of 'Write' function */
+
+    /* Variable reading function (phis are created for unknown variables in blocks with several predecessors).
+     * ARGUMENTS:
+     *   - block, variable is read in:
+     *       UINT32 Block;
+     *   - variable:
+     *       UINT32 Variable;
+     * RETURNS:
+     *   (UINT32) Variable value;
+     */
+    UINT32 Read( UINT32 Block, UINT32 Variable )
+    {
+      if (auto Iter = States[Block].Definitions.find(Variable); Iter != States[Block].Definitions.end())
+        return Iter->second;
+
+      UINT32 Value;
+
+      if (!States[Block].IsSealed)
+      {
+        Value = AddPhi(Block);
+        States[Block].IncompletePhis.push_back({Variable, Value});
+      }
+      else if (Ssa.Blocks[Block].Predecessors.size() == 1)
+        Value = Read(Ssa.Blocks[Block].Predecessors[0], Variable);
+      else if (Ssa.Blocks[Block].Predecessors.empty())
+        Value = Constant(0, FALSE); // Undefined value, unreachable for validated code
+      else
+      {
+        // Phi is written before operands are read to break cycles
+        Value = AddPhi(Block);
+        Write(Block, Variable, Value);
+        AddPhiOperands(Variable, Value);
+      }
+      Write(Block, Variable, Value);
+      return Value;
+    } /* End of 'Read' function */
+
+    /* Phi operands (variable values from every block predecessor) adding function.
+     * ARGUMENTS:
+     *   - variable:
+     *       UINT32 Variable;
+     *   - phi:
+     *       UINT32 Phi;
+     * RETURNS: None.
+     */
+    VOID AddPhiOperands( UINT32 Variable, UINT32 Phi )
+    {
+      const UINT32 Block = Ssa.Values[Phi].Block;
+
+      for (SIZE_T i = 0; i < Ssa.Blocks[Block].Predecessors.size(); i++)
+      {
+        const UINT32 Operand = Read(Ssa.Blocks[Block].Predecessors[i], Variable);
+
+        Ssa.Values[Phi].Operands.push_back(Operand);
+      }
+    } /* End of 'AddPhiOperands' function */
+
+    /* Block sealing (all block predecessors are known) function.
+     * ARGUMENTS:
+     *   - block to seal:
+     *       UINT32 Block;
+     * RETURNS: None.
+     */
+    VOID Seal( UINT32 Block )
+    {
+      for (const auto &[Variable, Phi] : States[Block].IncompletePhis)
+        AddPhiOperands(Variable, Phi);
+      States[Block].IncompletePhis.clear();
+      States[Block].IsSealed = TRUE;
+    } /* End of 'Seal' function */
+  }; /* End of 'ssa_builder' class */
+
+  /* Value replacement (forwarded values are replaced by their forward targets in operands, forwarded phis are removed) function.
+   * ARGUMENTS:
+   *   - function:
+   *       ssa_function &Ssa;
+   *   - value forward targets (SSA_NONE if value isn't replaced):
+   *       std::vector<UINT32> &Forward;
+   * RETURNS: None.
+   */
+  static VOID ReplaceValues( ssa_function &Ssa, std::vector<UINT32> &Forward )
+  {
+    auto Resolve = [&]( UINT32 Value )
+      {
+        UINT32 Target = Value;
+
+        while (Forward[Target] != SSA_NONE)
+          Target = Forward[Target];
+        // Path compression
+        while (Forward[Value] != SSA_NONE)
+          Value = std::exchange(Forward[Value], Target);
+        return Target;
+      };
+
+    for (UINT32 BlockIndex : Ssa.Order)
+    {
+      ssa_block &Block = Ssa.Blocks[BlockIndex];
+
+      std::erase_if(Block.Phis, [&]( UINT32 Phi ) { return Forward[Phi] != SSA_NONE; });
+      std::erase_if(Block.Code, [&]( UINT32 Value ) { return Forward[Value] != SSA_NONE; });
+      for (UINT32 Value : Block.Phis)
+        for (UINT32 &Operand : Ssa.Values[Value].Operands)
+          Operand = Resolve(Operand);
+      for (UINT32 Value : Block.Code)
+        for (UINT32 &Operand : Ssa.Values[Value].Operands)
+          Operand = Resolve(Operand);
+      if (Block.Operand != SSA_NONE)
+        Block.Operand = Resolve(Block.Operand);
+    }
+  } /* End of 'ReplaceValues' function */
+
+  /* Stack bytecode to SSA form conversion function.
+   * ARGUMENTS:
+   *   - output function:
+   *       ssa_function &Ssa;
+   *   - module source (callee signatures are taken from it):
+   *       const source_impl &Source;
+   *   - function to convert (its kept stack bytecode is converted):
+   *       const compiled_function_data &Function;
+   *   - loop header branch target index, function is entered at by on-stack replacement (entry block defines all locals
+   *     as parameters, code, reachable from loop header only, is converted), SSA_NONE to enter function at its start:
+   *       UINT32 OsrTarget;
+   * RETURNS:
+   *   (BOOL) TRUE if function is converted, FALSE if it contains values or instructions SSA form doesn't support
+   *   (or operand stack isn't empty at on-stack replacement loop header);
+   */
+  BOOL BuildSsa( ssa_function &Ssa, const source_impl &Source, const compiled_function_data &Function, UINT32 OsrTarget )
+  {
+    // Variable reading recursion depth is limited by block count
+    constexpr SIZE_T MAX_BLOCK_COUNT = 8192;
+
+    const std::vector<compiled_instruction> &Code = Function.StackBytecode->Instructions;
+    const std::vector<branch_target> &Targets = Function.StackBytecode->BranchTargets;
+    const std::vector<bin::value_type> &LocalTypes = Function.StackBytecode->LocalTypes;
+    const UINT32 LocalCount = static_cast<UINT32>(LocalTypes.size());
+
+    // 128 bit values don't fit registers
+    if (Code.empty() || std::ranges::any_of(LocalTypes, []( bin::value_type Type ) { return bin::GetValueTypeSize(Type) > sizeof(UINT64); }))
+      return FALSE;
+    if (OsrTarget != SSA_NONE && OsrTarget >= Targets.size())
+      return FALSE;
+
+    auto IsFloatType = []( bin::value_type Type )
+      {
+        return Type == bin::value_type::eF32 || Type == bin::value_type::eF64;
+      };
+
+    ssa_builder Builder {Ssa};
+    std::vector<UINT32> BlockAt(Code.size(), SSA_NONE); // Blocks, started at instructions
+    const UINT32 Entry = Builder.AddBlock();
+
+    auto StartsBlock = [&]( SIZE_T Ip ) -> BOOL
+      {
+        if (Ip >= Code.size())
+          return FALSE;
+        if (BlockAt[Ip] == SSA_NONE)
+          BlockAt[Ip] = Builder.AddBlock();
+        return TRUE;
+      };
+
+    // Branch target block marking function
+    auto MarkTarget = [&]( UINT32 TargetIndex, SIZE_T Ip ) -> BOOL
+      {
+        if (TargetIndex >= Targets.size() || !StartsBlock(Targets[TargetIndex].Ip))
+          return FALSE;
+        if (Targets[TargetIndex].Ip <= Ip)
+          Builder.State(BlockAt[Targets[TargetIndex].Ip]).IsLoopHeader = TRUE;
+        return TRUE;
+      };
+
+    // Blocks are created before conversion, so block starts are known
+    StartsBlock(0);
+    for (SIZE_T Ip = 0; Ip < Code.size(); Ip += GetCompiledInstructionLength(Code[Ip]))
+    {
+      const SIZE_T Next = Ip + GetCompiledInstructionLength(Code[Ip]);
+
+      switch (Code[Ip].Instruction)
+      {
+      case bin::instruction::eIf:
+      case bin::instruction::eBrIf:
+        if (!MarkTarget(WATAP_STANDARD_IMM_U32(1), Ip) || !StartsBlock(Next))
+          return FALSE;
+        break;
+
+      case bin::instruction::eBr:
+        if (!MarkTarget(WATAP_STANDARD_IMM_U32(1), Ip))
+          return FALSE;
+        break;
+
+      case bin::instruction::eBrTable:
+        for (UINT32 i = 0; i <= WATAP_STANDARD_IMM_U32(3); i++)
+          if (!MarkTarget(WATAP_STANDARD_IMM_U32(1) + i, Ip))
+            return FALSE;
+        break;
+
+      default:
+        break;
+      }
+    }
+    if (Ssa.Blocks.size() > MAX_BLOCK_COUNT)
+      return FALSE;
+
+    // Entry block defines arguments and zero initialized locals
+    Builder.State(Entry).IsSealed = TRUE;
+    for (UINT32 Local = 0; Local < LocalCount; Local++)
+      Builder.Write(Entry, Local, Local < Function.ArgumentCount
+        ? Builder.AddValue(ssa_value { .Kind = ssa_kind::eParameter, .IsFloat = IsFloatType(LocalTypes[Local]), .Block = Entry, .Immediate = Local })
+        : Builder.Constant(0, IsFloatType(LocalTypes[Local])));
+    Ssa.Blocks[Entry].Terminator = ssa_terminator::eJump;
+    Ssa.Blocks[Entry].Successors = {BlockAt[0]};
+    Builder.AddEdge(Entry, BlockAt[0], 0);
+    Ssa.Order.push_back(Entry);
+
+    UINT32 Current = SSA_NONE;   // Current block, SSA_NONE if code is unreachable
+    std::vector<UINT32> Stack;   // Operand stack values
+
+    auto Pop = [&]( VOID )
+      {
+        const UINT32 Value = Stack.back();
+
+        Stack.pop_back();
+        return Value;
+      };
+
+    // Instruction emission function
+    auto Emit = [&]( bin::instruction Instruction, std::vector<UINT32> Operands, BOOL IsFloat, BOOL HasResult = TRUE, UINT64 Immediate = 0 )
+      {
+        const UINT32 Value = Builder.AddValue(ssa_value {
+          .Kind = ssa_kind::eInstruction,
+          .Instruction = Instruction,
+          .IsFloat = IsFloat,
+          .HasResult = HasResult,
+          .Block = Current,
+          .Immediate = Immediate,
+          .Operands = std::move(Operands),
+        });
+
+        Ssa.Blocks[Current].Code.push_back(Value);
+        if (HasResult)
+          Stack.push_back(Value);
+      };
+
+    // Current block finishing function (operand stack values are written to their variables)
+    auto Finish = [&]( ssa_terminator Terminator, std::vector<UINT32> Successors, UINT32 Operand = SSA_NONE )
+      {
+        for (SIZE_T Position = 0; Position < Stack.size(); Position++)
+          Builder.Write(Current, LocalCount + static_cast<UINT32>(Position), Stack[Position]);
+        Ssa.Blocks[Current].Terminator = Terminator;
+        Ssa.Blocks[Current].Successors = std::move(Successors);
+        Ssa.Blocks[Current].Operand = Operand;
+      };
+
+    // Conditional branch edge creation function, returns block to jump to (label values are moved by edge block)
+    auto Branch = [&]( const branch_target &Target ) -> UINT32
+      {
+        const SIZE_T Depth = Stack.size();
+        const SIZE_T TargetDepth = Depth - Target.DropCount;
+        const UINT32 TargetBlock = BlockAt[Target.Ip];
+
+        if (Target.DropCount == 0 || Target.KeepCount == 0)
+        {
+          Builder.AddEdge(Current, TargetBlock, TargetDepth);
+          return TargetBlock;
+        }
+
+        const UINT32 Edge = Builder.AddBlock();
+
+        Builder.State(Edge).IsSealed = TRUE;
+        Builder.AddEdge(Current, Edge, Depth);
+        for (SIZE_T i = 0; i < Target.KeepCount; i++)
+          Builder.Write(Edge, LocalCount + static_cast<UINT32>(TargetDepth - Target.KeepCount + i), Stack[Depth - Target.KeepCount + i]);
+        Builder.AddEdge(Edge, TargetBlock, TargetDepth);
+        Ssa.Blocks[Edge].Terminator = ssa_terminator::eJump;
+        Ssa.Blocks[Edge].Successors = {TargetBlock};
+        Ssa.Order.push_back(Edge);
+        return Edge;
+      };
+
+    std::vector<UINT32> LoopHeaders;
+
+    for (SIZE_T Ip = 0; Ip < Code.size(); Ip += GetCompiledInstructionLength(Code[Ip]))
+    {
+      const bin::instruction Instruction = Code[Ip].Instruction;
+
+      if (BlockAt[Ip] != SSA_NONE)
+      {
+        const UINT32 Block = BlockAt[Ip];
+
+        // Fallthrough
+        if (Current != SSA_NONE)
+        {
+          Finish(ssa_terminator::eJump, {Block});
+          Builder.AddEdge(Current, Block, Stack.size());
+        }
+        Current = SSA_NONE;
+
+        // Blocks without predecessors are unreachable
+        if (Ssa.Blocks[Block].Predecessors.empty())
+          continue;
+        Current = Block;
+        Ssa.Order.push_back(Block);
+        if (Builder.State(Block).IsLoopHeader)
+          LoopHeaders.push_back(Block);
+        else
+          Builder.Seal(Block);
+
+        Stack.clear();
+        for (UINT32 Position = 0; Position < Builder.State(Block).Depth; Position++)
+          Stack.push_back(Builder.Read(Block, LocalCount + Position));
+      }
+      if (Current == SSA_NONE)
+        continue;
+
+      switch (Instruction)
+      {
+      case bin::instruction::eNop:
+        break;
+
+      case bin::instruction::eUnreachable:
+        Finish(ssa_terminator::eTrap, {});
+        Current = SSA_NONE;
+        break;
+
+      case bin::instruction::eReturn:
+        {
+          const UINT32 Result = Function.ReturnSize != 0 ? Stack.back() : SSA_NONE;
+
+          Finish(ssa_terminator::eReturn, {}, Result);
+          Current = SSA_NONE;
+          break;
+        }
+
+      case bin::instruction::eCall:
+        {
+          const UINT32 FunctionIndex = WATAP_STANDARD_IMM_U32(1);
+          const function_signature &Signature = Source.FunctionSignatures[Source.FunctionSignatureIndices[FunctionIndex]];
+          const SIZE_T Base = Stack.size() - Signature.ArgumentTypes.size();
+          std::vector<UINT32> Arguments(Stack.begin() + Base, Stack.end());
+
+          if (std::ranges::any_of(Signature.ArgumentTypes, []( bin::value_type Type ) { return bin::GetValueTypeSize(Type) > sizeof(UINT64); })
+            || (Signature.ReturnType && bin::GetValueTypeSize(*Signature.ReturnType) > sizeof(UINT64)))
+            return FALSE;
+          Stack.resize(Base);
+          Emit(Instruction, std::move(Arguments), Signature.ReturnType && IsFloatType(*Signature.ReturnType), Signature.ReturnType.has_value(), FunctionIndex);
+          break;
+        }
+
+      // 'if' continues to the next instruction if condition isn't zero
+      case bin::instruction::eIf:
+      case bin::instruction::eBrIf:
+        {
+          const UINT32 Condition = Pop();
+          const UINT32 Next = BlockAt[Ip + GetCompiledInstructionLength(Code[Ip])];
+          const branch_target &Target = Targets[WATAP_STANDARD_IMM_U32(1)];
+
+          Finish(ssa_terminator::eBranch, {}, Condition);
+
+          const UINT32 Taken = Branch(Target);
+
+          Builder.AddEdge(Current, Next, Stack.size());
+          Ssa.Blocks[Current].Successors = Instruction == bin::instruction::eIf ? std::vector<UINT32> {Next, Taken} : std::vector<UINT32> {Taken, Next};
+          Current = SSA_NONE;
+          break;
+        }
+
+      // Label values are moved on operand stack
+      case bin::instruction::eBr:
+        {
+          const branch_target &Target = Targets[WATAP_STANDARD_IMM_U32(1)];
+          const SIZE_T TargetDepth = Stack.size() - Target.DropCount;
+
+          if (Target.DropCount != 0)
+          {
+            std::move(Stack.end() - Target.KeepCount, Stack.end(), Stack.begin() + (TargetDepth - Target.KeepCount));
+            Stack.resize(TargetDepth);
+          }
+          Finish(ssa_terminator::eJump, {BlockAt[Target.Ip]});
+          Builder.AddEdge(Current, BlockAt[Target.Ip], TargetDepth);
+          Current = SSA_NONE;
+          break;
+        }
+
+      // The last successor is the default one
+      case bin::instruction::eBrTable:
+        {
+          const UINT32 Index = Pop();
+          std::vector<UINT32> Successors;
+
+          Finish(ssa_terminator::eTable, {}, Index);
+          for (UINT32 i = 0; i <= WATAP_STANDARD_IMM_U32(3); i++)
+            Successors.push_back(Branch(Targets[WATAP_STANDARD_IMM_U32(1) + i]));
+          Ssa.Blocks[Current].Successors = std::move(Successors);
+          Current = SSA_NONE;
+          break;
+        }
+
+      case bin::instruction::eDrop:
+        Pop();
+        break;
+
+      case bin::instruction::eSelect:
+        {
+          const UINT32 Condition = Pop();
+          const UINT32 Rhs = Pop();
+          const UINT32 Lhs = Pop();
+
+          if (Ssa.Values[Condition].Kind == ssa_kind::eConstant)
+            Stack.push_back(static_cast<UINT32>(Ssa.Values[Condition].Immediate) != 0 ? Lhs : Rhs);
+          else
+            Emit(Instruction, {Lhs, Rhs, Condition}, Ssa.Values[Lhs].IsFloat);
+          break;
+        }
+
+      case bin::instruction::eLocalGet:
+      case bin::instruction::eLocalSet:
+      case bin::instruction::eLocalTee:
+        {
+          const UINT16 Local = WATAP_STANDARD_IMM_U16(1);
+
+          if (Local >= LocalCount)
+            return FALSE;
+          if (Instruction == bin::instruction::eLocalGet)
+            Stack.push_back(Builder.Read(Current, Local));
+          else
+            Builder.Write(Current, Local, Instruction == bin::instruction::eLocalSet ? Pop() : Stack.back());
+          break;
+        }
+
+      case bin::instruction::eMemorySize:
+        Emit(Instruction, {}, FALSE);
+        break;
+
+      case bin::instruction::eMemoryGrow:
+        Emit(Instruction, {Pop()}, FALSE);
+        break;
+
+      // Bulk memory instruction immediate is system instruction code (low byte) and data segment index
+      case bin::instruction::eSystem:
+        {
+          const bin::system_instruction SystemInstruction = Code[Ip].SystemInstruction;
+          const SIZE_T Base = Stack.size() - (SystemInstruction == bin::system_instruction::eDataDrop ? 0 : 3);
+          const UINT64 SegmentIndex = GetCompiledInstructionLength(Code[Ip]) > 1 ? WATAP_STANDARD_IMM_U32(1) : 0;
+          std::vector<UINT32> Operands(Stack.begin() + Base, Stack.end());
+
+          Stack.resize(Base);
+          Emit(Instruction, std::move(Operands), FALSE, FALSE, SegmentIndex << 8 | static_cast<UINT8>(SystemInstruction));
+          break;
+        }
+
+      // 32 bit integer constants are sign extended, so they fit instruction immediates
+      case bin::instruction::eI32Const:
+        Stack.push_back(Builder.Constant(static_cast<UINT64>(static_cast<INT64>(static_cast<INT32>(WATAP_STANDARD_IMM_U32(1)))), FALSE));
+        break;
+
+      case bin::instruction::eF32Const:
+        Stack.push_back(Builder.Constant(WATAP_STANDARD_IMM_U32(1), TRUE));
+        break;
+
+      case bin::instruction::eI64Const:
+      case bin::instruction::eF64Const:
+        Stack.push_back(Builder.Constant(WATAP_STANDARD_IMM_U64(1), Instruction == bin::instruction::eF64Const));
+        break;
+
+      case bin::instruction::eRefNull:
+        Stack.push_back(Builder.Constant(0, FALSE));
+        break;
+
+      case bin::instruction::eRefFunc:
+        Stack.push_back(Builder.Constant(WATAP_STANDARD_IMM_U32(1) + 1, FALSE));
+        break;
+
+      // Upper halves of 32 bit values are ignored, so wrap is no-op
+      WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_SSA_CASE)
+        if (Instruction != bin::instruction::eI32WrapI64)
+          Emit(Instruction, {Pop()}, IsFloatResult(Instruction));
+        break;
+
+      WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_SSA_CASE)
+        {
+          const UINT32 Rhs = Pop();
+          const UINT32 Lhs = Pop();
+
+          Emit(Instruction, {Lhs, Rhs}, IsFloatResult(Instruction));
+          break;
+        }
+
+      // Memory access offset is instruction immediate
+      WATAP_STANDARD_LOAD_INSTRUCTIONS(WATAP_STANDARD_SSA_CASE)
+        Emit(Instruction, {Pop()}, IsFloatResult(Instruction), TRUE, WATAP_STANDARD_IMM_U32(1));
+        break;
+
+      WATAP_STANDARD_STORE_INSTRUCTIONS(WATAP_STANDARD_SSA_CASE)
+        {
+          const UINT32 Value = Pop();
+          const UINT32 Address = Pop();
+
+          Emit(Instruction, {Address, Value}, FALSE, FALSE, WATAP_STANDARD_IMM_U32(1));
+          break;
+        }
+
+      default:
+        // Instruction isn't supported by SSA form
+        return FALSE;
+      }
+    }
+
+    // Validated function ends with 'return'
+    if (Current != SSA_NONE || !Builder.GetIsValid())
+      return FALSE;
+
+    // On-stack replacement entry block (it defines all locals) is the loop header predecessor, added before header is sealed
+    if (OsrTarget != SSA_NONE)
+    {
+      const UINT32 Header = BlockAt[Targets[OsrTarget].Ip];
+
+      if (std::ranges::find(LoopHeaders, Header) == LoopHeaders.end() || Builder.State(Header).Depth != 0)
+        return FALSE;
+
+      const UINT32 OsrEntry = Builder.AddBlock();
+
+      Builder.State(OsrEntry).IsSealed = TRUE;
+      for (UINT32 Local = 0; Local < LocalCount; Local++)
+        Builder.Write(OsrEntry, Local, Builder.AddValue(ssa_value { .Kind = ssa_kind::eParameter, .IsFloat = IsFloatType(LocalTypes[Local]), .Block = OsrEntry, .Immediate = Local }));
+      Ssa.Blocks[OsrEntry].Terminator = ssa_terminator::eJump;
+      Ssa.Blocks[OsrEntry].Successors = {Header};
+      Builder.AddEdge(OsrEntry, Header, 0);
+      Ssa.Order.insert(Ssa.Order.begin(), OsrEntry);
+    }
+
+    // All loop header predecessors are known now
+    for (UINT32 Block : LoopHeaders)
+      Builder.Seal(Block);
+
+    // Blocks, that aren't reachable from on-stack replacement entry (function entry, code before loop, etc.), are removed with their phi operands
+    if (OsrTarget != SSA_NONE)
+    {
+      std::vector<BOOL> IsReachable(Ssa.Blocks.size(), FALSE);
+      std::vector<UINT32> Pending {Ssa.Order[0]};
+
+      IsReachable[Ssa.Order[0]] = TRUE;
+      while (!Pending.empty())
+      {
+        const UINT32 Block = Pending.back();
+
+        Pending.pop_back();
+        for (UINT32 Successor : Ssa.Blocks[Block].Successors)
+          if (!IsReachable[Successor])
+          {
+            IsReachable[Successor] = TRUE;
+            Pending.push_back(Successor);
+          }
+      }
+      std::erase_if(Ssa.Order, [&]( UINT32 Block ) { return !IsReachable[Block]; });
+      for (UINT32 Block : Ssa.Order)
+      {
+        std::vector<UINT32> &Predecessors = Ssa.Blocks[Block].Predecessors;
+
+        for (SIZE_T i = Predecessors.size(); i-- > 0; )
+          if (!IsReachable[Predecessors[i]])
+          {
+            for (UINT32 Phi : Ssa.Blocks[Block].Phis)
+              Ssa.Values[Phi].Operands.erase(Ssa.Values[Phi].Operands.begin() + i);
+            Predecessors.erase(Predecessors.begin() + i);
+          }
+      }
+    }
+
+    // Trivial phis (all operands are the same value or phi itself) are replaced by their operand
+    const UINT32 Zero = Builder.Constant(0, FALSE);
+    std::vector<UINT32> Forward(Ssa.Values.size(), SSA_NONE);
+    BOOL IsChanged;
+
+    do
+    {
+      IsChanged = FALSE;
+      for (UINT32 Block : Ssa.Order)
+        for (UINT32 Phi : Ssa.Blocks[Block].Phis)
+        {
+          if (Forward[Phi] != SSA_NONE)
+            continue;
+
+          UINT32 Same = SSA_NONE;
+          BOOL IsTrivial = TRUE;
+
+          for (UINT32 Operand : Ssa.Values[Phi].Operands)
+          {
+            while (Forward[Operand] != SSA_NONE)
+              Operand = Forward[Operand];
+            if (Operand == Phi || Operand == Same)
+              continue;
+            if (Same != SSA_NONE)
+            {
+              IsTrivial = FALSE;
+              break;
+            }
+            Same = Operand;
+          }
+          if (IsTrivial)
+          {
+            Forward[Phi] = Same == SSA_NONE ? Zero : Same;
+            IsChanged = TRUE;
+          }
+        }
+    } while (IsChanged);
+    ReplaceValues(Ssa, Forward);
+
+    // Phi class is floating point if all its operands are floating point ones (mismatched values are moved between register classes)
+    for (UINT32 Block : Ssa.Order)
+      for (UINT32 Phi : Ssa.Blocks[Block].Phis)
+        Ssa.Values[Phi].IsFloat = TRUE;
+    do
+    {
+      IsChanged = FALSE;
+      for (UINT32 Block : Ssa.Order)
+        for (UINT32 Phi : Ssa.Blocks[Block].Phis)
+        {
+          const BOOL IsFloat = std::ranges::all_of(Ssa.Values[Phi].Operands, [&]( UINT32 Operand ) { return Ssa.Values[Operand].IsFloat; });
+
+          if (IsFloat != Ssa.Values[Phi].IsFloat)
+          {
+            Ssa.Values[Phi].IsFloat = IsFloat;
+            IsChanged = TRUE;
+          }
+        }
+    } while (IsChanged);
+    return TRUE;
+  } /* End of 'BuildSsa' function */
+
+  /* SSA form optimization (global value numbering, loop-invariant code motion, dead code elimination) function.
+   * ARGUMENTS:
+   *   - function to optimize:
+   *       ssa_function &Ssa;
+   * RETURNS: None.
+   */
+  VOID OptimizeSsa( ssa_function &Ssa )
+  {
+    std::vector<ssa_block> &Blocks = Ssa.Blocks;
+    std::vector<ssa_value> &Values = Ssa.Values;
+
+    // Dominators (Cooper, Harvey, Kennedy algorithm, layout order is reverse postorder of forward edges)
+    for (SIZE_T i = 0; i < Ssa.Order.size(); i++)
+      Blocks[Ssa.Order[i]].Index = static_cast<UINT32>(i);
+    Blocks[Ssa.Order[0]].Dominator = Ssa.Order[0];
+
+    auto Intersect = [&]( UINT32 Lhs, UINT32 Rhs )
+      {
+        while (Lhs != Rhs)
+        {
+          while (Blocks[Lhs].Index > Blocks[Rhs].Index)
+            Lhs = Blocks[Lhs].Dominator;
+          while (Blocks[Rhs].Index > Blocks[Lhs].Index)
+            Rhs = Blocks[Rhs].Dominator;
+        }
+        return Lhs;
+      };
+
+    for (BOOL IsChanged = TRUE; IsChanged; )
+    {
+      IsChanged = FALSE;
+      for (SIZE_T i = 1; i < Ssa.Order.size(); i++)
+      {
+        ssa_block &Block = Blocks[Ssa.Order[i]];
+        UINT32 Dominator = SSA_NONE;
+
+        for (UINT32 Predecessor : Block.Predecessors)
+          if (Blocks[Predecessor].Dominator != SSA_NONE)
+            Dominator = Dominator == SSA_NONE ? Predecessor : Intersect(Predecessor, Dominator);
+        if (Dominator != Block.Dominator)
+        {
+          Block.Dominator = Dominator;
+          IsChanged = TRUE;
+        }
+      }
+    }
+
+    // Dominator tree preorder/postorder numbering (block dominates another one if its numbers enclose another block ones)
+    std::vector<std::vector<UINT32>> Children(Blocks.size());
+    std::vector<UINT32> Enter(Blocks.size()), Leave(Blocks.size());
+    std::vector<std::pair<UINT32, SIZE_T>> Path {{Ssa.Order[0], 0}};
+    UINT32 Clock = 0;
+
+    for (SIZE_T i = 1; i < Ssa.Order.size(); i++)
+      Children[Blocks[Ssa.Order[i]].Dominator].push_back(Ssa.Order[i]);
+    Enter[Ssa.Order[0]] = Clock++;
+    while (!Path.empty())
+    {
+      auto &[Block, Child] = Path.back();
+
+      if (Child < Children[Block].size())
+      {
+        const UINT32 Next = Children[Block][Child++];
+
+        Enter[Next] = Clock++;
+        Path.push_back({Next, 0});
+      }
+      else
+      {
+        Leave[Block] = Clock++;
+        Path.pop_back();
+      }
+    }
+
+    auto Dominates = [&]( UINT32 Dominator, UINT32 Block )
+      {
+        return Enter[Dominator] <= Enter[Block] && Leave[Block] <= Leave[Dominator];
+      };
+
+    // Global value numbering (blocks are visited in layout order, so dominating instructions are already numbered)
+    std::vector<UINT32> Forward(Values.size(), SSA_NONE);
+    std::map<std::tuple<bin::instruction, UINT64, std::vector<UINT32>>, std::vector<UINT32>> Numbers;
+
+    for (UINT32 BlockIndex : Ssa.Order)
+      for (UINT32 Value : Blocks[BlockIndex].Code)
+      {
+        ssa_value &Instruction = Values[Value];
+
+        for (UINT32 &Operand : Instruction.Operands)
+          while (Forward[Operand] != SSA_NONE)
+            Operand = Forward[Operand];
+        if (!IsPure(Instruction.Instruction))
+          continue;
+
+        std::vector<UINT32> Operands = Instruction.Operands;
+
+        if (IsCommutative(Instruction.Instruction) && Operands[0] > Operands[1])
+          std::swap(Operands[0], Operands[1]);
+
+        std::vector<UINT32> &Candidates = Numbers[{Instruction.Instruction, Instruction.Immediate, std::move(Operands)}];
+
+        if (auto Iter = std::ranges::find_if(Candidates, [&]( UINT32 Candidate ) { return Dominates(Values[Candidate].Block, BlockIndex); });
+            Iter != Candidates.end())
+          Forward[Value] = *Iter;
+        else
+          Candidates.push_back(Value);
+      }
+    ReplaceValues(Ssa, Forward);
+
+    // Loop-invariant code motion (loop of header is range of blocks from header to the last block with back edge to it)
+    for (SIZE_T HeaderIndex = Ssa.Order.size(); HeaderIndex-- > 1; )
+    {
+      const UINT32 Header = Ssa.Order[HeaderIndex];
+      UINT32 End = 0;
+
+      for (UINT32 Predecessor : Blocks[Header].Predecessors)
+        End = std::max(End, Blocks[Predecessor].Index);
+      if (End < HeaderIndex)
+        continue;
+
+      const UINT32 Preheader = Blocks[Header].Dominator;
+
+      // Loop, entered by on-stack replacement, has no entry edge, so header may be dominated by block inside loop
+      if (Blocks[Preheader].Index >= HeaderIndex)
+        continue;
+
+      auto IsOutside = [&]( UINT32 Operand )
+        {
+          return Values[Operand].Kind == ssa_kind::eConstant || Blocks[Values[Operand].Block].Index < HeaderIndex;
+        };
+
+      std::vector<UINT32> Hoisted;
+
+      for (SIZE_T i = HeaderIndex; i <= End; i++)
+        std::erase_if(Blocks[Ssa.Order[i]].Code, [&]( UINT32 Value )
+          {
+            ssa_value &Instruction = Values[Value];
+
+            if (!IsPure(Instruction.Instruction) || IsTrapping(Instruction.Instruction) || !std::ranges::all_of(Instruction.Operands, IsOutside))
+              return FALSE;
+            Instruction.Block = Preheader;
+            Hoisted.push_back(Value);
+            return TRUE;
+          });
+      Blocks[Preheader].Code.insert(Blocks[Preheader].Code.end(), Hoisted.begin(), Hoisted.end());
+    }
+
+    // Dead code elimination (instructions with side effects, that may trap and terminator operands are live)
+    std::vector<BOOL> IsLive(Values.size(), FALSE);
+    std::vector<UINT32> Work;
+
+    auto MarkLive = [&]( UINT32 Value )
+      {
+        if (!IsLive[Value])
+        {
+          IsLive[Value] = TRUE;
+          Work.push_back(Value);
+        }
+      };
+
+    for (UINT32 BlockIndex : Ssa.Order)
+    {
+      for (UINT32 Value : Blocks[BlockIndex].Code)
+        if ((!IsPure(Values[Value].Instruction) && Values[Value].Instruction != bin::instruction::eMemorySize) || IsTrapping(Values[Value].Instruction))
+          MarkLive(Value);
+      if (Blocks[BlockIndex].Operand != SSA_NONE)
+        MarkLive(Blocks[BlockIndex].Operand);
+    }
+    while (!Work.empty())
+    {
+      const UINT32 Value = Work.back();
+
+      Work.pop_back();
+      for (UINT32 Operand : Values[Value].Operands)
+        MarkLive(Operand);
+    }
+    for (UINT32 BlockIndex : Ssa.Order)
+    {
+      std::erase_if(Blocks[BlockIndex].Phis, [&]( UINT32 Value ) { return !IsLive[Value]; });
+      std::erase_if(Blocks[BlockIndex].Code, [&]( UINT32 Value ) { return !IsLive[Value]; });
+    }
+
+    // Comparison and conditional branch fusion (comparison must be the last block instruction with the only use by branch)
+    std::vector<UINT32> UseCounts(Values.size(), 0);
+
+    for (UINT32 BlockIndex : Ssa.Order)
+    {
+      for (UINT32 Value : Blocks[BlockIndex].Phis)
+        for (UINT32 Operand : Values[Value].Operands)
+          UseCounts[Operand]++;
+      for (UINT32 Value : Blocks[BlockIndex].Code)
+        for (UINT32 Operand : Values[Value].Operands)
+          UseCounts[Operand]++;
+      if (Blocks[BlockIndex].Operand != SSA_NONE)
+        UseCounts[Blocks[BlockIndex].Operand]++;
+    }
+    for (UINT32 BlockIndex : Ssa.Order)
+    {
+      ssa_block &Block = Blocks[BlockIndex];
+
+      if (Block.Terminator == ssa_terminator::eBranch && !Block.Code.empty() && Block.Code.back() == Block.Operand
+        && UseCounts[Block.Operand] == 1 && IsFusable(Values[Block.Operand].Instruction))
+        Values[Block.Operand].IsFused = TRUE;
+    }
+  } /* End of 'OptimizeSsa' function */
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_ssa.cpp' FILE */
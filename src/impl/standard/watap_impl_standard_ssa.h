@@ -0,0 +1,101 @@
+#ifndef __watap_impl_standard_ssa_h_
+#define __watap_impl_standard_ssa_h_
+
+#include "watap_impl_standard_exec.h"
+
+/***
+ * SSA form intermediate representation of optimizing compiler.
+ *
+ * Every value is defined exactly once: by function parameter, constant, phi (at block start, operands
+ * are parallel to block predecessors) or instruction. Instructions are stack bytecode numeric, memory
+ * access and call instructions with explicit operands, control flow is expressed by block terminators.
+ ***/
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* No value/block index */
+  constexpr UINT32 SSA_NONE = ~0U;
+
+  /* SSA value definition kind representation enumeration */
+  enum class ssa_kind : UINT8
+  {
+    eParameter,   // Function argument ('Immediate' is argument index)
+    eConstant,    // Constant ('Immediate' is bit pattern), constants belong to no block and are materialized by consumers
+    ePhi,         // Phi function
+    eInstruction, // Instruction ('Immediate' is memory access offset, index of function to call or bulk memory instruction and data segment index)
+  }; /* End of 'ssa_kind' enumeration */
+
+  /* SSA block terminator representation enumeration */
+  enum class ssa_terminator : UINT8
+  {
+    eJump,   // Jump to the only successor
+    eBranch, // Jump to the first successor if operand isn't zero, to the second one otherwise
+    eTable,  // Jump to successor by operand (out of range operand selects the last successor)
+    eReturn, // Function return (operand is return value, if function has it)
+    eTrap,   // Trap
+  }; /* End of 'ssa_terminator' enumeration */
+
+  /* SSA value representation structure */
+  struct ssa_value
+  {
+    ssa_kind Kind;                                         // Definition kind
+    bin::instruction Instruction = bin::instruction::eNop; // Instruction ('eInstruction' values only)
+    BOOL IsFloat = FALSE;                                  // Is value floating point one (is kept in SSE register)
+    BOOL HasResult = TRUE;                                 // Does value have result (stores and calls without result don't)
+    BOOL IsFused = FALSE;                                  // Is comparison fused with conditional branch of its block (value isn't materialized)
+    UINT32 Block = SSA_NONE;                               // Block, value is defined in
+    UINT64 Immediate = 0;                                  // Immediate (by value kind)
+    std::vector<UINT32> Operands;                          // Operand values
+  }; /* End of 'ssa_value' structure */
+
+  /* SSA basic block representation structure */
+  struct ssa_block
+  {
+    std::vector<UINT32> Predecessors;                  // Predecessor blocks (one entry per edge)
+    std::vector<UINT32> Successors;                    // Successor blocks (by terminator)
+    std::vector<UINT32> Phis;                          // Phi values
+    std::vector<UINT32> Code;                          // Instruction values (in execution order)
+    ssa_terminator Terminator = ssa_terminator::eTrap; // Terminator
+    UINT32 Operand = SSA_NONE;                         // Terminator operand (condition, table index or return value)
+    UINT32 Dominator = SSA_NONE;                       // Immediate dominator
+    UINT32 Index = SSA_NONE;                           // Index of block in layout order
+  }; /* End of 'ssa_block' structure */
+
+  /* SSA form function representation structure */
+  struct ssa_function
+  {
+    std::vector<ssa_value> Values; // Values
+    std::vector<ssa_block> Blocks; // Blocks (the first one is entry)
+    std::vector<UINT32> Order;     // Reachable blocks in layout order (every block follows its dominators, loop bodies are contiguous)
+  }; /* End of 'ssa_function' structure */
+
+  /* Stack bytecode to SSA form conversion function.
+   * ARGUMENTS:
+   *   - output function:
+   *       ssa_function &Ssa;
+   *   - module source (callee signatures are taken from it):
+   *       const source_impl &Source;
+   *   - function to convert (its kept stack bytecode is converted):
+   *       const compiled_function_data &Function;
+   *   - loop header branch target index, function is entered at by on-stack replacement (entry block defines all locals
+   *     as parameters, code, reachable from loop header only, is converted), SSA_NONE to enter function at its start:
+   *       UINT32 OsrTarget;
+   * RETURNS:
+   *   (BOOL) TRUE if function is converted, FALSE if it contains values or instructions SSA form doesn't support
+   *   (or operand stack isn't empty at on-stack replacement loop header);
+   */
+  BOOL BuildSsa( ssa_function &Ssa, const source_impl &Source, const compiled_function_data &Function, UINT32 OsrTarget = SSA_NONE );
+
+  /* SSA form optimization (global value numbering, loop-invariant code motion, dead code elimination) function.
+   * ARGUMENTS:
+   *   - function to optimize:
+   *       ssa_function &Ssa;
+   * RETURNS: None.
+   */
+  VOID OptimizeSsa( ssa_function &Ssa );
+} /* end of 'watap::impl::standard' namespace */
+
+#endif // !defined(__watap_impl_standard_ssa_h_)
+
+/* END OF 'watap_impl_standard_ssa.h' FILE */
@@ -0,0 +1,1553 @@
+#define WATAP_IMPL_STANDARD
+
+#include "watap_impl_standard_interface.h"
+#include "watap_impl_standard_ssa.h"
+#include "watap_impl_standard_x86.h"
+
+#include <algorithm>
+
+/***
+ * Optimized native code.
+ *
+ * Optimizing compiler back end: SSA form function (built from kept stack bytecode and optimized by
+ * global value numbering, loop-invariant code motion and dead code elimination) is compiled to
+ * x86-64 machine code with linear scan register allocation.
+ *
+ * Blocks are numbered in layout order (2 positions per block start, instruction and terminator),
+ * every value gets single live interval from its definition to its last use (values, live at loop
+ * back edge, are extended over the whole loop by liveness analysis). Intervals are allocated to
+ * registers by linear scan (Poletto and Sarkar), the interval, that ends the last, is spilled to
+ * stack frame slot under register pressure. Values, live across calls, are allocated to callee-saved
+ * registers or spilled. Phis are resolved by parallel moves on control flow edges.
+ *
+ * Register usage (System V calling convention):
+ *   rsi, rdi, r8-r10, rbx, rbp, r15 - integer values (rbx, rbp and r15 are kept by calls);
+ *   xmm1-xmm14 - floating point values (all are clobbered by calls);
+ *   r12 - native code execution context, r13 - linear memory data, r14 - linear memory size;
+ *   rax, rcx, rdx, r11, xmm0 and xmm15 - scratch registers of instruction sequences.
+ * Stack frame consists of outgoing call/helper argument slots and spill slots.
+ *
+ * Functions are compiled on tier-up (call or loop back edge counter of function reaches threshold),
+ * optimized functions call each other directly, the rest of functions are called through instance.
+ ***/
+
+/* Instruction list entry to 'case' label conversion macro */
+#define WATAP_STANDARD_SSA_NATIVE_CASE(NAME, ...) case bin::instruction::NAME:
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+#if defined(WATAP_STANDARD_NATIVE_CODE)
+  /* Optimized code value location kind enumeration */
+  enum class ssa_location_kind : UINT8
+  {
+    eNone,     // No location (value isn't used)
+    eGeneral,  // General purpose register
+    eVector,   // SSE register
+    eSlot,     // Spill slot
+    eConstant, // Constant (it is materialized by value consumer)
+  }; /* End of 'ssa_location_kind' enumeration */
+
+  /* Optimized code value location representation structure */
+  struct ssa_location
+  {
+    ssa_location_kind Kind = ssa_location_kind::eNone; // Location kind
+    UINT64 Value = 0;                                  // Register, spill slot index or constant (by location kind)
+
+    /* Location comparison operator */
+    BOOL operator==( const ssa_location &Other ) const = default;
+  }; /* End of 'ssa_location' structure */
+
+  /* Value live interval representation structure */
+  struct ssa_interval
+  {
+    UINT32 Value;             // Value
+    UINT32 Start;             // Definition position
+    UINT32 End;               // Last use position
+    BOOL IsCallCrossing;      // Does interval contain call (value must be kept by callee-saved register or spill slot)
+  }; /* End of 'ssa_interval' structure */
+
+  /* Registers available for values (callee-saved ones are taken by values, live across calls, only) */
+  constexpr UINT32 SSA_GENERAL_REGISTERS = 1U << eRsi | 1U << eRdi | 1U << eR8 | 1U << eR9 | 1U << eR10 | 1U << eRbx | 1U << eRbp | 1U << eR15;
+  constexpr UINT32 SSA_CALLEE_SAVED_REGISTERS = 1U << eRbx | 1U << eRbp | 1U << eR15;
+  constexpr UINT32 SSA_VECTOR_REGISTERS = 0x7FFE; // xmm1-xmm14
+
+  /* SSE scratch register of instruction sequences (xmm0 is scratch of spilled value results) */
+  constexpr UINT8 SSA_VECTOR_SCRATCH = 15;
+
+  /* Optional instruction set extensions availability */
+  static const BOOL IsPopcntSupported = []( VOID ) -> BOOL { __builtin_cpu_init(); return __builtin_cpu_supports("popcnt") != 0; }();
+  static const BOOL IsSse41Supported = []( VOID ) -> BOOL { __builtin_cpu_init(); return __builtin_cpu_supports("sse4.1") != 0; }();
+
+  /* Instruction, that is compiled to call (of function, runtime or numeric helper), checking function.
+   * ARGUMENTS:
+   *   - instruction:
+   *       bin::instruction Instruction;
+   * RETURNS:
+   *   (BOOL) TRUE if instruction is call, FALSE otherwise;
+   */
+  static BOOL IsCallInstruction( bin::instruction Instruction ) noexcept
+  {
+    switch (Instruction)
+    {
+    case bin::instruction::eCall         :
+    case bin::instruction::eMemoryGrow   :
+    case bin::instruction::eSystem       :
+    case bin::instruction::eI32TruncF32S :
+    case bin::instruction::eI32TruncF32U :
+    case bin::instruction::eI32TruncF64S :
+    case bin::instruction::eI32TruncF64U :
+    case bin::instruction::eI64TruncF32S :
+    case bin::instruction::eI64TruncF32U :
+    case bin::instruction::eI64TruncF64S :
+    case bin::instruction::eI64TruncF64U :
+    case bin::instruction::eF32ConvertI64U :
+    case bin::instruction::eF64ConvertI64U :
+    case bin::instruction::eF32Min       :
+    case bin::instruction::eF32Max       :
+    case bin::instruction::eF32CopySign  :
+    case bin::instruction::eF64Min       :
+    case bin::instruction::eF64Max       :
+    case bin::instruction::eF64CopySign  :
+      return TRUE;
+
+    case bin::instruction::eI32Popcnt    :
+    case bin::instruction::eI64Popcnt    :
+      return !IsPopcntSupported;
+
+    case bin::instruction::eF32Ceil      :
+    case bin::instruction::eF32Floor     :
+    case bin::instruction::eF32Trunc     :
+    case bin::instruction::eF32Nearest   :
+    case bin::instruction::eF64Ceil      :
+    case bin::instruction::eF64Floor     :
+    case bin::instruction::eF64Trunc     :
+    case bin::instruction::eF64Nearest   :
+      return !IsSse41Supported;
+
+    default:
+      return FALSE;
+    }
+  } /* End of 'IsCallInstruction' function */
+#endif // defined(WATAP_STANDARD_NATIVE_CODE)
+
+  /* Stack bytecode to optimized native code (SSA form based) compilation function.
+   * ARGUMENTS:
+   *   - function to compile (its stack bytecode copy is compiled):
+   *       const compiled_function_data &Function;
+   *   - loop header branch target index to enter code at (all locals are read from frame, operand stack must be empty at loop header),
+   *     ~0 to enter code at function start:
+   *       UINT32 OsrTarget;
+   * RETURNS:
+   *   (std::shared_ptr<const VOID>) Executable pages (entry point is at their start), nullptr if code isn't supported by host or function;
+   */
+  std::shared_ptr<const VOID> source_impl::CompileOptimized( const compiled_function_data &Function, UINT32 OsrTarget ) const
+  {
+#if defined(WATAP_STANDARD_NATIVE_CODE)
+    constexpr ssa_location_kind eNone = ssa_location_kind::eNone;
+    constexpr ssa_location_kind eGeneral = ssa_location_kind::eGeneral;
+    constexpr ssa_location_kind eVector = ssa_location_kind::eVector;
+    constexpr ssa_location_kind eSlot = ssa_location_kind::eSlot;
+    constexpr ssa_location_kind eConstant = ssa_location_kind::eConstant;
+
+    ssa_function Ssa;
+
+    if (Function.StackBytecode == nullptr || !BuildSsa(Ssa, *this, Function, OsrTarget))
+      return nullptr;
+    OptimizeSsa(Ssa);
+
+    const std::vector<ssa_value> &Values = Ssa.Values;
+    const std::vector<ssa_block> &Blocks = Ssa.Blocks;
+    const UINT32 Entry = Ssa.Order[0];
+
+    // Value, that is kept in register or slot, checking function (constants are materialized, fused comparisons set flags only)
+    auto IsAllocated = [&]( UINT32 Value ) -> BOOL
+      {
+        return Values[Value].Kind != ssa_kind::eConstant && Values[Value].HasResult && !Values[Value].IsFused;
+      };
+
+    // Predecessor index of edge (phi operand index) getting function
+    auto GetEdgeIndex = [&]( UINT32 Block, UINT32 Successor ) -> SIZE_T
+      {
+        const std::vector<UINT32> &Predecessors = Blocks[Successor].Predecessors;
+
+        return static_cast<SIZE_T>(std::ranges::find(Predecessors, Block) - Predecessors.begin());
+      };
+
+    /***
+     * Positions
+     ***/
+
+    std::vector<UINT32> From(Blocks.size(), 0);         // Block start positions (phis are defined at them)
+    std::vector<UINT32> To(Blocks.size(), 0);           // Block terminator positions
+    std::vector<UINT32> Positions(Values.size(), 0);    // Value definition positions (arguments are defined at 0)
+    std::vector<UINT32> CallPositions;                  // Positions of call instructions (in ascending order)
+    SIZE_T ArgumentSlotCount = 2;                       // Count of outgoing call/helper argument slots
+    UINT32 Position = 0;
+
+    for (UINT32 Block : Ssa.Order)
+    {
+      From[Block] = Position;
+      for (UINT32 Phi : Blocks[Block].Phis)
+        Positions[Phi] = Position;
+      Position += 2;
+      for (UINT32 Value : Blocks[Block].Code)
+      {
+        Positions[Value] = Position;
+        if (IsCallInstruction(Values[Value].Instruction))
+          CallPositions.push_back(Position);
+        if (Values[Value].Instruction == bin::instruction::eCall || Values[Value].Instruction == bin::instruction::eSystem)
+          ArgumentSlotCount = std::max(ArgumentSlotCount, Values[Value].Operands.size());
+        Position += 2;
+      }
+      To[Block] = Position;
+      Position += 2;
+    }
+
+    /***
+     * Liveness (iterative data flow analysis on value bit sets)
+     ***/
+
+    const SIZE_T WordCount = (Values.size() + 63) / 64;
+    std::vector<std::vector<UINT64>> LiveIn(Blocks.size(), std::vector<UINT64>(WordCount, 0));
+    std::vector<std::vector<UINT64>> LiveOut(Blocks.size(), std::vector<UINT64>(WordCount, 0));
+    std::vector<UINT64> Live(WordCount);
+
+    auto Set = [&]( UINT32 Value )
+      {
+        if (IsAllocated(Value))
+          Live[Value / 64] |= 1ULL << Value % 64;
+      };
+
+    auto Clear = [&]( UINT32 Value )
+      {
+        Live[Value / 64] &= ~(1ULL << Value % 64);
+      };
+
+    for (BOOL IsChanged = TRUE; IsChanged; )
+    {
+      IsChanged = FALSE;
+      for (auto Iterator = Ssa.Order.rbegin(); Iterator != Ssa.Order.rend(); Iterator++)
+      {
+        const UINT32 Block = *Iterator;
+        const ssa_block &Data = Blocks[Block];
+
+        // Successor live-in sets exclude their phis, phi operands are live at the end of predecessor
+        std::ranges::fill(Live, 0);
+        for (SIZE_T i = 0; i < Data.Successors.size(); i++)
+        {
+          const UINT32 Successor = Data.Successors[i];
+
+          if (std::find(Data.Successors.begin(), Data.Successors.begin() + i, Successor) != Data.Successors.begin() + i)
+            continue;
+          for (SIZE_T Word = 0; Word < WordCount; Word++)
+            Live[Word] |= LiveIn[Successor][Word];
+
+          const SIZE_T Index = GetEdgeIndex(Block, Successor);
+
+          for (UINT32 Phi : Blocks[Successor].Phis)
+            Set(Values[Phi].Operands[Index]);
+        }
+        LiveOut[Block] = Live;
+
+        if (Data.Operand != SSA_NONE)
+        {
+          if (Values[Data.Operand].IsFused)
+            for (UINT32 Operand : Values[Data.Operand].Operands)
+              Set(Operand);
+          else
+            Set(Data.Operand);
+        }
+        for (auto Value = Data.Code.rbegin(); Value != Data.Code.rend(); Value++)
+        {
+          if (Values[*Value].IsFused)
+            continue;
+          Clear(*Value);
+          for (UINT32 Operand : Values[*Value].Operands)
+            Set(Operand);
+        }
+        for (UINT32 Phi : Data.Phis)
+          Clear(Phi);
+        if (Block == Entry)
+          for (UINT32 Value = 0; Value < Values.size(); Value++)
+            if (Values[Value].Kind == ssa_kind::eParameter)
+              Clear(Value);
+
+        if (Live != LiveIn[Block])
+        {
+          LiveIn[Block] = Live;
+          IsChanged = TRUE;
+        }
+      }
+    }
+
+    /***
+     * Live intervals
+     ***/
+
+    std::vector<UINT32> Ends(Values.size(), 0);
+
+    auto Use = [&]( UINT32 Value, UINT32 At )
+      {
+        if (IsAllocated(Value))
+          Ends[Value] = std::max(Ends[Value], At);
+      };
+
+    for (UINT32 Block : Ssa.Order)
+    {
+      const ssa_block &Data = Blocks[Block];
+
+      for (UINT32 Phi : Data.Phis)
+        for (SIZE_T i = 0; i < Data.Predecessors.size(); i++)
+          Use(Values[Phi].Operands[i], To[Data.Predecessors[i]] + 1);
+      for (UINT32 Value : Data.Code)
+        for (UINT32 Operand : Values[Value].Operands)
+          Use(Operand, Values[Value].IsFused ? To[Block] : Positions[Value]);
+      if (Data.Operand != SSA_NONE)
+        Use(Data.Operand, To[Block]);
+      for (SIZE_T Word = 0; Word < WordCount; Word++)
+        for (UINT64 Bits = LiveOut[Block][Word]; Bits != 0; Bits &= Bits - 1)
+          Use(static_cast<UINT32>(Word * 64 + std::countr_zero(Bits)), To[Block] + 1);
+    }
+
+    std::vector<ssa_interval> Intervals;
+
+    auto AddInterval = [&]( UINT32 Value )
+      {
+        Intervals.push_back(ssa_interval { Value, Positions[Value], std::max(Ends[Value], Positions[Value]), FALSE });
+      };
+
+    for (UINT32 Value = 0; Value < Values.size(); Value++)
+      if (Values[Value].Kind == ssa_kind::eParameter && Ends[Value] != 0)
+        AddInterval(Value);
+    for (UINT32 Block : Ssa.Order)
+    {
+      for (UINT32 Phi : Blocks[Block].Phis)
+        AddInterval(Phi);
+      for (UINT32 Value : Blocks[Block].Code)
+        if (IsAllocated(Value))
+          AddInterval(Value);
+    }
+    std::ranges::stable_sort(Intervals, {}, &ssa_interval::Start);
+    for (ssa_interval &Interval : Intervals)
+    {
+      auto Call = std::ranges::upper_bound(CallPositions, Interval.Start);
+
+      Interval.IsCallCrossing = Call != CallPositions.end() && *Call < Interval.End;
+    }
+
+    /***
+     * Linear scan register allocation
+     ***/
+
+    std::vector<ssa_location> Locations(Values.size());
+    std::vector<SIZE_T> Active;  // Indices of intervals, that are allocated to registers
+    std::vector<SIZE_T> Spilled; // Indices of spilled intervals
+    UINT32 FreeGeneral = SSA_GENERAL_REGISTERS;
+    UINT32 FreeVector = SSA_VECTOR_REGISTERS;
+
+    for (SIZE_T i = 0; i < Intervals.size(); i++)
+    {
+      const ssa_interval &Interval = Intervals[i];
+      const BOOL IsFloat = Values[Interval.Value].IsFloat;
+      UINT32 &Free = IsFloat ? FreeVector : FreeGeneral;
+
+      // Registers of intervals, that end before (or at) interval start, are released (instruction result may take operand register)
+      std::erase_if(Active, [&]( SIZE_T Index )
+        {
+          if (Intervals[Index].End > Interval.Start)
+            return false;
+
+          const ssa_location &Location = Locations[Intervals[Index].Value];
+
+          (Location.Kind == eVector ? FreeVector : FreeGeneral) |= 1U << Location.Value;
+          return true;
+        });
+
+      const UINT32 Allowed = IsFloat
+        ? (Interval.IsCallCrossing ? 0 : SSA_VECTOR_REGISTERS)
+        : (Interval.IsCallCrossing ? SSA_CALLEE_SAVED_REGISTERS : SSA_GENERAL_REGISTERS);
+      UINT32 Available = Free & Allowed;
+
+      // Callee-saved registers are kept for values, live across calls
+      if ((Available & ~SSA_CALLEE_SAVED_REGISTERS) != 0 && !IsFloat)
+        Available &= ~SSA_CALLEE_SAVED_REGISTERS;
+      if (Available != 0)
+      {
+        const UINT8 Register = static_cast<UINT8>(std::countr_zero(Available));
+
+        Free &= ~(1U << Register);
+        Locations[Interval.Value] = ssa_location { IsFloat ? eVector : eGeneral, Register };
+        Active.push_back(i);
+        continue;
+      }
+
+      // Active interval with allowed register, that ends the last, is spilled instead of current one if it ends later
+      SIZE_T Victim = SIZE_MAX;
+
+      for (SIZE_T Index : Active)
+        if (Values[Intervals[Index].Value].IsFloat == IsFloat
+            && (Allowed >> Locations[Intervals[Index].Value].Value & 1) != 0
+            && (Victim == SIZE_MAX || Intervals[Index].End > Intervals[Victim].End))
+          Victim = Index;
+      if (Victim != SIZE_MAX && Intervals[Victim].End > Interval.End)
+      {
+        Locations[Interval.Value] = Locations[Intervals[Victim].Value];
+        Spilled.push_back(Victim);
+        std::ranges::replace(Active, Victim, i);
+      }
+      else
+        Spilled.push_back(i);
+    }
+
+    // Spill slots are shared by spilled intervals, that don't overlap
+    std::vector<UINT32> SlotEnds;
+
+    std::ranges::sort(Spilled, {}, [&]( SIZE_T Index ) { return Intervals[Index].Start; });
+    for (SIZE_T Index : Spilled)
+    {
+      const ssa_interval &Interval = Intervals[Index];
+      auto Slot = std::ranges::find_if(SlotEnds, [&]( UINT32 End ) { return End < Interval.Start; });
+
+      if (Slot == SlotEnds.end())
+      {
+        SlotEnds.push_back(Interval.End);
+        Slot = SlotEnds.end() - 1;
+      }
+      else
+        *Slot = Interval.End;
+      Locations[Interval.Value] = ssa_location { eSlot, static_cast<UINT64>(Slot - SlotEnds.begin()) };
+    }
+
+    // Stack frame (argument slots, spill slots) keeps stack 16 byte aligned at calls (6 registers and return address are pushed before)
+    const SIZE_T SlotCount = ArgumentSlotCount + SlotEnds.size();
+    const UINT32 FrameSize = static_cast<UINT32>(SlotCount * sizeof(UINT64) + (SlotCount % 2 == 0 ? sizeof(UINT64) : 0));
+
+    if (SlotCount > 0x0FFFFFFF)
+      return nullptr;
+
+    /***
+     * Code emission
+     ***/
+
+    x86_assembler Asm;
+    std::vector<SIZE_T> Offsets(Blocks.size(), SIZE_MAX);   // Native code offsets of blocks
+    std::vector<std::pair<SIZE_T, UINT32>> BlockFixups;     // Jump displacement positions and blocks they jump to
+    std::vector<SIZE_T> TrapFixups;                         // Trap exit jump displacement positions
+    std::vector<UINT64> Pool;                               // Floating point constant and mask pool
+    std::vector<std::pair<SIZE_T, SIZE_T>> PoolFixups;      // RIP relative displacement positions and pool entries they refer to
+
+    auto Location = [&]( UINT32 Value ) -> ssa_location
+      {
+        if (Values[Value].Kind == ssa_kind::eConstant)
+          return ssa_location { eConstant, Values[Value].Immediate };
+        return Locations[Value];
+      };
+
+    auto Stack = [&]( SIZE_T Index )
+      {
+        return x86_memory { .Base = eRsp, .Displacement = static_cast<INT32>(Index * sizeof(UINT64)) };
+      };
+
+    auto Slot = [&]( UINT64 Index )
+      {
+        return Stack(ArgumentSlotCount + Index);
+      };
+
+    auto JumpTo = [&]( x86_condition Condition, UINT32 Block )
+      {
+        BlockFixups.push_back({Asm.Jump(Condition), Block});
+      };
+
+    auto JumpToTrap = [&]( x86_condition Condition )
+      {
+        TrapFixups.push_back(Asm.Jump(Condition));
+      };
+
+    // Pooled constant to SSE register loading function ('movsd xmm, [rip + constant]')
+    auto LoadPooled = [&]( UINT8 Register, UINT64 Bits )
+      {
+        auto Entry = std::ranges::find(Pool, Bits);
+
+        if (Entry == Pool.end())
+        {
+          Pool.push_back(Bits);
+          Entry = Pool.end() - 1;
+        }
+        PoolFixups.push_back({Asm.Relative({0x0F, 0x10}, Register, FALSE, 0xF2), static_cast<SIZE_T>(Entry - Pool.begin())});
+      };
+
+    // Value to memory storing function (whole 64 bit slot is written, rax is used as scratch)
+    auto Store = [&]( x86_memory Destination, const ssa_location &Source )
+      {
+        switch (Source.Kind)
+        {
+        case eGeneral:
+          Asm.Memory({0x89}, static_cast<UINT8>(Source.Value), Destination, TRUE);
+          break;
+
+        case eVector:
+          Asm.Memory({0x0F, 0x11}, static_cast<UINT8>(Source.Value), Destination, FALSE, 0xF2); // movsd [destination], xmm
+          break;
+
+        case eConstant:
+          if (static_cast<INT64>(Source.Value) == static_cast<INT32>(Source.Value))
+          {
+            Asm.Memory({0xC7}, 0, Destination, TRUE);                              // mov qword [destination], simm32
+            Asm.Dword(static_cast<UINT32>(Source.Value));
+            break;
+          }
+          Asm.MoveImmediate64(eRax, Source.Value);
+          Asm.Memory({0x89}, eRax, Destination, TRUE);
+          break;
+
+        case eSlot:
+          Asm.Memory({0x8B}, eRax, Slot(Source.Value), TRUE);
+          Asm.Memory({0x89}, eRax, Destination, TRUE);
+          break;
+
+        case eNone:
+          break;
+        }
+      };
+
+    // Value from memory loading function (rcx is used as scratch)
+    auto Fetch = [&]( const ssa_location &Destination, x86_memory Source )
+      {
+        switch (Destination.Kind)
+        {
+        case eGeneral:
+          Asm.Memory({0x8B}, static_cast<UINT8>(Destination.Value), Source, TRUE);
+          break;
+
+        case eVector:
+          Asm.Memory({0x0F, 0x10}, static_cast<UINT8>(Destination.Value), Source, FALSE, 0xF2); // movsd xmm, [source]
+          break;
+
+        case eSlot:
+          Asm.Memory({0x8B}, eRcx, Source, TRUE);
+          Asm.Memory({0x89}, eRcx, Slot(Destination.Value), TRUE);
+          break;
+
+        default:
+          break;
+        }
+      };
+
+    // Value moving function (rax is used as scratch of slot to slot moves, flags aren't changed)
+    auto MoveTo = [&]( const ssa_location &Destination, const ssa_location &Source )
+      {
+        if (Destination == Source || Destination.Kind == eNone)
+          return;
+
+        const UINT8 Register = static_cast<UINT8>(Destination.Value);
+        const UINT8 From = static_cast<UINT8>(Source.Value);
+
+        switch (Destination.Kind)
+        {
+        case eGeneral:
+          switch (Source.Kind)
+          {
+          case eGeneral  : Asm.Register({0x89}, From, Register, TRUE);                                  break;
+          case eVector   : Asm.Register({0x0F, 0x7E}, From, Register, TRUE, 0x66);                      break; // movq r64, xmm
+          case eSlot     : Asm.Memory({0x8B}, Register, Slot(Source.Value), TRUE);                      break;
+          case eConstant : Asm.MoveImmediate64(Register, Source.Value);                                 break;
+          default        :                                                                              break;
+          }
+          break;
+
+        case eVector:
+          switch (Source.Kind)
+          {
+          case eGeneral  : Asm.Register({0x0F, 0x6E}, Register, From, TRUE, 0x66);                      break; // movq xmm, r64
+          case eVector   : Asm.Register({0x0F, 0x28}, Register, From);                                  break; // movaps xmm, xmm
+          case eSlot     : Asm.Memory({0x0F, 0x10}, Register, Slot(Source.Value), FALSE, 0xF2);         break; // movsd xmm, [slot]
+          case eConstant :
+            if (Source.Value == 0)
+              Asm.Register({0x0F, 0x57}, Register, Register);                                                 // xorps xmm, xmm
+            else
+              LoadPooled(Register, Source.Value);
+            break;
+          default        :                                                                              break;
+          }
+          break;
+
+        case eSlot:
+          Store(Slot(Destination.Value), Source);
+          break;
+
+        default:
+          break;
+        }
+      };
+
+    // Value to register of class getting function (value register is taken if it has the same class, value is loaded to scratch otherwise)
+    auto Get = [&]( const ssa_location &Source, BOOL IsVector, UINT8 Scratch ) -> UINT8
+      {
+        const ssa_location_kind Kind = IsVector ? eVector : eGeneral;
+
+        if (Source.Kind == Kind)
+          return static_cast<UINT8>(Source.Value);
+        MoveTo(ssa_location { Kind, Scratch }, Source);
+        return Scratch;
+      };
+
+    // 32 bit value to register loading function (upper half is zeroed)
+    auto Load32 = [&]( UINT8 Register, const ssa_location &Source )
+      {
+        switch (Source.Kind)
+        {
+        case eGeneral  : Asm.Register({0x89}, static_cast<UINT8>(Source.Value), Register);               break; // mov r32, r32
+        case eVector   : Asm.Register({0x0F, 0x7E}, static_cast<UINT8>(Source.Value), Register, FALSE, 0x66); break; // movd r32, xmm
+        case eSlot     : Asm.Memory({0x8B}, Register, Slot(Source.Value));                               break;
+        case eConstant : Asm.MoveImmediate(Register, static_cast<UINT32>(Source.Value));                 break;
+        default        :                                                                                 break;
+        }
+      };
+
+    // Instruction with register and value operands emission function (rcx and xmm15 are used as scratch)
+    auto Operand = [&]( std::initializer_list<UINT8> Opcode, UINT8 Reg, const ssa_location &Source, BOOL IsVector, BOOL Wide = FALSE, UINT8 Prefix = 0 )
+      {
+        if (Source.Kind == eSlot)
+          Asm.Memory(Opcode, Reg, Slot(Source.Value), Wide, Prefix);
+        else
+          Asm.Register(Opcode, Reg, Get(Source, IsVector, IsVector ? SSA_VECTOR_SCRATCH : eRcx), Wide, Prefix);
+      };
+
+    // Instruction result register getting function (spilled results are computed in rax/xmm0)
+    auto Target = [&]( UINT32 Value ) -> UINT8
+      {
+        const ssa_location &Location = Locations[Value];
+
+        if (Location.Kind == (Values[Value].IsFloat ? eVector : eGeneral))
+          return static_cast<UINT8>(Location.Value);
+        return Values[Value].IsFloat ? eXmm0 : eRax;
+      };
+
+    // Instruction result (computed in target register) finishing function
+    auto Finish = [&]( UINT32 Value, UINT8 Register )
+      {
+        MoveTo(Locations[Value], ssa_location { Values[Value].IsFloat ? eVector : eGeneral, Register });
+      };
+
+    // Comparison result (by condition flags) to register storing function
+    auto SetCondition = [&]( x86_condition Condition, UINT8 Register )
+      {
+        Asm.Register({0x0F, static_cast<UINT8>(0x90 | static_cast<UINT8>(Condition))}, 0, Register, FALSE, 0, TRUE); // setcc r8
+        Asm.Register({0x0F, 0xB6}, Register, Register, FALSE, 0, TRUE);                                           // movzx r32, r8
+      };
+
+    // Integer comparison with zero or value emission function (flags are set), returns condition of comparison truth
+    auto Compare = [&]( const ssa_value &Value ) -> x86_condition
+      {
+        constexpr x86_condition Conditions[] {
+          x86_condition::eEqual, x86_condition::eNotEqual, x86_condition::eLess, x86_condition::eBelow, x86_condition::eGreater,
+          x86_condition::eAbove, x86_condition::eLessEqual, x86_condition::eBelowEqual, x86_condition::eGreaterEqual, x86_condition::eAboveEqual,
+        };
+        const bin::instruction Instruction = Value.Instruction;
+
+        if (Instruction == bin::instruction::eI32Eqz || Instruction == bin::instruction::eI64Eqz || Instruction == bin::instruction::eRefIsNull)
+        {
+          const UINT8 Register = Get(Location(Value.Operands[0]), FALSE, eR11);
+
+          Asm.Register({0x85}, Register, Register, Instruction == bin::instruction::eI64Eqz); // test r, r
+          return x86_condition::eEqual;
+        }
+
+        // Floating point 'less' comparisons are 'greater' ones with swapped operands, so unordered operands compare false
+        if (Instruction >= bin::instruction::eF32Eq)
+        {
+          const BOOL IsDouble = Instruction >= bin::instruction::eF64Eq;
+          const UINT32 Kind = static_cast<UINT32>(Instruction) - static_cast<UINT32>(IsDouble ? bin::instruction::eF64Eq : bin::instruction::eF32Eq);
+          const BOOL IsSwapped = Kind == 2 || Kind == 4;
+          const UINT8 Register = Get(Location(Value.Operands[IsSwapped ? 1 : 0]), TRUE, eXmm0);
+
+          Operand({0x0F, 0x2E}, Register, Location(Value.Operands[IsSwapped ? 0 : 1]), TRUE, FALSE, IsDouble ? 0x66 : 0); // ucomiss/ucomisd
+          return Kind < 4 ? x86_condition::eAbove : x86_condition::eAboveEqual;
+        }
+
+        const BOOL Wide = Instruction >= bin::instruction::eI64Eq;
+        const UINT32 Kind = static_cast<UINT32>(Instruction) - static_cast<UINT32>(Wide ? bin::instruction::eI64Eq : bin::instruction::eI32Eq);
+        const UINT8 Register = Get(Location(Value.Operands[0]), FALSE, eR11);
+        const ssa_location Rhs = Location(Value.Operands[1]);
+        const INT32 Immediate = static_cast<INT32>(Rhs.Value);
+
+        if (Rhs.Kind == eConstant && (!Wide || static_cast<INT64>(Rhs.Value) == Immediate))
+        {
+          if (Immediate >= -128 && Immediate <= 127)
+          {
+            Asm.Register({0x83}, 7, Register, Wide);                               // cmp r, simm8
+            Asm.Byte(static_cast<UINT8>(Immediate));
+          }
+          else
+          {
+            Asm.Register({0x81}, 7, Register, Wide);                               // cmp r, imm32
+            Asm.Dword(static_cast<UINT32>(Immediate));
+          }
+        }
+        else
+          Operand({0x3B}, Register, Rhs, FALSE, Wide);
+        return Conditions[Kind];
+      };
+
+    // 32 bit integer condition testing function (ZF is set if condition is zero)
+    auto Test = [&]( const ssa_location &Condition )
+      {
+        if (Condition.Kind == eSlot)
+        {
+          Asm.Memory({0x83}, 7, Slot(Condition.Value));                            // cmp dword [slot], 0
+          Asm.Byte(0);
+          return;
+        }
+
+        const UINT8 Register = Get(Condition, FALSE, eRcx);
+
+        Asm.Register({0x85}, Register, Register);                                  // test r32, r32
+      };
+
+    auto Epilogue = [&]( VOID )
+      {
+        Asm.Register({0x81}, 0, eRsp, TRUE);                                       // add rsp, frame size
+        Asm.Dword(FrameSize);
+        Asm.Bytes({0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5D, 0x5B, 0xC3}); // pop r15, r14, r13, r12, rbp, rbx; ret
+      };
+
+    // Linear memory registers reloading function (memory may be resized by callee)
+    auto ReloadHeap = [&]( VOID )
+      {
+        Asm.Memory({0x8B}, eR13, x86_memory { .Base = eR12, .Displacement = static_cast<INT32>(offsetof(native_context, HeapData)) }, TRUE);
+        Asm.Memory({0x8B}, eR14, x86_memory { .Base = eR12, .Displacement = static_cast<INT32>(offsetof(native_context, HeapSize)) }, TRUE);
+      };
+
+    // Linear memory operand getting function (address is moved to rcx, r11 is used as scratch), bounds of guarded memory are checked by guard pages
+    auto HeapOperand = [&]( const ssa_location &Address, UINT64 Offset, UINT32 Size )
+      {
+        x86_memory Heap { .Base = eR13, .Index = eRcx };
+
+        Load32(eRcx, Address);
+        if (Offset + Size <= 0x7FFFFFFF)
+          Heap.Displacement = static_cast<INT32>(Offset);
+        else
+        {
+          Asm.MoveImmediate(eR11, static_cast<UINT32>(Offset));
+          Asm.Register({0x03}, eRcx, eR11, TRUE);                                  // add rcx, r11
+          Offset = 0;
+        }
+        if (!linear_memory::IsGuarded(MemoryReservation))
+        {
+          Asm.Memory({0x8D}, eR11, x86_memory { .Base = eRcx, .Displacement = static_cast<INT32>(Offset + Size) }, TRUE); // lea r11, [rcx + offset + size]
+          Asm.Register({0x3B}, eR11, eR14, TRUE);                                  // cmp r11, r14
+          JumpToTrap(x86_condition::eAbove);
+        }
+        return Heap;
+      };
+
+    // Numeric helper call function (operands are passed in argument slots)
+    auto CallHelper = [&]( UINT32 Value )
+      {
+        const ssa_value &Data = Values[Value];
+
+        for (SIZE_T i = 0; i < Data.Operands.size(); i++)
+          Store(Stack(i), Location(Data.Operands[i]));
+        Asm.Memory({0x8D}, eRdi, Stack(0), TRUE);                                  // lea rdi, [rsp]
+        Asm.Call(NativeHelpers[static_cast<UINT8>(Data.Instruction)]);
+        Asm.Bytes({0x84, 0xC0});                                                   // test al, al
+        JumpToTrap(x86_condition::eEqual);
+        Fetch(Locations[Value], Stack(0));
+      };
+
+    // Phi moves of control flow edge getting function (destination and source pairs)
+    auto GetEdgeMoves = [&]( UINT32 Block, UINT32 Successor )
+      {
+        std::vector<std::pair<ssa_location, ssa_location>> Moves;
+        const SIZE_T Index = GetEdgeIndex(Block, Successor);
+
+        for (UINT32 Phi : Blocks[Successor].Phis)
+        {
+          const ssa_location Destination = Locations[Phi];
+          const ssa_location Source = Location(Values[Phi].Operands[Index]);
+
+          if (Destination.Kind != eNone && Destination != Source)
+            Moves.push_back({Destination, Source});
+        }
+        return Moves;
+      };
+
+    // Parallel moves emission function (moves, that don't overwrite sources of others, go first, cycles are broken through r11)
+    auto ParallelMove = [&]( std::vector<std::pair<ssa_location, ssa_location>> Moves )
+      {
+        constexpr ssa_location Temporary { eGeneral, eR11 };
+
+        while (!Moves.empty())
+        {
+          auto Move = std::ranges::find_if(Moves, [&]( const auto &Move )
+            {
+              return std::ranges::none_of(Moves, [&]( const auto &Other ) { return Other.second == Move.first; });
+            });
+
+          if (Move != Moves.end())
+          {
+            MoveTo(Move->first, Move->second);
+            Moves.erase(Move);
+            continue;
+          }
+
+          const ssa_location Saved = Moves[0].first;
+
+          MoveTo(Temporary, Saved);
+          for (auto &Other : Moves)
+            if (Other.second == Saved)
+              Other.second = Temporary;
+        }
+      };
+
+    // Integer operation emission function (opcode extension selects immediate form of operation, 'imul' one is marked by ~0)
+    auto Integer = [&]( UINT32 Value, std::initializer_list<UINT8> Opcode, UINT8 Extension, BOOL Wide, BOOL IsCommutative )
+      {
+        ssa_location Lhs = Location(Values[Value].Operands[0]);
+        ssa_location Rhs = Location(Values[Value].Operands[1]);
+        const UINT8 Result = Target(Value);
+        const ssa_location ResultLocation { eGeneral, Result };
+
+        if (IsCommutative && Lhs.Kind == eConstant && Rhs.Kind != eConstant)
+          std::swap(Lhs, Rhs);
+        if (Rhs == ResultLocation && Lhs != ResultLocation)
+        {
+          if (IsCommutative)
+            std::swap(Lhs, Rhs);
+          else
+          {
+            MoveTo(ssa_location { eGeneral, eRcx }, Rhs);
+            Rhs = ssa_location { eGeneral, eRcx };
+          }
+        }
+        MoveTo(ResultLocation, Lhs);
+
+        const INT32 Immediate = static_cast<INT32>(Rhs.Value);
+
+        if (Rhs.Kind == eConstant && (!Wide || static_cast<INT64>(Rhs.Value) == Immediate))
+        {
+          if (Extension != 0xFF && Immediate >= -128 && Immediate <= 127)
+          {
+            Asm.Register({0x83}, Extension, Result, Wide);                         // op result, simm8
+            Asm.Byte(static_cast<UINT8>(Immediate));
+          }
+          else
+          {
+            if (Extension == 0xFF)
+              Asm.Register({0x69}, Result, Result, Wide);                          // imul result, result, imm32
+            else
+              Asm.Register({0x81}, Extension, Result, Wide);                       // op result, imm32
+            Asm.Dword(static_cast<UINT32>(Immediate));
+          }
+        }
+        else
+          Operand(Opcode, Result, Rhs, FALSE, Wide);
+        Finish(Value, Result);
+      };
+
+    // Integer shift or rotation (by 'C1'/'D3' opcode extension) emission function, count is taken by module of bit count by processor
+    auto Shift = [&]( UINT32 Value, UINT8 Extension, BOOL Wide )
+      {
+        const ssa_location Count = Location(Values[Value].Operands[1]);
+        const UINT8 Result = Target(Value);
+
+        if (Count.Kind != eConstant)
+          Load32(eRcx, Count);
+        MoveTo(ssa_location { eGeneral, Result }, Location(Values[Value].Operands[0]));
+        if (Count.Kind == eConstant)
+        {
+          Asm.Register({0xC1}, Extension, Result, Wide);
+          Asm.Byte(static_cast<UINT8>(Count.Value & (Wide ? 63 : 31)));
+        }
+        else
+          Asm.Register({0xD3}, Extension, Result, Wide);
+        Finish(Value, Result);
+      };
+
+    // Integer division/remainder emission function (rax and rdx are used by instruction, zero division and overflow trap)
+    auto Divide = [&]( UINT32 Value, BOOL Wide, BOOL IsSigned, BOOL IsRemainder )
+      {
+        const ssa_location Rhs = Location(Values[Value].Operands[1]);
+        const UINT64 Divisor = Wide ? Rhs.Value : static_cast<UINT32>(Rhs.Value);
+        const BOOL IsConstant = Rhs.Kind == eConstant;
+
+        if (IsConstant && Divisor == 0)
+        {
+          JumpToTrap(x86_condition::eAlways);
+          return;
+        }
+
+        const UINT8 Register = Get(Rhs, FALSE, eRcx);
+        SIZE_T Skip = SIZE_MAX;
+
+        MoveTo(ssa_location { eGeneral, eRax }, Location(Values[Value].Operands[0]));
+        if (!IsConstant)
+        {
+          Asm.Register({0x85}, Register, Register, Wide);                          // test divisor, divisor
+          JumpToTrap(x86_condition::eEqual);
+        }
+
+        // Signed division by -1 overflows for minimal dividend, remainder by -1 is 0
+        if (IsSigned && (!IsConstant || Divisor == (Wide ? ~0ULL : 0xFFFFFFFFULL)))
+        {
+          Asm.Register({0x83}, 7, Register, Wide);                                 // cmp divisor, -1
+          Asm.Byte(0xFF);
+
+          const SIZE_T NotMinusOne = Asm.Jump(x86_condition::eNotEqual);
+
+          if (IsRemainder)
+          {
+            Asm.Bytes({0x31, 0xD2});                                               // xor edx, edx
+            Skip = Asm.Jump(x86_condition::eAlways);
+          }
+          else
+          {
+            if (Wide)
+            {
+              Asm.MoveImmediate64(eR11, 0x8000000000000000ULL);
+              Asm.Register({0x3B}, eRax, eR11, TRUE);                              // cmp rax, r11
+            }
+            else
+            {
+              Asm.Register({0x81}, 7, eRax);                                       // cmp eax, INT32_MIN
+              Asm.Dword(0x80000000);
+            }
+            JumpToTrap(x86_condition::eEqual);
+          }
+          Asm.Patch(NotMinusOne, Asm.Code.size());
+        }
+
+        if (!IsSigned)
+          Asm.Bytes({0x31, 0xD2});                                                 // xor edx, edx
+        else if (Wide)
+          Asm.Bytes({0x48, 0x99});                                                 // cqo
+        else
+          Asm.Byte(0x99);                                                          // cdq
+        Asm.Register({0xF7}, IsSigned ? 7 : 6, Register, Wide);                    // idiv/div divisor
+        if (Skip != SIZE_MAX)
+          Asm.Patch(Skip, Asm.Code.size());
+        MoveTo(Locations[Value], ssa_location { eGeneral, IsRemainder ? eRdx : eRax });
+      };
+
+    // Floating point operation (prefix selects precision) emission function
+    auto Float = [&]( UINT32 Value, UINT8 Opcode, UINT8 Prefix, BOOL IsCommutative )
+      {
+        ssa_location Lhs = Location(Values[Value].Operands[0]);
+        ssa_location Rhs = Location(Values[Value].Operands[1]);
+        const UINT8 Result = Target(Value);
+        const ssa_location ResultLocation { eVector, Result };
+
+        if (Rhs == ResultLocation && Lhs != ResultLocation)
+        {
+          if (IsCommutative)
+            std::swap(Lhs, Rhs);
+          else
+          {
+            MoveTo(ssa_location { eVector, SSA_VECTOR_SCRATCH }, Rhs);
+            Rhs = ssa_location { eVector, SSA_VECTOR_SCRATCH };
+          }
+        }
+        MoveTo(ResultLocation, Lhs);
+        Operand({0x0F, Opcode}, Result, Rhs, TRUE, FALSE, Prefix);
+        Finish(Value, Result);
+      };
+
+    // Floating point sign bit modification (by mask and 'andps'/'xorps' opcode) emission function
+    auto SignBit = [&]( UINT32 Value, UINT8 Opcode, UINT64 Mask )
+      {
+        const UINT8 Result = Target(Value);
+
+        MoveTo(ssa_location { eVector, Result }, Location(Values[Value].Operands[0]));
+        LoadPooled(SSA_VECTOR_SCRATCH, Mask);
+        Asm.Register({0x0F, Opcode}, Result, SSA_VECTOR_SCRATCH);
+        Finish(Value, Result);
+      };
+
+    // Floating point rounding ('roundss'/'roundsd' opcode and rounding mode) emission function
+    auto Round = [&]( UINT32 Value, UINT8 Opcode, UINT8 Mode )
+      {
+        const UINT8 Source = Get(Location(Values[Value].Operands[0]), TRUE, SSA_VECTOR_SCRATCH);
+        const UINT8 Result = Target(Value);
+
+        Asm.Register({0x0F, 0x3A, Opcode}, Result, Source, FALSE, 0x66);
+        Asm.Byte(Mode);
+        Finish(Value, Result);
+      };
+
+    // Integer to floating point conversion emission function (result register is cleared to break dependency on its previous value)
+    auto Convert = [&]( UINT32 Value, UINT8 Prefix, BOOL Wide, BOOL IsUnsigned )
+      {
+        const ssa_location Source = Location(Values[Value].Operands[0]);
+        UINT8 Register = eRcx;
+
+        // Unsigned 32 bit integer is converted as zero extended 64 bit one
+        if (IsUnsigned)
+          Load32(eRcx, Source);
+        else
+          Register = Get(Source, FALSE, eRcx);
+
+        const UINT8 Result = Target(Value);
+
+        Asm.Register({0x0F, 0x57}, Result, Result);                                // xorps result, result
+        Asm.Register({0x0F, 0x2A}, Result, Register, Wide || IsUnsigned, Prefix);  // cvtsi2ss/cvtsi2sd result, r
+        Finish(Value, Result);
+      };
+
+    // Integer sign extension (by 'movsx'/'movsxd' opcode) emission function
+    auto Extend = [&]( UINT32 Value, std::initializer_list<UINT8> Opcode, BOOL Wide )
+      {
+        const UINT8 Result = Target(Value);
+
+        MoveTo(ssa_location { eGeneral, Result }, Location(Values[Value].Operands[0]));
+        Asm.Register(Opcode, Result, Result, Wide, 0, TRUE);
+        Finish(Value, Result);
+      };
+
+    // Bit scan based leading/trailing zero count emission function (zero operand is handled by conditional move)
+    auto CountZeros = [&]( UINT32 Value, BOOL IsLeading, BOOL Wide )
+      {
+        const UINT8 Result = Target(Value);
+
+        MoveTo(ssa_location { eGeneral, Result }, Location(Values[Value].Operands[0]));
+        Asm.Register({0x0F, static_cast<UINT8>(IsLeading ? 0xBD : 0xBC)}, Result, Result, Wide); // bsr/bsf result, result
+        Asm.MoveImmediate(eR11, IsLeading ? (Wide ? 127 : 63) : (Wide ? 64 : 32));
+        Asm.Register({0x0F, 0x44}, Result, eR11, Wide);                            // cmovz result, r11
+        if (IsLeading)
+        {
+          Asm.Register({0x83}, 6, Result, Wide);                                   // xor result, 31/63
+          Asm.Byte(Wide ? 63 : 31);
+        }
+        Finish(Value, Result);
+      };
+
+    // Prologue: callee-saved registers, stack frame, context and arguments
+    Asm.Bytes({0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57});       // push rbx, rbp, r12, r13, r14, r15
+    Asm.Register({0x81}, 5, eRsp, TRUE);                                           // sub rsp, frame size
+    Asm.Dword(FrameSize);
+    Asm.Register({0x89}, eRdi, eR12, TRUE);                                        // mov r12, rdi
+    Asm.Register({0x89}, eRsi, eRax, TRUE);                                        // mov rax, rsi
+    ReloadHeap();
+    for (UINT32 Value = 0; Value < Values.size(); Value++)
+      if (Values[Value].Kind == ssa_kind::eParameter)
+        Fetch(Locations[Value], x86_memory { .Base = eRax, .Displacement = static_cast<INT32>(Values[Value].Immediate * sizeof(UINT64)) });
+
+    for (SIZE_T Index = 0; Index < Ssa.Order.size(); Index++)
+    {
+      const UINT32 Block = Ssa.Order[Index];
+      const UINT32 Next = Index + 1 < Ssa.Order.size() ? Ssa.Order[Index + 1] : SSA_NONE;
+      const ssa_block &Data = Blocks[Block];
+
+      Offsets[Block] = Asm.Code.size();
+      for (UINT32 Value : Data.Code)
+      {
+        const ssa_value &Instruction = Values[Value];
+
+        if (Instruction.IsFused)
+          continue;
+        if (IsCallInstruction(Instruction.Instruction) && Instruction.Instruction != bin::instruction::eCall
+            && Instruction.Instruction != bin::instruction::eMemoryGrow && Instruction.Instruction != bin::instruction::eSystem)
+        {
+          CallHelper(Value);
+          continue;
+        }
+
+        switch (Instruction.Instruction)
+        {
+        // Optimized callees are called directly by 'OptimizedCall', arguments and result are passed through argument slots
+        case bin::instruction::eCall:
+          for (SIZE_T i = 0; i < Instruction.Operands.size(); i++)
+            Store(Stack(i), Location(Instruction.Operands[i]));
+          Asm.Register({0x89}, eR12, eRdi, TRUE);                                  // mov rdi, r12
+          Asm.Memory({0x8D}, eRsi, Stack(0), TRUE);                                // lea rsi, [rsp]
+          Asm.MoveImmediate(eRdx, static_cast<UINT32>(Instruction.Immediate));
+          Asm.Call(&instance_impl::OptimizedCall);
+          Asm.Bytes({0x84, 0xC0});                                                 // test al, al
+          JumpToTrap(x86_condition::eEqual);
+          ReloadHeap();
+          if (Instruction.HasResult)
+            Fetch(Locations[Value], Stack(0));
+          break;
+
+        case bin::instruction::eMemorySize:
+          {
+            const UINT8 Result = Target(Value);
+
+            Asm.Register({0x89}, eR14, Result, TRUE);                              // mov result, r14
+            Asm.Register({0xC1}, 5, Result, TRUE);                                 // shr result, 16
+            Asm.Byte(16);
+            Finish(Value, Result);
+            break;
+          }
+
+        case bin::instruction::eMemoryGrow:
+          Store(Stack(0), Location(Instruction.Operands[0]));
+          Asm.Register({0x89}, eR12, eRdi, TRUE);                                  // mov rdi, r12
+          Asm.Memory({0x8D}, eRsi, Stack(0), TRUE);                                // lea rsi, [rsp]
+          Asm.Call(&instance_impl::NativeGrowMemory);
+          ReloadHeap();
+          Fetch(Locations[Value], Stack(0));
+          break;
+
+        // Bulk memory instructions are executed by instance, operands are passed through argument slots
+        case bin::instruction::eSystem:
+          for (SIZE_T i = 0; i < Instruction.Operands.size(); i++)
+            Store(Stack(i), Location(Instruction.Operands[i]));
+          Asm.Register({0x89}, eR12, eRdi, TRUE);                                  // mov rdi, r12
+          Asm.Memory({0x8D}, eRsi, Stack(0), TRUE);                                // lea rsi, [rsp]
+          Asm.MoveImmediate(eRdx, static_cast<UINT32>(Instruction.Immediate & 0xFF));
+          Asm.MoveImmediate(eRcx, static_cast<UINT32>(Instruction.Immediate >> 8));
+          Asm.Call(&instance_impl::NativeBulkMemory);
+          Asm.Bytes({0x84, 0xC0});                                                 // test al, al
+          JumpToTrap(x86_condition::eEqual);
+          break;
+
+        // Values are selected in general purpose register by conditional move (flags aren't changed by moves)
+        case bin::instruction::eSelect:
+          {
+            MoveTo(ssa_location { eGeneral, eR11 }, Location(Instruction.Operands[1]));
+            MoveTo(ssa_location { eGeneral, eRax }, Location(Instruction.Operands[0]));
+            Test(Location(Instruction.Operands[2]));
+            Asm.Register({0x0F, 0x44}, eRax, eR11, TRUE);                          // cmove rax, r11
+            MoveTo(Locations[Value], ssa_location { eGeneral, eRax });
+            break;
+          }
+
+        case bin::instruction::eI32Eqz  :
+        case bin::instruction::eI64Eqz  :
+        case bin::instruction::eRefIsNull:
+        case bin::instruction::eI32Eq   : case bin::instruction::eI32Ne   : case bin::instruction::eI32LtS  : case bin::instruction::eI32LtU  :
+        case bin::instruction::eI32GtS  : case bin::instruction::eI32GtU  : case bin::instruction::eI32LeS  : case bin::instruction::eI32LeU  :
+        case bin::instruction::eI32GeS  : case bin::instruction::eI32GeU  :
+        case bin::instruction::eI64Eq   : case bin::instruction::eI64Ne   : case bin::instruction::eI64LtS  : case bin::instruction::eI64LtU  :
+        case bin::instruction::eI64GtS  : case bin::instruction::eI64GtU  : case bin::instruction::eI64LeS  : case bin::instruction::eI64LeU  :
+        case bin::instruction::eI64GeS  : case bin::instruction::eI64GeU  :
+        case bin::instruction::eF32Lt   : case bin::instruction::eF32Gt   : case bin::instruction::eF32Le   : case bin::instruction::eF32Ge   :
+        case bin::instruction::eF64Lt   : case bin::instruction::eF64Gt   : case bin::instruction::eF64Le   : case bin::instruction::eF64Ge   :
+          {
+            const x86_condition Condition = Compare(Instruction);
+            const UINT8 Result = Target(Value);
+
+            SetCondition(Condition, Result);
+            Finish(Value, Result);
+            break;
+          }
+
+        // Parity flag is set for unordered operands
+        case bin::instruction::eF32Eq   :
+        case bin::instruction::eF32Ne   :
+        case bin::instruction::eF64Eq   :
+        case bin::instruction::eF64Ne   :
+          {
+            const BOOL IsEqual = Instruction.Instruction == bin::instruction::eF32Eq || Instruction.Instruction == bin::instruction::eF64Eq;
+            const BOOL IsDouble = Instruction.Instruction >= bin::instruction::eF64Eq;
+            const UINT8 Register = Get(Location(Instruction.Operands[0]), TRUE, eXmm0);
+
+            Operand({0x0F, 0x2E}, Register, Location(Instruction.Operands[1]), TRUE, FALSE, IsDouble ? 0x66 : 0); // ucomiss/ucomisd
+
+            const UINT8 Result = Target(Value);
+
+            Asm.Register({0x0F, static_cast<UINT8>(IsEqual ? 0x94 : 0x95)}, 0, Result, FALSE, 0, TRUE);          // sete/setne result8
+            Asm.Register({0x0F, static_cast<UINT8>(IsEqual ? 0x9B : 0x9A)}, 0, eRcx);                            // setnp/setp cl
+            Asm.Register({static_cast<UINT8>(IsEqual ? 0x20 : 0x08)}, eRcx, Result, FALSE, 0, TRUE);           // and/or result8, cl
+            Asm.Register({0x0F, 0xB6}, Result, Result, FALSE, 0, TRUE);                                        // movzx r32, r8
+            Finish(Value, Result);
+            break;
+          }
+
+        case bin::instruction::eI32Add  : Integer(Value, {0x03}, 0, FALSE, TRUE);          break;
+        case bin::instruction::eI32Sub  : Integer(Value, {0x2B}, 5, FALSE, FALSE);         break;
+        case bin::instruction::eI32Mul  : Integer(Value, {0x0F, 0xAF}, 0xFF, FALSE, TRUE); break;
+        case bin::instruction::eI32And  : Integer(Value, {0x23}, 4, FALSE, TRUE);          break;
+        case bin::instruction::eI32Or   : Integer(Value, {0x0B}, 1, FALSE, TRUE);          break;
+        case bin::instruction::eI32Xor  : Integer(Value, {0x33}, 6, FALSE, TRUE);          break;
+        case bin::instruction::eI64Add  : Integer(Value, {0x03}, 0, TRUE, TRUE);           break;
+        case bin::instruction::eI64Sub  : Integer(Value, {0x2B}, 5, TRUE, FALSE);          break;
+        case bin::instruction::eI64Mul  : Integer(Value, {0x0F, 0xAF}, 0xFF, TRUE, TRUE);  break;
+        case bin::instruction::eI64And  : Integer(Value, {0x23}, 4, TRUE, TRUE);           break;
+        case bin::instruction::eI64Or   : Integer(Value, {0x0B}, 1, TRUE, TRUE);           break;
+        case bin::instruction::eI64Xor  : Integer(Value, {0x33}, 6, TRUE, TRUE);           break;
+
+        case bin::instruction::eI32Shl  : Shift(Value, 4, FALSE); break;
+        case bin::instruction::eI32ShrS : Shift(Value, 7, FALSE); break;
+        case bin::instruction::eI32ShrU : Shift(Value, 5, FALSE); break;
+        case bin::instruction::eI32Rotl : Shift(Value, 0, FALSE); break;
+        case bin::instruction::eI32Rotr : Shift(Value, 1, FALSE); break;
+        case bin::instruction::eI64Shl  : Shift(Value, 4, TRUE);  break;
+        case bin::instruction::eI64ShrS : Shift(Value, 7, TRUE);  break;
+        case bin::instruction::eI64ShrU : Shift(Value, 5, TRUE);  break;
+        case bin::instruction::eI64Rotl : Shift(Value, 0, TRUE);  break;
+        case bin::instruction::eI64Rotr : Shift(Value, 1, TRUE);  break;
+
+        case bin::instruction::eI32DivS : Divide(Value, FALSE, TRUE, FALSE);  break;
+        case bin::instruction::eI32DivU : Divide(Value, FALSE, FALSE, FALSE); break;
+        case bin::instruction::eI32RemS : Divide(Value, FALSE, TRUE, TRUE);   break;
+        case bin::instruction::eI32RemU : Divide(Value, FALSE, FALSE, TRUE);  break;
+        case bin::instruction::eI64DivS : Divide(Value, TRUE, TRUE, FALSE);   break;
+        case bin::instruction::eI64DivU : Divide(Value, TRUE, FALSE, FALSE);  break;
+        case bin::instruction::eI64RemS : Divide(Value, TRUE, TRUE, TRUE);    break;
+        case bin::instruction::eI64RemU : Divide(Value, TRUE, FALSE, TRUE);   break;
+
+        case bin::instruction::eF32Add  : Float(Value, 0x58, 0xF3, TRUE);  break;
+        case bin::instruction::eF32Sub  : Float(Value, 0x5C, 0xF3, FALSE); break;
+        case bin::instruction::eF32Mul  : Float(Value, 0x59, 0xF3, TRUE);  break;
+        case bin::instruction::eF32Div  : Float(Value, 0x5E, 0xF3, FALSE); break;
+        case bin::instruction::eF64Add  : Float(Value, 0x58, 0xF2, TRUE);  break;
+        case bin::instruction::eF64Sub  : Float(Value, 0x5C, 0xF2, FALSE); break;
+        case bin::instruction::eF64Mul  : Float(Value, 0x59, 0xF2, TRUE);  break;
+        case bin::instruction::eF64Div  : Float(Value, 0x5E, 0xF2, FALSE); break;
+
+        case bin::instruction::eI32Clz  : CountZeros(Value, TRUE, FALSE);  break;
+        case bin::instruction::eI32Ctz  : CountZeros(Value, FALSE, FALSE); break;
+        case bin::instruction::eI64Clz  : CountZeros(Value, TRUE, TRUE);   break;
+        case bin::instruction::eI64Ctz  : CountZeros(Value, FALSE, TRUE);  break;
+
+        case bin::instruction::eI32Popcnt :
+        case bin::instruction::eI64Popcnt :
+          {
+            const UINT8 Result = Target(Value);
+
+            Operand({0x0F, 0xB8}, Result, Location(Instruction.Operands[0]), FALSE, Instruction.Instruction == bin::instruction::eI64Popcnt, 0xF3);
+            Finish(Value, Result);
+            break;
+          }
+
+        case bin::instruction::eF32Abs  : SignBit(Value, 0x54, 0x7FFFFFFFULL);          break; // andps
+        case bin::instruction::eF32Neg  : SignBit(Value, 0x57, 0x80000000ULL);          break; // xorps
+        case bin::instruction::eF64Abs  : SignBit(Value, 0x54, 0x7FFFFFFFFFFFFFFFULL);  break;
+        case bin::instruction::eF64Neg  : SignBit(Value, 0x57, 0x8000000000000000ULL);  break;
+
+        case bin::instruction::eF32Nearest : Round(Value, 0x0A, 0); break;
+        case bin::instruction::eF32Floor   : Round(Value, 0x0A, 1); break;
+        case bin::instruction::eF32Ceil    : Round(Value, 0x0A, 2); break;
+        case bin::instruction::eF32Trunc   : Round(Value, 0x0A, 3); break;
+        case bin::instruction::eF64Nearest : Round(Value, 0x0B, 0); break;
+        case bin::instruction::eF64Floor   : Round(Value, 0x0B, 1); break;
+        case bin::instruction::eF64Ceil    : Round(Value, 0x0B, 2); break;
+        case bin::instruction::eF64Trunc   : Round(Value, 0x0B, 3); break;
+
+        case bin::instruction::eF32Sqrt :
+        case bin::instruction::eF64Sqrt :
+        case bin::instruction::eF32DemoteF64 :
+        case bin::instruction::eF64PromoteF32 :
+          {
+            const UINT8 Result = Target(Value);
+            const BOOL IsSqrt = Instruction.Instruction == bin::instruction::eF32Sqrt || Instruction.Instruction == bin::instruction::eF64Sqrt;
+            const BOOL IsDoubleSource = Instruction.Instruction == bin::instruction::eF64Sqrt || Instruction.Instruction == bin::instruction::eF32DemoteF64;
+
+            Operand({0x0F, static_cast<UINT8>(IsSqrt ? 0x51 : 0x5A)}, Result, Location(Instruction.Operands[0]), TRUE, FALSE, IsDoubleSource ? 0xF2 : 0xF3);
+            Finish(Value, Result);
+            break;
+          }
+
+        case bin::instruction::eF32ConvertI32S : Convert(Value, 0xF3, FALSE, FALSE); break;
+        case bin::instruction::eF32ConvertI64S : Convert(Value, 0xF3, TRUE, FALSE);  break;
+        case bin::instruction::eF32ConvertI32U : Convert(Value, 0xF3, FALSE, TRUE);  break;
+        case bin::instruction::eF64ConvertI32S : Convert(Value, 0xF2, FALSE, FALSE); break;
+        case bin::instruction::eF64ConvertI64S : Convert(Value, 0xF2, TRUE, FALSE);  break;
+        case bin::instruction::eF64ConvertI32U : Convert(Value, 0xF2, FALSE, TRUE);  break;
+
+        case bin::instruction::eI64ExtendI32U :
+          {
+            const UINT8 Result = Target(Value);
+
+            Load32(Result, Location(Instruction.Operands[0]));
+            Finish(Value, Result);
+            break;
+          }
+
+        case bin::instruction::eI64ExtendI32S : Extend(Value, {0x63}, TRUE);        break;
+        case bin::instruction::eI32Extend8S   : Extend(Value, {0x0F, 0xBE}, FALSE); break;
+        case bin::instruction::eI32Extend16S  : Extend(Value, {0x0F, 0xBF}, FALSE); break;
+        case bin::instruction::eI64Extend8S   : Extend(Value, {0x0F, 0xBE}, TRUE);  break;
+        case bin::instruction::eI64Extend16S  : Extend(Value, {0x0F, 0xBF}, TRUE);  break;
+        case bin::instruction::eI64Extend32S  : Extend(Value, {0x63}, TRUE);        break;
+
+        WATAP_STANDARD_LOAD_INSTRUCTIONS(WATAP_STANDARD_SSA_NATIVE_CASE)
+          {
+            const x86_memory Heap = HeapOperand(Location(Instruction.Operands[0]), Instruction.Immediate, GetAccessSize(Instruction.Instruction));
+            const UINT8 Result = Target(Value);
+
+            switch (Instruction.Instruction)
+            {
+            case bin::instruction::eF32Load    : Asm.Memory({0x0F, 0x10}, Result, Heap, FALSE, 0xF3); break; // movss
+            case bin::instruction::eF64Load    : Asm.Memory({0x0F, 0x10}, Result, Heap, FALSE, 0xF2); break; // movsd
+            case bin::instruction::eI32Load    :
+            case bin::instruction::eI64Load32U : Asm.Memory({0x8B}, Result, Heap);                    break;
+            case bin::instruction::eI64Load    : Asm.Memory({0x8B}, Result, Heap, TRUE);              break;
+            case bin::instruction::eI32Load8S  : Asm.Memory({0x0F, 0xBE}, Result, Heap);              break;
+            case bin::instruction::eI32Load16S : Asm.Memory({0x0F, 0xBF}, Result, Heap);              break;
+            case bin::instruction::eI32Load8U  :
+            case bin::instruction::eI64Load8U  : Asm.Memory({0x0F, 0xB6}, Result, Heap);              break;
+            case bin::instruction::eI32Load16U :
+            case bin::instruction::eI64Load16U : Asm.Memory({0x0F, 0xB7}, Result, Heap);              break;
+            case bin::instruction::eI64Load8S  : Asm.Memory({0x0F, 0xBE}, Result, Heap, TRUE);        break;
+            case bin::instruction::eI64Load16S : Asm.Memory({0x0F, 0xBF}, Result, Heap, TRUE);        break;
+            case bin::instruction::eI64Load32S : Asm.Memory({0x63}, Result, Heap, TRUE);              break;
+            default:
+              return nullptr;
+            }
+            Finish(Value, Result);
+            break;
+          }
+
+        // Floating point values in SSE registers are stored directly, 32/64 bit constants are immediates, the rest are loaded to general purpose registers
+        WATAP_STANDARD_STORE_INSTRUCTIONS(WATAP_STANDARD_SSA_NATIVE_CASE)
+          {
+            const UINT32 Size = GetAccessSize(Instruction.Instruction);
+            const ssa_location Stored = Location(Instruction.Operands[1]);
+            const BOOL IsVector = Stored.Kind == eVector
+              && (Instruction.Instruction == bin::instruction::eF32Store || Instruction.Instruction == bin::instruction::eF64Store);
+            const BOOL IsImmediate = Stored.Kind == eConstant
+              && (Size == 4 || (Size == 8 && static_cast<INT64>(Stored.Value) == static_cast<INT32>(Stored.Value)));
+            const UINT8 Register = IsVector ? static_cast<UINT8>(Stored.Value) : IsImmediate ? eRax : Get(Stored, FALSE, eRax);
+            const x86_memory Heap = HeapOperand(Location(Instruction.Operands[0]), Instruction.Immediate, Size);
+
+            if (IsImmediate)
+            {
+              Asm.Memory({0xC7}, 0, Heap, Size == 8);                              // mov [heap], imm32
+              Asm.Dword(static_cast<UINT32>(Stored.Value));
+            }
+            else if (IsVector)
+              Asm.Memory({0x0F, 0x11}, Register, Heap, FALSE, Size == 8 ? 0xF2 : 0xF3); // movss/movsd [heap], xmm
+            else if (Size == 1)
+              Asm.Memory({0x88}, Register, Heap, FALSE, 0, TRUE);                  // mov [heap], r8
+            else if (Size == 2)
+              Asm.Memory({0x89}, Register, Heap, FALSE, 0x66);                     // mov [heap], r16
+            else
+              Asm.Memory({0x89}, Register, Heap, Size == 8);
+            break;
+          }
+
+        default:
+          // Instruction isn't supported by optimized code
+          return nullptr;
+        }
+      }
+
+      switch (Data.Terminator)
+      {
+      case ssa_terminator::eJump:
+        ParallelMove(GetEdgeMoves(Block, Data.Successors[0]));
+        if (Data.Successors[0] != Next)
+          JumpTo(x86_condition::eAlways, Data.Successors[0]);
+        break;
+
+      // Moves of edge without them are skipped by conditional jump, the other edge moves are placed after it
+      case ssa_terminator::eBranch:
+        {
+          const UINT32 Taken = Data.Successors[0];
+          const UINT32 NotTaken = Data.Successors[1];
+          const ssa_location Condition = Location(Data.Operand);
+
+          if (Taken == NotTaken || Condition.Kind == eConstant)
+          {
+            const UINT32 Successor = Taken == NotTaken || static_cast<UINT32>(Condition.Value) != 0 ? Taken : NotTaken;
+
+            ParallelMove(GetEdgeMoves(Block, Successor));
+            if (Successor != Next)
+              JumpTo(x86_condition::eAlways, Successor);
+            break;
+          }
+
+          x86_condition True = x86_condition::eNotEqual;
+
+          if (Values[Data.Operand].IsFused)
+            True = Compare(Values[Data.Operand]);
+          else
+            Test(Condition);
+
+          const x86_condition False = static_cast<x86_condition>(static_cast<UINT8>(True) ^ 1);
+          const auto TakenMoves = GetEdgeMoves(Block, Taken);
+          const auto NotTakenMoves = GetEdgeMoves(Block, NotTaken);
+
+          if (NotTakenMoves.empty() && (!TakenMoves.empty() || NotTaken != Next))
+          {
+            JumpTo(False, NotTaken);
+            ParallelMove(TakenMoves);
+            if (Taken != Next)
+              JumpTo(x86_condition::eAlways, Taken);
+          }
+          else if (TakenMoves.empty())
+          {
+            JumpTo(True, Taken);
+            ParallelMove(NotTakenMoves);
+            if (NotTaken != Next)
+              JumpTo(x86_condition::eAlways, NotTaken);
+          }
+          else
+          {
+            const SIZE_T Stub = Asm.Jump(True);
+
+            ParallelMove(NotTakenMoves);
+            JumpTo(x86_condition::eAlways, NotTaken);
+            Asm.Patch(Stub, Asm.Code.size());
+            ParallelMove(TakenMoves);
+            JumpTo(x86_condition::eAlways, Taken);
+          }
+          break;
+        }
+
+      // Jump table of 32 bit offsets (relative to table) of per-edge move stubs, out of range index selects default successor
+      case ssa_terminator::eTable:
+        {
+          const UINT32 LabelCount = static_cast<UINT32>(Data.Successors.size() - 1);
+
+          Load32(eRcx, Location(Data.Operand));
+          Asm.MoveImmediate(eR11, LabelCount);
+          Asm.Register({0x3B}, eRcx, eR11);                                        // cmp ecx, r11d
+          Asm.Register({0x0F, 0x47}, eRcx, eR11);                                  // cmova ecx, r11d
+          Asm.Bytes({0x4C, 0x8D, 0x1D});                                           // lea r11, [rip + table]
+          const SIZE_T TableDisplacement = Asm.Code.size();
+          Asm.Dword(0);
+          Asm.Memory({0x63}, eRcx, x86_memory { .Base = eR11, .Index = eRcx, .Scale = 2 }, TRUE); // movsxd rcx, [r11 + rcx * 4]
+          Asm.Register({0x03}, eRcx, eR11, TRUE);                                  // add rcx, r11
+          Asm.Register({0xFF}, 4, eRcx);                                           // jmp rcx
+
+          const SIZE_T Table = Asm.Code.size();
+          Asm.Patch(TableDisplacement, Table);
+          Asm.Code.resize(Table + (LabelCount + 1) * sizeof(UINT32));
+          for (UINT32 i = 0; i <= LabelCount; i++)
+          {
+            Asm.SetDword(Table + i * sizeof(UINT32), static_cast<UINT32>(Asm.Code.size() - Table));
+            ParallelMove(GetEdgeMoves(Block, Data.Successors[i]));
+            JumpTo(x86_condition::eAlways, Data.Successors[i]);
+          }
+          break;
+        }
+
+      case ssa_terminator::eReturn:
+        if (Data.Operand != SSA_NONE)
+          Store(x86_memory { .Base = eR12, .Displacement = static_cast<INT32>(offsetof(native_context, Result)) }, Location(Data.Operand));
+        Asm.MoveImmediate(eRax, 1);                                                // mov eax, TRUE
+        Epilogue();
+        break;
+
+      case ssa_terminator::eTrap:
+        JumpToTrap(x86_condition::eAlways);
+        break;
+      }
+    }
+
+    // Trap exit
+    const SIZE_T Trap = Asm.Code.size();
+
+    Asm.Bytes({0x31, 0xC0});                                                       // xor eax, eax
+    Epilogue();
+
+    // Constant pool (8 byte aligned)
+    Asm.Code.resize((Asm.Code.size() + 7) & ~SIZE_T(7), 0xCC);
+    const SIZE_T PoolStart = Asm.Code.size();
+    for (UINT64 Bits : Pool)
+      Asm.Qword(Bits);
+
+    for (const auto &[Position, Block] : BlockFixups)
+    {
+      if (Offsets[Block] == SIZE_MAX)
+        return nullptr;
+      Asm.Patch(Position, Offsets[Block]);
+    }
+    for (SIZE_T Position : TrapFixups)
+      Asm.Patch(Position, Trap);
+    for (const auto &[Position, Entry] : PoolFixups)
+      Asm.Patch(Position, PoolStart + Entry * sizeof(UINT64));
+
+    return PublishCode(Asm.Code, Trap);
+#else // defined(WATAP_STANDARD_NATIVE_CODE)
+    return nullptr;
+#endif // defined(WATAP_STANDARD_NATIVE_CODE)
+  } /* End of 'CompileOptimized' function */
+
+  /* Optimized function (on call stack top) execution function.
+   * ARGUMENTS:
+   *   - instance to execute code of:
+   *       instance_impl *Instance;
+   *   - function on call stack top:
+   *       const compiled_function_data &Function;
+   *   - optimized code entry (function or on-stack replacement one):
+   *       native_entry Entry;
+   * RETURNS:
+   *   (BOOL) TRUE if execution finished without trap, FALSE otherwise;
+   */
+  BOOL instance_impl::ExecuteOptimized( instance_impl *Instance, const compiled_function_data &Function, native_entry Entry )
+  {
+    const call Call = Instance->CallStack.Top();
+    native_context Context { Instance, Instance->Heap.Data(), Instance->Heap.Size(), 0 };
+
+    // Optimized code reads arguments (or all locals, if it's entered at loop header) from frame in prologue only
+    if (!Entry(&Context, Instance->GetFrame(Call, Function)))
+    {
+      Instance->Trap();
+      return FALSE;
+    }
+
+    Instance->PopCall(Function, &Context.Result);
+    return TRUE;
+  } /* End of 'ExecuteOptimized' function */
+
+  /* Function calling from optimized code function.
+   * ARGUMENTS:
+   *   - native code execution context:
+   *       native_context *Context;
+   *   - argument slots (result is stored to the first one):
+   *       UINT64 *Arguments;
+   *   - index of function to call:
+   *       UINT32 FunctionIndex;
+   * RETURNS:
+   *   (BOOL) TRUE if callee finished without trap, FALSE otherwise;
+   */
+  BOOL instance_impl::OptimizedCall( native_context *Context, UINT64 *Arguments, UINT32 FunctionIndex )
+  {
+    instance_impl *Instance = Context->Instance;
+    const compiled_function_data *Callee = Instance->Source.GetFunction(FunctionIndex);
+
+    if (Callee == nullptr)
+      return FALSE;
+
+    // Host callee reads arguments from and stores result to argument slots, no instance call frame is pushed
+    if (IsHostFunction(*Callee))
+    {
+      const host_function &Host = Instance->FunctionImports[Callee->ImportIndex];
+
+      Instance->CallHost(Host, Arguments);
+      return TRUE;
+    }
+
+    // Calls of optimized code are nested on host stack, so their depth is limited by call stack one even if no call frame is pushed
+    if (Instance->CallStack.Size() + Instance->OptimizedCallDepth >= Instance->CallStack.Capacity())
+      return FALSE;
+
+    // Optimized callee takes argument slots as its frame, no instance call frame is pushed
+    if (Callee->OptimizedEntry != nullptr)
+    {
+      Instance->OptimizedCallDepth++;
+      const BOOL IsFinished = Callee->OptimizedEntry(Context, Arguments);
+      Instance->OptimizedCallDepth--;
+
+      if (!IsFinished)
+        return FALSE;
+      Arguments[0] = Context->Result;
+      return TRUE;
+    }
+
+    // The rest of callees are executed by engine of their bytecode format, arguments and result are passed by evaluation stack
+    for (UINT32 i = 0; i < Callee->ArgumentCount; i++)
+      Instance->PushValue(Arguments + i, Callee->LocalSizes[i]);
+    if (Instance->PushCall(FunctionIndex) == nullptr)
+      return FALSE;
+
+    const BOOL IsFinished = (Instance->Dispatch == dispatch_type::eThreaded && !Callee->Handlers.empty())
+      ? ExecuteTop<dispatch_type::eThreaded>(Instance, *Callee)
+      : ExecuteTop<dispatch_type::eSwitch>(Instance, *Callee);
+
+    if (!IsFinished)
+      return FALSE;
+
+    Instance->PopValue(Arguments, Callee->ReturnSize);
+    Context->HeapData = Instance->Heap.Data();
+    Context->HeapSize = Instance->Heap.Size();
+    return TRUE;
+  } /* End of 'OptimizedCall' function */
+} /* end of 'watap::impl::standard' namespace */
+
+/* END OF 'watap_impl_standard_ssa_native.cpp' FILE */
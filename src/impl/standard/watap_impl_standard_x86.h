@@ -0,0 +1,449 @@
+#ifndef __watap_impl_standard_x86_h_
+#define __watap_impl_standard_x86_h_
+
+#include "watap_impl_standard_exec.h"
+
+/***
+ * x86-64 machine code emission utilities (assembler, numeric instruction helpers, executable memory),
+ * shared by baseline and optimizing native code compilers.
+ ***/
+
+#if defined(WATAP_STANDARD_NATIVE_CODE)
+#  include <sys/mman.h>
+#  include <unistd.h>
+
+/* Native helper operand reading/writing macros */
+#define WATAP_STANDARD_NATIVE_GET(TYPE, SLOT) exec_util::ReadSlot<TYPE>(Slots + (SLOT))
+#define WATAP_STANDARD_NATIVE_SET(TYPE, VALUE) exec_util::WriteSlot<TYPE>(Slots, static_cast<TYPE>(VALUE))
+
+/* Native helper trap macro */
+#define WATAP_STANDARD_NATIVE_TRAP() return FALSE
+
+/***
+ * Native helper instruction implementations (by 'WATAP_STANDARD_*_INSTRUCTIONS' list KIND)
+ ***/
+
+/* Native helper binary operator and function implementation generation macros */
+#define WATAP_STANDARD_NATIVE_OP_BINARY(TYPE, OP) WATAP_STANDARD_NATIVE_SET(TYPE, WATAP_STANDARD_NATIVE_GET(TYPE, 0) OP WATAP_STANDARD_NATIVE_GET(TYPE, 1));
+#define WATAP_STANDARD_NATIVE_FN_BINARY(TYPE, FN) WATAP_STANDARD_NATIVE_SET(TYPE, FN(WATAP_STANDARD_NATIVE_GET(TYPE, 0), WATAP_STANDARD_NATIVE_GET(TYPE, 1)));
+
+/* Native helper shift and rotation implementation generation macros (shift count is taken by module of bit count) */
+#define WATAP_STANDARD_NATIVE_SHIFT(TYPE, OP) \
+  WATAP_STANDARD_NATIVE_SET(TYPE, WATAP_STANDARD_NATIVE_GET(TYPE, 0) OP (WATAP_STANDARD_NATIVE_GET(TYPE, 1) & (sizeof(TYPE) * 8 - 1)));
+#define WATAP_STANDARD_NATIVE_ROTATE(TYPE, FN) \
+  WATAP_STANDARD_NATIVE_SET(TYPE, FN(WATAP_STANDARD_NATIVE_GET(TYPE, 0), static_cast<INT>(WATAP_STANDARD_NATIVE_GET(TYPE, 1) & (sizeof(TYPE) * 8 - 1))));
+
+/* Native helper comparison operator implementation generation macro */
+#define WATAP_STANDARD_NATIVE_COMPARE(TYPE, OP) WATAP_STANDARD_NATIVE_SET(UINT32, WATAP_STANDARD_NATIVE_GET(TYPE, 0) OP WATAP_STANDARD_NATIVE_GET(TYPE, 1));
+
+/* Native helper signed division implementation generation macro (traps on zero division and overflow) */
+#define WATAP_STANDARD_NATIVE_DIV_S(TYPE)                                             \
+{                                                                                     \
+  const TYPE Lhs = WATAP_STANDARD_NATIVE_GET(TYPE, 0);                                \
+  const TYPE Rhs = WATAP_STANDARD_NATIVE_GET(TYPE, 1);                                \
+  if (Rhs == 0 || (Rhs == -1 && Lhs == std::numeric_limits<TYPE>::min()))             \
+    WATAP_STANDARD_NATIVE_TRAP();                                                     \
+  WATAP_STANDARD_NATIVE_SET(TYPE, Lhs / Rhs);                                         \
+}
+
+/* Native helper signed remainder implementation generation macro (traps on zero division) */
+#define WATAP_STANDARD_NATIVE_REM_S(TYPE)                                             \
+{                                                                                     \
+  const TYPE Lhs = WATAP_STANDARD_NATIVE_GET(TYPE, 0);                                \
+  const TYPE Rhs = WATAP_STANDARD_NATIVE_GET(TYPE, 1);                                \
+  if (Rhs == 0)                                                                       \
+    WATAP_STANDARD_NATIVE_TRAP();                                                     \
+  WATAP_STANDARD_NATIVE_SET(TYPE, Rhs == -1 ? 0 : Lhs % Rhs);                         \
+}
+
+/* Native helper unsigned division/remainder implementation generation macro (traps on zero division) */
+#define WATAP_STANDARD_NATIVE_DIV_U(TYPE, OP)                                         \
+{                                                                                     \
+  const TYPE Lhs = WATAP_STANDARD_NATIVE_GET(TYPE, 0);                                \
+  const TYPE Rhs = WATAP_STANDARD_NATIVE_GET(TYPE, 1);                                \
+  if (Rhs == 0)                                                                       \
+    WATAP_STANDARD_NATIVE_TRAP();                                                     \
+  WATAP_STANDARD_NATIVE_SET(TYPE, Lhs OP Rhs);                                        \
+}
+
+/* Native helper unary function, 'equal to zero', integer extend and conversion implementation generation macros */
+#define WATAP_STANDARD_NATIVE_FN_UNARY(TYPE, FN) WATAP_STANDARD_NATIVE_SET(TYPE, FN(WATAP_STANDARD_NATIVE_GET(TYPE, 0)));
+#define WATAP_STANDARD_NATIVE_EQZ(TYPE) WATAP_STANDARD_NATIVE_SET(UINT32, WATAP_STANDARD_NATIVE_GET(TYPE, 0) == 0);
+#define WATAP_STANDARD_NATIVE_I_EXTEND(BASE, SUB) WATAP_STANDARD_NATIVE_SET(BASE, WATAP_STANDARD_NATIVE_GET(SUB, 0));
+#define WATAP_STANDARD_NATIVE_CAST(FROM, TO) WATAP_STANDARD_NATIVE_SET(TO, WATAP_STANDARD_NATIVE_GET(FROM, 0));
+
+/* Native helper floating point to integer truncation implementation generation macro (traps on unrepresentable result) */
+#define WATAP_STANDARD_NATIVE_TRUNC(FROM, TO)                                         \
+{                                                                                     \
+  const FROM Value = WATAP_STANDARD_NATIVE_GET(FROM, 0);                              \
+  if (!exec_util::IsTruncatable<TO>(Value))                                           \
+    WATAP_STANDARD_NATIVE_TRAP();                                                     \
+  WATAP_STANDARD_NATIVE_SET(TO, Value);                                               \
+}
+
+/* Native helper table entry macro */
+#define WATAP_STANDARD_NATIVE_HELPER_ENTRY(NAME, KIND, ...) \
+  Helpers[static_cast<UINT8>(bin::instruction::NAME)] = []( UINT64 *Slots ) -> BOOL { WATAP_STANDARD_NATIVE_##KIND(__VA_ARGS__) return TRUE; };
+
+/* Memory access instruction list entry to access size 'case' conversion macro */
+#define WATAP_STANDARD_NATIVE_ACCESS_SIZE_CASE(NAME, KIND, TYPE, MEMORY_TYPE) case bin::instruction::NAME: return sizeof(MEMORY_TYPE);
+
+/* Project namespace // WASM Namespace // Implementation namesapce // Standard (multiplatform) implementation namespace */
+namespace watap::impl::standard
+{
+  /* x86-64 register (general purpose and SSE ones, unscoped, as registers are encoded by number) enumeration */
+  enum x86_register : UINT8
+  {
+    eRax, eRcx, eRdx, eRbx, eRsp, eRbp, eRsi, eRdi,
+    eR8,  eR9,  eR10, eR11, eR12, eR13, eR14, eR15,
+
+    eXmm0 = 0,     // SSE scratch register
+    eNoIndex = 16, // No memory operand index register
+  }; /* End of 'x86_register' enumeration */
+
+  /* x86-64 condition code enumeration */
+  enum class x86_condition : UINT8
+  {
+    eBelow        = 0x2, // CF = 1
+    eAboveEqual   = 0x3, // CF = 0
+    eEqual        = 0x4, // ZF = 1
+    eNotEqual     = 0x5, // ZF = 0
+    eBelowEqual   = 0x6, // CF = 1 or ZF = 1
+    eAbove        = 0x7, // CF = 0 and ZF = 0
+    eParity       = 0xA, // PF = 1 (unordered floating point comparison)
+    eNoParity     = 0xB, // PF = 0
+    eLess         = 0xC, // SF != OF
+    eGreaterEqual = 0xD, // SF = OF
+    eLessEqual    = 0xE, // ZF = 1 or SF != OF
+    eGreater      = 0xF, // ZF = 0 and SF = OF
+    eAlways       = 0xFF // Unconditional jump
+  }; /* End of 'x86_condition' enumeration */
+
+  /* x86-64 memory operand ([Base + Index * 2^Scale + Displacement]) representation structure */
+  struct x86_memory
+  {
+    UINT8 Base;                 // Base register
+    UINT8 Index = eNoIndex;     // Index register
+    UINT8 Scale = 0;            // Index scale (power of 2)
+    INT32 Displacement = 0;     // Displacement
+  }; /* End of 'x86_memory' structure */
+
+  /* x86-64 machine code assembler representation class */
+  class x86_assembler
+  {
+    /* REX prefix emission function (prefix is omitted if it has no bits set and isn't required to address byte registers).
+     * ARGUMENTS:
+     *   - is operation 64 bit:
+     *       BOOL Wide;
+     *   - ModRM reg field, SIB index and ModRM rm (or SIB base) field registers:
+     *       UINT8 Reg, Index, Base;
+     *   - are operands byte registers (spl, bpl, sil and dil are addressable with REX prefix only):
+     *       BOOL IsByte;
+     * RETURNS: None.
+     */
+    VOID Rex( BOOL Wide, UINT8 Reg, UINT8 Index, UINT8 Base, BOOL IsByte )
+    {
+      const UINT8 Prefix = 0x40 | Wide << 3 | (Reg >> 3 & 1) << 2 | (Index >> 3 & 1) << 1 | (Base >> 3 & 1);
+
+      if (Prefix != 0x40 || (IsByte && ((Reg >= eRsp && Reg <= eRdi) || (Base >= eRsp && Base <= eRdi))))
+        Byte(Prefix);
+    } /* End of 'Rex' function */
+
+  public:
+    std::vector<UINT8> Code; // Emitted code
+
+    /* Code bytes emission functions.
+     * ARGUMENTS:
+     *   - bytes to emit:
+     *       UINT8 Value;
+     *       std::initializer_list<UINT8> Values;
+     * RETURNS: None.
+     */
+    VOID Byte( UINT8 Value )
+    {
+      Code.push_back(Value);
+    } /* End of 'Byte' function */
+
+    VOID Bytes( std::initializer_list<UINT8> Values )
+    {
+      Code.insert(Code.end(), Values);
+    } /* End of 'Bytes' function */
+
+    /* Little endian immediate emission functions.
+     * ARGUMENTS:
+     *   - immediate:
+     *       UINT32 Value;
+     *       UINT64 Value;
+     * RETURNS: None.
+     */
+    VOID Dword( UINT32 Value )
+    {
+      for (SIZE_T i = 0; i < 4; i++)
+        Byte(static_cast<UINT8>(Value >> i * 8));
+    } /* End of 'Dword' function */
+
+    VOID Qword( UINT64 Value )
+    {
+      for (SIZE_T i = 0; i < 8; i++)
+        Byte(static_cast<UINT8>(Value >> i * 8));
+    } /* End of 'Qword' function */
+
+    /* Already emitted 32 bit value rewriting function.
+     * ARGUMENTS:
+     *   - value position:
+     *       SIZE_T Position;
+     *   - new value:
+     *       UINT32 Value;
+     * RETURNS: None.
+     */
+    VOID SetDword( SIZE_T Position, UINT32 Value )
+    {
+      for (SIZE_T i = 0; i < 4; i++)
+        Code[Position + i] = static_cast<UINT8>(Value >> i * 8);
+    } /* End of 'SetDword' function */
+
+    /* Instruction with register and memory operands emission function.
+     * ARGUMENTS:
+     *   - opcode bytes:
+     *       std::initializer_list<UINT8> Opcode;
+     *   - register operand (or opcode extension):
+     *       UINT8 Reg;
+     *   - memory operand:
+     *       x86_memory Operand;
+     *   - is operation 64 bit (REX.W is set):
+     *       BOOL Wide = FALSE;
+     *   - mandatory prefix (0x66, 0xF2 or 0xF3), 0 if not required:
+     *       UINT8 Prefix = 0;
+     *   - is register operand byte register:
+     *       BOOL IsByte = FALSE;
+     * RETURNS: None.
+     */
+    VOID Memory( std::initializer_list<UINT8> Opcode, UINT8 Reg, x86_memory Operand, BOOL Wide = FALSE, UINT8 Prefix = 0, BOOL IsByte = FALSE )
+    {
+      const BOOL HasIndex = Operand.Index != eNoIndex;
+      const UINT8 Mod = Operand.Displacement == 0 && (Operand.Base & 7) != eRbp ? 0
+        : Operand.Displacement >= -128 && Operand.Displacement <= 127 ? 1 : 2;
+
+      if (Prefix != 0)
+        Byte(Prefix);
+      Rex(Wide, Reg, HasIndex ? Operand.Index : 0, Operand.Base, IsByte);
+      Bytes(Opcode);
+
+      // rsp and r12 bases can be encoded with SIB byte only
+      if (HasIndex || (Operand.Base & 7) == eRsp)
+      {
+        Byte(Mod << 6 | (Reg & 7) << 3 | 4);
+        Byte(Operand.Scale << 6 | ((HasIndex ? Operand.Index : eRsp) & 7) << 3 | (Operand.Base & 7));
+      }
+      else
+        Byte(Mod << 6 | (Reg & 7) << 3 | (Operand.Base & 7));
+
+      if (Mod == 1)
+        Byte(static_cast<UINT8>(Operand.Displacement));
+      else if (Mod == 2)
+        Dword(static_cast<UINT32>(Operand.Displacement));
+    } /* End of 'Memory' function */
+
+    /* Instruction with two register operands emission function.
+     * ARGUMENTS:
+     *   - opcode bytes:
+     *       std::initializer_list<UINT8> Opcode;
+     *   - ModRM reg field register (or opcode extension):
+     *       UINT8 Reg;
+     *   - ModRM rm field register:
+     *       UINT8 Rm;
+     *   - is operation 64 bit (REX.W is set):
+     *       BOOL Wide = FALSE;
+     *   - mandatory prefix (0x66, 0xF2 or 0xF3), 0 if not required:
+     *       UINT8 Prefix = 0;
+     *   - are operands byte registers:
+     *       BOOL IsByte = FALSE;
+     * RETURNS: None.
+     */
+    VOID Register( std::initializer_list<UINT8> Opcode, UINT8 Reg, UINT8 Rm, BOOL Wide = FALSE, UINT8 Prefix = 0, BOOL IsByte = FALSE )
+    {
+      if (Prefix != 0)
+        Byte(Prefix);
+      Rex(Wide, Reg, 0, Rm, IsByte);
+      Bytes(Opcode);
+      Byte(0xC0 | (Reg & 7) << 3 | (Rm & 7));
+    } /* End of 'Register' function */
+
+    /* Instruction with register and RIP relative memory operands emission function (instruction must not have immediate).
+     * ARGUMENTS:
+     *   - opcode bytes:
+     *       std::initializer_list<UINT8> Opcode;
+     *   - register operand (or opcode extension):
+     *       UINT8 Reg;
+     *   - is operation 64 bit (REX.W is set):
+     *       BOOL Wide = FALSE;
+     *   - mandatory prefix (0x66, 0xF2 or 0xF3), 0 if not required:
+     *       UINT8 Prefix = 0;
+     * RETURNS:
+     *   (SIZE_T) Position of displacement to patch;
+     */
+    SIZE_T Relative( std::initializer_list<UINT8> Opcode, UINT8 Reg, BOOL Wide = FALSE, UINT8 Prefix = 0 )
+    {
+      if (Prefix != 0)
+        Byte(Prefix);
+      Rex(Wide, Reg, 0, 0, FALSE);
+      Bytes(Opcode);
+      Byte((Reg & 7) << 3 | 5);
+      Dword(0);
+      return Code.size() - 4;
+    } /* End of 'Relative' function */
+
+    /* 32 bit immediate to register moving ('mov r32, imm32', upper register half is zeroed) emission function.
+     * ARGUMENTS:
+     *   - destination register:
+     *       UINT8 Reg;
+     *   - immediate:
+     *       UINT32 Value;
+     * RETURNS: None.
+     */
+    VOID MoveImmediate( UINT8 Reg, UINT32 Value )
+    {
+      Rex(FALSE, 0, 0, Reg, FALSE);
+      Byte(0xB8 | (Reg & 7));
+      Dword(Value);
+    } /* End of 'MoveImmediate' function */
+
+    /* 64 bit immediate to register moving emission function (the shortest encoding is selected, flags aren't changed).
+     * ARGUMENTS:
+     *   - destination register:
+     *       UINT8 Reg;
+     *   - immediate:
+     *       UINT64 Value;
+     * RETURNS: None.
+     */
+    VOID MoveImmediate64( UINT8 Reg, UINT64 Value )
+    {
+      if (Value <= 0xFFFFFFFF)
+        MoveImmediate(Reg, static_cast<UINT32>(Value));
+      else if (static_cast<INT64>(Value) == static_cast<INT32>(Value))
+      {
+        Register({0xC7}, 0, Reg, TRUE);                                            // mov r64, simm32
+        Dword(static_cast<UINT32>(Value));
+      }
+      else
+      {
+        Rex(TRUE, 0, 0, Reg, FALSE);                                               // mov r64, imm64
+        Byte(0xB8 | (Reg & 7));
+        Qword(Value);
+      }
+    } /* End of 'MoveImmediate64' function */
+
+    /* Jump with 32 bit displacement emission function.
+     * ARGUMENTS:
+     *   - jump condition:
+     *       x86_condition Condition;
+     * RETURNS:
+     *   (SIZE_T) Position of displacement to patch;
+     */
+    SIZE_T Jump( x86_condition Condition )
+    {
+      if (Condition == x86_condition::eAlways)
+        Byte(0xE9);
+      else
+        Bytes({0x0F, static_cast<UINT8>(0x80 | static_cast<UINT8>(Condition))});
+      Dword(0);
+      return Code.size() - 4;
+    } /* End of 'Jump' function */
+
+    /* Jump (or RIP relative operand) displacement patching function.
+     * ARGUMENTS:
+     *   - displacement position:
+     *       SIZE_T Position;
+     *   - position of code to jump to:
+     *       SIZE_T Target;
+     * RETURNS: None.
+     */
+    VOID Patch( SIZE_T Position, SIZE_T Target )
+    {
+      SetDword(Position, static_cast<UINT32>(static_cast<INT64>(Target) - static_cast<INT64>(Position + 4)));
+    } /* End of 'Patch' function */
+
+    /* Absolute address call (through rax) emission function.
+     * ARGUMENTS:
+     *   - function to call:
+     *       function_type *Function;
+     * RETURNS: None.
+     */
+    template <typename function_type>
+      VOID Call( function_type *Function )
+      {
+        Bytes({0x48, 0xB8});
+        Qword(std::bit_cast<UINT64>(Function));
+        Bytes({0xFF, 0xD0});
+      } /* End of 'Call' function */
+  }; /* End of 'x86_assembler' class */
+
+  /* Native numeric instruction helper (operands are stored in consecutive frame slots from 'Slots', result is stored to the first one), returns FALSE on trap */
+  using native_helper = BOOL (*)( UINT64 *Slots );
+
+  /* Native numeric instruction helpers (indexed by instruction) */
+  inline const std::array<native_helper, 256> NativeHelpers = []( VOID )
+    {
+      std::array<native_helper, 256> Helpers {};
+
+      WATAP_STANDARD_UNARY_INSTRUCTIONS(WATAP_STANDARD_NATIVE_HELPER_ENTRY)
+      WATAP_STANDARD_BINARY_INSTRUCTIONS(WATAP_STANDARD_NATIVE_HELPER_ENTRY)
+      return Helpers;
+    }();
+
+  /* Memory access instruction access size getting function.
+   * ARGUMENTS:
+   *   - memory access instruction:
+   *       bin::instruction Instruction;
+   * RETURNS:
+   *   (UINT32) Size of memory value in bytes;
+   */
+  inline UINT32 GetAccessSize( bin::instruction Instruction ) noexcept
+  {
+    switch (Instruction)
+    {
+    WATAP_STANDARD_LOAD_INSTRUCTIONS(WATAP_STANDARD_NATIVE_ACCESS_SIZE_CASE)
+    WATAP_STANDARD_STORE_INSTRUCTIONS(WATAP_STANDARD_NATIVE_ACCESS_SIZE_CASE)
+    default:
+      return 0;
+    }
+  } /* End of 'GetAccessSize' function */
+
+  /* Emitted code to executable memory publishing function (code is copied to writable pages, which are made executable after
+   * that, so pages are never writable and executable simultaneously).
+   * ARGUMENTS:
+   *   - code to publish:
+   *       const std::vector<UINT8> &Code;
+   *   - code trap exit offset (linear memory access faults of code resume execution at it):
+   *       SIZE_T TrapOffset;
+   * RETURNS:
+   *   (std::shared_ptr<const VOID>) Executable code pages (unmapped with the last pointer copy), nullptr if pages can't be allocated;
+   */
+  inline std::shared_ptr<const VOID> PublishCode( const std::vector<UINT8> &Code, SIZE_T TrapOffset )
+  {
+    const SIZE_T PageSize = static_cast<SIZE_T>(sysconf(_SC_PAGESIZE));
+    const SIZE_T Size = (Code.size() + PageSize - 1) / PageSize * PageSize;
+    VOID *Memory = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (Memory == MAP_FAILED)
+      return nullptr;
+    std::memcpy(Memory, Code.data(), Code.size());
+    if (mprotect(Memory, Size, PROT_READ | PROT_EXEC) != 0)
+    {
+      munmap(Memory, Size);
+      return nullptr;
+    }
+    memory_util::RegisterCode(Memory, Size, static_cast<const UINT8 *>(Memory) + TrapOffset);
+    return std::shared_ptr<const VOID>(Memory, [Size]( const VOID *Memory )
+      {
+        memory_util::UnregisterCode(Memory);
+        munmap(const_cast<VOID *>(Memory), Size);
+      });
+  } /* End of 'PublishCode' function */
+} /* end of 'watap::impl::standard' namespace */
+
+#endif // defined(WATAP_STANDARD_NATIVE_CODE)
+
+#endif // !defined(__watap_impl_standard_x86_h_)
+
+/* END OF 'watap_impl_standard_x86.h' FILE */
@@ -4,6 +4,7 @@
 #define __watap_h_
 
 #include "watap_interface.h"
+#include "watap_host.h"
 #include "impl/standard/watap_impl_standard.h"
 
 #endif // !defined(__watap_h_)
@@ -123,6 +123,8 @@ namespace watap::bin
     eBrTable            = 0x0E, // Switch/match
     eCall               = 0x10, // Call function by local index
     eCallIndirect       = 0x11, // Call from function ID
+    eReturnCall         = 0x12, // Tail call function by local index (caller frame is replaced by callee one)
+    eReturnCallIndirect = 0x13, // Tail call from function ID
 
     eDrop               = 0x1A, // Pop stack
     eSelect             = 0x1B, // Select nonzero numeric operand
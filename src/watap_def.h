@@ -12,6 +12,7 @@
 #include <variant>
 #include <optional>
 #include <numeric>
+#include <memory>
 
 /* Debug memory allocation support */ 
 #if !defined(NDEBUG)
@@ -57,13 +58,13 @@ namespace watap
     /* Integer types */
     using INT8  = char;
     using INT16 = short;
-    using INT32 = long;
+    using INT32 = int;
     using INT64 = long long;
 
     /* Unsigned integer types */
     using UINT8  = unsigned char;
     using UINT16 = unsigned short;
-    using UINT32 = unsigned long;
+    using UINT32 = unsigned int;
     using UINT64 = unsigned long long;
 
     /* Special type aliases */
@@ -120,8 +121,9 @@ namespace watap
  * Useful list of rust-like optional unwrapping functions.
  ***/
 
-/* Setting */
-#define WATAP_BRANCH(EXPRESSION, IF_TRUE, IF_FALSE) do { if (auto __tmp_val = (EXPRESSION)) { IF_TRUE(*__tmp_val); } else { IF_FALSE; } } while (FALSE)
+/* Setting (macro expands to unbraced 'if'/'else' statement for 'break' to reach enclosing loop, so it and macros below must be
+ * used as full statements only, macro, that is body of 'if', must be braced, otherwise following 'else' binds to macro one) */
+#define WATAP_BRANCH(EXPRESSION, IF_TRUE, IF_FALSE) if (auto __tmp_val = (EXPRESSION); !__tmp_val) { IF_FALSE; } else { IF_TRUE(*__tmp_val); }
 
 // Meta setter
 #define __WATAP_FN_SET_TO_HELPER(VALUE) = (VALUE)
@@ -0,0 +1,242 @@
+#ifndef __watap_host_h_
+#define __watap_host_h_
+
+#include "watap_interface.h"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+/* Project namespace // WASM Runtime implementation namespace */
+namespace watap
+{
+  /* Host function generation utility namespace */
+  namespace host_util
+  {
+    /* Host value (type, that may be passed to and returned from host function) concept */
+    template <typename type>
+      concept host_value =
+        std::same_as<type, INT32> || std::same_as<type, UINT32> ||
+        std::same_as<type, INT64> || std::same_as<type, UINT64> ||
+        std::same_as<type, FLOAT32> || std::same_as<type, FLOAT64>;
+
+    /* WASM value type of host value type */
+    template <host_value type>
+      inline constexpr bin::value_type ValueType =
+        sizeof(type) == 4
+          ? (std::is_floating_point_v<type> ? bin::value_type::eF32 : bin::value_type::eI32)
+          : (std::is_floating_point_v<type> ? bin::value_type::eF64 : bin::value_type::eI64);
+
+    /* Evaluation stack slot reading function.
+     * ARGUMENTS:
+     *   - slot:
+     *       UINT64 Slot;
+     * RETURNS:
+     *   (type) Value, kept in slot;
+     */
+    template <host_value type>
+      inline type FromSlot( UINT64 Slot ) noexcept
+      {
+        if constexpr (sizeof(type) == 8)
+          return std::bit_cast<type>(Slot);
+        else
+          return std::bit_cast<type>(static_cast<UINT32>(Slot));
+      } /* End of 'FromSlot' function */
+
+    /* Evaluation stack slot writing function.
+     * ARGUMENTS:
+     *   - value:
+     *       type Value;
+     * RETURNS:
+     *   (UINT64) Slot (upper bits of 32 bit values are zero);
+     */
+    template <host_value type>
+      inline UINT64 ToSlot( type Value ) noexcept
+      {
+        if constexpr (sizeof(type) == 8)
+          return std::bit_cast<UINT64>(Value);
+        else
+          return std::bit_cast<UINT32>(Value);
+      } /* End of 'ToSlot' function */
+
+    /* Host function signature description structure (defined for supported signatures only) */
+    template <typename signature>
+      struct signature_traits;
+
+    /* Host function signature description structure */
+    template <typename return_type, host_value ...argument_types>
+      requires std::is_void_v<return_type> || host_value<return_type>
+      struct signature_traits<return_type ( argument_types... )>
+      {
+        /* WASM function signature getting function.
+         * ARGUMENTS: None.
+         * RETURNS:
+         *   (function_signature) Signature;
+         */
+        static function_signature GetSignature( VOID )
+        {
+          function_signature Signature { .ArgumentTypes = {ValueType<argument_types>...}, .ReturnType = std::nullopt };
+
+          if constexpr (!std::is_void_v<return_type>)
+            Signature.ReturnType = ValueType<return_type>;
+          return Signature;
+        } /* End of 'GetSignature' function */
+
+        /* Trampoline function.
+         * TEMPLATE ARGUMENTS:
+         *   - called object type:
+         *       typename callable;
+         * ARGUMENTS:
+         *   - called object:
+         *       VOID *Callable;
+         *   - argument slots (result is written to the first one):
+         *       UINT64 *Slots;
+         * RETURNS: None.
+         */
+        template <typename callable>
+          static VOID Trampoline( VOID *Callable, UINT64 *Slots )
+          {
+            [&]<SIZE_T ...Indices>( std::index_sequence<Indices...> )
+            {
+              callable &Function = *static_cast<callable *>(Callable);
+
+              if constexpr (std::is_void_v<return_type>)
+                std::invoke(Function, FromSlot<argument_types>(Slots[Indices])...);
+              else
+                Slots[0] = ToSlot<return_type>(std::invoke(Function, FromSlot<argument_types>(Slots[Indices])...));
+            }(std::index_sequence_for<argument_types...> {});
+          } /* End of 'Trampoline' function */
+      }; /* End of 'signature_traits' structure */
+
+    /* Function type of 'std::function' getting structure */
+    template <typename function>
+      struct function_type_of;
+
+    /* Function type of 'std::function' getting structure */
+    template <typename return_type, typename ...argument_types>
+      struct function_type_of<std::function<return_type ( argument_types... )>>
+      {
+        using type = return_type ( argument_types... ); // Function type
+      }; /* End of 'function_type_of' structure */
+
+    /* Host function signature resolving structure (explicitly specified signature is used as is) */
+    template <typename signature, typename callable>
+      struct resolved_signature
+      {
+        using type = signature; // Signature
+      }; /* End of 'resolved_signature' structure */
+
+    /* Host function signature resolving structure (signature is deduced for function pointers and objects with single non-template call operator) */
+    template <typename callable>
+      struct resolved_signature<VOID, callable>
+      {
+        using type = typename function_type_of<decltype(std::function(std::declval<callable>()))>::type; // Signature
+      }; /* End of 'resolved_signature' structure */
+  } /* end of 'host_util' namespace */
+
+  /* Host function creation function.
+   * TEMPLATE ARGUMENTS:
+   *   - function signature (e.g. 'FLOAT32 ( INT32, FLOAT32 )'), deduced from callable type if not specified:
+   *       typename signature = VOID;
+   * ARGUMENTS:
+   *   - called object (function pointer, lambda or other object, callable with signature arguments):
+   *       callable &&Callable;
+   * RETURNS:
+   *   (host_function) Host function, callable is copied (or moved) to;
+   */
+  template <typename signature = VOID, typename callable>
+    host_function MakeHostFunction( callable &&Callable )
+    {
+      using callable_type = std::decay_t<callable>;
+      using traits = host_util::signature_traits<typename host_util::resolved_signature<signature, callable_type>::type>;
+
+      return host_function
+      {
+        .Signature = traits::GetSignature(),
+        .Trampoline = &traits::template Trampoline<callable_type>,
+        .Callable = std::make_shared<callable_type>(std::forward<callable>(Callable)),
+      };
+    } /* End of 'MakeHostFunction' function */
+
+  /* Typed exported function handle */
+  template <typename return_type, host_util::host_value ...argument_types>
+    requires std::is_void_v<return_type> || host_util::host_value<return_type>
+    class export_function<return_type ( argument_types... )>
+    {
+      instance *Instance = nullptr; // Instance function is exported from
+      UINT32 FunctionIndex = 0;     // Exported function index
+
+      /* Handles with function are created by 'instance::GetExport' only (function export and signature are checked there) */
+      friend class instance;
+
+      /* Handle constructor.
+       * ARGUMENTS:
+       *   - instance function is exported from:
+       *       instance *Instance;
+       *   - exported function index:
+       *       UINT32 FunctionIndex;
+       */
+      export_function( instance *Instance, UINT32 FunctionIndex ) : Instance(Instance), FunctionIndex(FunctionIndex)
+      {
+      } /* End of 'export_function' function */
+
+    public:
+      /* Call result type (call success flag for functions without result) */
+      using result_type = std::conditional_t<std::is_void_v<return_type>, BOOL, std::optional<return_type>>;
+
+      /* Empty handle default constructor */
+      export_function( VOID ) = default;
+
+      /* Handle non-emptiness checking operator.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (BOOL) TRUE if handle refers to function, FALSE otherwise;
+       */
+      explicit operator BOOL( VOID ) const noexcept
+      {
+        return Instance != nullptr;
+      } /* End of 'operator BOOL' function */
+
+      /* Function calling operator.
+       * ARGUMENTS:
+       *   - function arguments:
+       *       argument_types ...Arguments;
+       * RETURNS:
+       *   (result_type) Function result (TRUE for functions without result) if function finished without trap, std::nullopt (FALSE) otherwise
+       *   (as well as if handle is called by host function, imported by instance);
+       */
+      result_type operator()( argument_types ...Arguments ) const
+      {
+        UINT64 Slots[std::max<SIZE_T>(sizeof...(argument_types), 1)] {host_util::ToSlot<argument_types>(Arguments)...};
+
+        if (Instance == nullptr || !Instance->CallFunction(FunctionIndex, Slots))
+          return result_type {};
+        if constexpr (std::is_void_v<return_type>)
+          return TRUE;
+        else
+          return host_util::FromSlot<return_type>(Slots[0]);
+      } /* End of 'operator()' function */
+    }; /* End of 'export_function' class */
+
+  /* Typed exported function handle getting function.
+   * TEMPLATE ARGUMENTS:
+   *   - function signature (e.g. 'INT32 ( INT32, FLOAT64 )'):
+   *       typename signature;
+   * ARGUMENTS:
+   *   - function name:
+   *       std::string_view FunctionName;
+   * RETURNS:
+   *   (export_function<signature>) Function handle, empty if there is no such function export;
+   */
+  template <typename signature>
+    export_function<signature> instance::GetExport( std::string_view FunctionName )
+    {
+      const std::optional<UINT32> FunctionIndex = FindFunction(FunctionName, host_util::signature_traits<signature>::GetSignature());
+
+      return FunctionIndex ? export_function<signature>(this, *FunctionIndex) : export_function<signature>();
+    } /* End of 'GetExport' function */
+} /* end of 'watap' namespace */
+
+#endif // !defined(__watap_host_h_)
+
+/* END OF 'watap_host.h' FILE */
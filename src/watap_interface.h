@@ -14,8 +14,37 @@ namespace watap
   {
     std::vector<bin::value_type> ArgumentTypes; // List of argument types
     std::optional<bin::value_type> ReturnType;  // List of return types
+
+    /* Signature comparison operator.
+     * ARGUMENTS:
+     *   - another signature:
+     *       const function_signature &Rhs;
+     * RETURNS:
+     *   (BOOL) TRUE if signatures are equal, FALSE otherwise;
+     */
+    BOOL operator==( const function_signature &Rhs ) const = default;
   }; /* End of 'function_type' structure */
 
+  /* Host function trampoline pointer. Trampoline reads arguments from guest evaluation stack 8 byte slots
+   * (32 bit values are kept in lower slot halves, upper ones are zero), calls host callable and writes its result to the first slot */
+  using host_trampoline = VOID (*)( VOID *Callable, UINT64 *Slots );
+
+  /* Host function (importable by module) representation structure */
+  struct host_function
+  {
+    function_signature Signature;        // Function signature
+    host_trampoline Trampoline = nullptr; // Trampoline, generated for callable type
+    std::shared_ptr<VOID> Callable;      // Called object (owned by every function copy)
+  }; /* End of 'host_function' structure */
+
+  /* Host function, provided to module imports, description */
+  struct host_function_import
+  {
+    std::string ModuleName; // Function module name
+    std::string Name;       // Function name
+    host_function Function; // Host function
+  }; /* End of 'host_function_import' structure */
+
   /* Function import requirement description */
   struct function_import_description
   {
@@ -60,7 +89,7 @@ namespace watap
   /* Import table descriptor */
   struct import_table_info
   {
-
+    std::vector<host_function_import> Functions; // Host functions (bound to module function imports of the same name and signature)
   }; /* End of 'import_table_info' structure */
 
   /* WASM Module representation structure */
@@ -81,13 +110,24 @@ namespace watap
   public:
   }; /* End of 'import_table' structure */
 
+  /* Initialized instance state (memory content and data segment state) snapshot representation class */
+  class snapshot abstract
+  {
+  public:
+  }; /* End of 'snapshot' class */
+
   /* Module instance descriptor */
   struct instance_info
   {
     source *ModuleSource; // Actual module
     import_table *ImportTable;   // Table of module imports
+    snapshot *Snapshot = nullptr; // Snapshot of module instance to start from (its initialization is skipped), nullptr if instance is started from module
   }; /* End of 'module_instance_info' structure */
 
+  /* Typed exported function handle (defined for supported signatures only) */
+  template <typename signature>
+    class export_function;
+
   /* Started module representation class */
   class instance abstract
   {
@@ -99,10 +139,34 @@ namespace watap
      *   - function parameter list:
      *       std::span<const value> Parameters;
      * RETURNS:
-     *   (std::optional<value>) Return value if called, std::nullopt otherwise;
+     *   (std::optional<value>) Return value if called, std::nullopt otherwise (function trapped or is called by host function, imported by instance);
      */
     virtual std::optional<value> Call( std::string_view FunctionName, std::span<const value> Parameters = {} ) = 0;
 
+    /* Exported function finding function.
+     * ARGUMENTS:
+     *   - function name:
+     *       std::string_view FunctionName;
+     *   - expected function signature:
+     *       const function_signature &Signature;
+     * RETURNS:
+     *   (std::optional<UINT32>) Function index if function with such name and signature is exported, std::nullopt otherwise;
+     */
+    virtual std::optional<UINT32> FindFunction( std::string_view FunctionName, const function_signature &Signature ) const = 0;
+
+    /* Typed exported function handle getting function (function is found and signature is checked once, handle calls don't look it up).
+     * TEMPLATE ARGUMENTS:
+     *   - function signature (e.g. 'INT32 ( INT32, FLOAT64 )'):
+     *       typename signature;
+     * ARGUMENTS:
+     *   - function name:
+     *       std::string_view FunctionName;
+     * RETURNS:
+     *   (export_function<signature>) Function handle, empty if there is no such function export;
+     */
+    template <typename signature>
+      export_function<signature> GetExport( std::string_view FunctionName );
+
     /* Global value getting function.
      * ARGUMENTS:
      *   - global value name:
@@ -137,11 +201,27 @@ namespace watap
      */
     virtual BOOL IsTrapped( VOID ) const = 0;
 
-    /* Module restart function.
+    /* Module restart function (restart by host function, imported by instance, is ignored).
      * ARGUMENTS: None.
      * RETURNS: None.
      */
     virtual VOID Restart( VOID ) = 0;
+
+  protected:
+    /* Typed exported function handles are the only callers of function by index */
+    template <typename signature>
+      friend class export_function;
+
+    /* Function by index calling function (index and slot layout are not checked, so it's called by export handle only).
+     * ARGUMENTS:
+     *   - function index (got by 'FindFunction' call with function signature):
+     *       UINT32 FunctionIndex;
+     *   - argument slots (in format of host function ones, result is written to the first slot):
+     *       UINT64 *Slots;
+     * RETURNS:
+     *   (BOOL) TRUE if function finished without trap, FALSE otherwise (or if it's called by host function, imported by instance);
+     */
+    virtual BOOL CallFunction( UINT32 FunctionIndex, UINT64 *Slots ) = 0;
   }; /* End of 'runtime' class */
 
   /* WASM Runtime interface representation structure */
@@ -198,6 +278,23 @@ namespace watap
      * RETURNS: None.
      */ 
     virtual VOID DestroyInstance( instance *Runtime ) = 0;
+
+    /* Instance snapshot create function (instances, created from snapshot, share its memory pages until they write them).
+     * ARGUMENTS:
+     *   - initialized instance (not trapped and not running):
+     *       instance *Instance;
+     * RETURNS:
+     *   (snapshot *) Created snapshot pointer, nullptr if instance state can't be captured;
+     */
+    virtual snapshot * CreateSnapshot( instance *Instance ) = 0;
+
+    /* Instance snapshot destroy function (instances, created from snapshot, stay valid).
+     * ARGUMENTS:
+     *   - snapshot pointer:
+     *       snapshot *Snapshot;
+     * RETURNS: None.
+     */
+    virtual VOID DestroySnapshot( snapshot *Snapshot ) = 0;
   }; /* End of 'interface' class */
 } /* end of 'watap' namespace */
 
@@ -169,7 +169,7 @@ namespace watap
         do
         {
           Byte = *Stream++;
-          Result |= (Byte & 0x7F) << Shift;
+          Result |= static_cast<SSIZE_T>(Byte & 0x7F) << Shift;
           Shift += 7;
         } while (Byte & 0x80);
 
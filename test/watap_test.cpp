@@ -0,0 +1,33 @@
+/***
+ * Standard implementation test runner (it's run by 'watap_test' project build, failed test fails the build).
+ ***/
+
+#include "watap_test.h"
+
+using namespace watap::common_types;
+
+INT main( VOID )
+{
+  const std::pair<std::string_view, watap::test::test_function> Tests[]
+  {
+    {"call allocations",     watap::test::TestCallAllocations},
+    {"nested loop osr",      watap::test::TestNestedLoopOsr},
+    {"deep recursion",       watap::test::TestDeepRecursion},
+    {"constant wrap select", watap::test::TestConstantWrapSelect},
+    {"host reentry",         watap::test::TestHostReentry},
+  };
+  INT FailCount = 0;
+
+  for (const auto &[Name, Test] : Tests)
+  {
+    const BOOL IsPassed = Test();
+
+    std::cout << std::format("{}: {}\n", Name, IsPassed ? "PASSED" : "FAILED");
+    FailCount += !IsPassed;
+  }
+
+  std::cout << std::format("{} of {} tests failed\n", FailCount, std::size(Tests));
+  return FailCount == 0 ? 0 : 1;
+}
+
+/* END OF 'watap_test.cpp' FILE */
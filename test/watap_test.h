@@ -0,0 +1,54 @@
+/***
+ * Standard implementation test set declaration.
+ ***/
+
+#ifndef __watap_test_h_
+#define __watap_test_h_
+
+#include "watap.h"
+
+/* Project namespace // Test namespace */
+namespace watap::test
+{
+  /* Test function (failures are printed by test itself), returns TRUE if test passed */
+  using test_function = BOOL (*)( VOID );
+
+  /* Steady state call allocation test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if calls made after warm-up one don't allocate heap memory, FALSE otherwise;
+   */
+  BOOL TestCallAllocations( VOID );
+
+  /* Nested loop on-stack replacement test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if loop entered by on-stack replacement gives result of interpreted one, FALSE otherwise;
+   */
+  BOOL TestNestedLoopOsr( VOID );
+
+  /* Deep recursion test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if recursion deeper than call stack depth traps with and without tier up, FALSE otherwise;
+   */
+  BOOL TestDeepRecursion( VOID );
+
+  /* Constant wrap select test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if select by wrapped constant condition gives the same result with every bytecode type, FALSE otherwise;
+   */
+  BOOL TestConstantWrapSelect( VOID );
+
+  /* Host reentry test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if calls of instance by its host function fail and don't affect running call, FALSE otherwise;
+   */
+  BOOL TestHostReentry( VOID );
+} /* end of 'watap::test' namespace */
+
+#endif // !defined(__watap_test_h_)
+
+/* END OF 'watap_test.h' FILE */
@@ -0,0 +1,166 @@
+/***
+ * Steady state call allocation test.
+ *
+ * Instance call stack, frames and evaluation stack are allocated by instance creation and first calls,
+ * so calls made after warm-up one must not allocate heap memory. Allocation functions ('malloc', 'calloc'
+ * and 'realloc' with glibc, global 'operator new' otherwise) are replaced by counting ones for the whole
+ * test program.
+ ***/
+
+#include <cstdlib>
+#include <new>
+
+#include "watap_test.h"
+
+using namespace watap::common_types;
+
+/* Count of allocations made since program start */
+static SIZE_T AllocationCount = 0;
+
+#if defined(__GLIBC__)
+extern "C"
+{
+  VOID * __libc_malloc( SIZE_T Size );
+  VOID * __libc_calloc( SIZE_T Count, SIZE_T Size );
+  VOID * __libc_realloc( VOID *Memory, SIZE_T Size );
+
+  /* Counting 'malloc' replacement ('operator new' of libstdc++ is implemented with it) */
+  VOID * malloc( SIZE_T Size )
+  {
+    AllocationCount++;
+    return __libc_malloc(Size);
+  } /* End of 'malloc' function */
+
+  /* Counting 'calloc' replacement */
+  VOID * calloc( SIZE_T Count, SIZE_T Size )
+  {
+    AllocationCount++;
+    return __libc_calloc(Count, Size);
+  } /* End of 'calloc' function */
+
+  /* Counting 'realloc' replacement */
+  VOID * realloc( VOID *Memory, SIZE_T Size )
+  {
+    AllocationCount++;
+    return __libc_realloc(Memory, Size);
+  } /* End of 'realloc' function */
+}
+#else // defined(__GLIBC__)
+/* Counting global 'operator new' replacement (C runtime allocation functions can't be replaced portably) */
+VOID * operator new( SIZE_T Size )
+{
+  AllocationCount++;
+  if (VOID *Memory = std::malloc(Size == 0 ? 1 : Size))
+    return Memory;
+  throw std::bad_alloc();
+} /* End of 'operator new' function */
+
+/* Global 'operator delete' replacement (pair of replaced 'operator new') */
+VOID operator delete( VOID *Memory ) noexcept
+{
+  std::free(Memory);
+} /* End of 'operator delete' function */
+#endif // defined(__GLIBC__)
+
+/* Project namespace // Test namespace */
+namespace watap::test
+{
+  /* Test module:
+   *   (func $fib (export "fib") (param $n i32) (result i32)
+   *     (if (result i32) (i32.lt_s (local.get $n) (i32.const 2))
+   *       (then (local.get $n))
+   *       (else (i32.add (call $fib (i32.sub (local.get $n) (i32.const 1))) (call $fib (i32.sub (local.get $n) (i32.const 2)))))))
+   *   (func $rec (export "rec") (param $n i32) (result i32)
+   *     (if (result i32) (i32.eqz (local.get $n))
+   *       (then (i32.const 0))
+   *       (else (i32.add (local.get $n) (call $rec (i32.sub (local.get $n) (i32.const 1)))))))
+   */
+  static const UINT8 RecursionModule[]
+  {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60, 0x01, 0x7F, 0x01, 0x7F,
+    0x03, 0x03, 0x02, 0x00, 0x00, 0x07, 0x0D, 0x02, 0x03, 0x66, 0x69, 0x62, 0x00, 0x00, 0x03, 0x72,
+    0x65, 0x63, 0x00, 0x01, 0x0A, 0x34, 0x02, 0x1C, 0x00, 0x20, 0x00, 0x41, 0x02, 0x48, 0x04, 0x7F,
+    0x20, 0x00, 0x05, 0x20, 0x00, 0x41, 0x01, 0x6B, 0x10, 0x00, 0x20, 0x00, 0x41, 0x02, 0x6B, 0x10,
+    0x00, 0x6A, 0x0B, 0x0B, 0x15, 0x00, 0x20, 0x00, 0x45, 0x04, 0x7F, 0x41, 0x00, 0x05, 0x20, 0x00,
+    0x20, 0x00, 0x41, 0x01, 0x6B, 0x10, 0x01, 0x6A, 0x0B, 0x0B,
+  };
+
+  /* Tested export representation structure */
+  struct test_call
+  {
+    std::string_view Name; // Exported function name
+    INT32 Argument;        // Call argument
+    INT32 Expected;        // Expected call result
+  }; /* End of 'test_call' structure */
+
+  /* Steady state call allocation test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if calls made after warm-up one don't allocate heap memory, FALSE otherwise;
+   */
+  BOOL TestCallAllocations( VOID )
+  {
+    const test_call Calls[]
+    {
+      {"fib", 20, 6765},
+      {"rec", 1000, 500500},
+    };
+    const UINT32 CallCount = 100;
+    INT FailCount = 0;
+
+    // Every optimization, dispatch and bytecode combination, tier up is disabled (it compiles functions on steady state calls)
+    for (UINT32 Config = 0; Config < 16; Config++)
+    {
+      auto Wasm = impl::standard::Create(impl::standard::settings {
+        .Dispatch = (Config & 2) != 0 ? impl::standard::dispatch_type::eSwitch : impl::standard::dispatch_type::eThreaded,
+        .Bytecode = static_cast<impl::standard::bytecode_type>(Config >> 2),
+        .Optimization = (Config & 1) != 0,
+        .TierUpCallCount = 0,
+        .TierUpBackEdgeCount = 0,
+      });
+      auto ModuleSource = Wasm->CreateSource(source_info { std::span<const UINT8>(RecursionModule) });
+      auto Runtime = Wasm->CreateInstance(instance_info {
+        .ModuleSource = ModuleSource,
+        .ImportTable = nullptr,
+      });
+
+      for (const test_call &Call : Calls)
+      {
+        const value Argument { .U64x2 {static_cast<UINT32>(Call.Argument), 0} };
+        auto Function = Runtime->GetExport<INT32 ( INT32 )>(Call.Name);
+
+        // Warm-up calls (stacks grow to their steady state size)
+        Runtime->Call(Call.Name, std::span<const value>(&Argument, 1));
+        Function(Call.Argument);
+
+        const SIZE_T StartAllocationCount = AllocationCount;
+        UINT32 WrongResultCount = 0;
+
+        for (UINT32 i = 0; i < CallCount; i++)
+        {
+          std::optional<value> Result = Runtime->Call(Call.Name, std::span<const value>(&Argument, 1));
+
+          WrongResultCount += !Result || Result->I32x4[0] != Call.Expected;
+          WrongResultCount += Function(Call.Argument) != Call.Expected;
+        }
+
+        const SIZE_T CallAllocationCount = AllocationCount - StartAllocationCount;
+
+        if (CallAllocationCount != 0 || WrongResultCount != 0)
+        {
+          std::cout << std::format("  config {}, {}({}): {} allocations, {} wrong results in {} calls\n",
+            Config, Call.Name, Call.Argument, CallAllocationCount, WrongResultCount, CallCount * 2);
+          FailCount++;
+        }
+      }
+
+      Wasm->DestroyInstance(Runtime);
+      Wasm->DestroySource(ModuleSource);
+      impl::standard::Destroy(Wasm);
+    }
+
+    return FailCount == 0;
+  } /* End of 'TestCallAllocations' function */
+} /* end of 'watap::test' namespace */
+
+/* END OF 'watap_test_allocation.cpp' FILE */
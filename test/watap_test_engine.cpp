@@ -0,0 +1,64 @@
+/***
+ * Execution engine consistency tests (every bytecode type must give the same result).
+ *
+ * Constant wrap select test: i32 constants are kept sign extended by native code compiler, so 'i32.wrap_i64'
+ * of i64 constant must drop its upper half before constant is used as 'select' condition.
+ ***/
+
+#include "watap_test.h"
+
+/* Project namespace // Test namespace */
+namespace watap::test
+{
+  /* Test module:
+   *   (func (export "run") (result i32)
+   *     (select (i32.const 7) (i32.const 9) (i32.wrap_i64 (i64.const 0x100000000))))
+   */
+  static const UINT8 WrapSelectModule[]
+  {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7F, 0x03,
+    0x02, 0x01, 0x00, 0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6E, 0x00, 0x00, 0x0A, 0x10, 0x01, 0x0E,
+    0x00, 0x41, 0x07, 0x41, 0x09, 0x42, 0x80, 0x80, 0x80, 0x80, 0x10, 0xA7, 0x1B, 0x0B,
+  };
+
+  /* Constant wrap select test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if select by wrapped constant condition gives the same result with every bytecode type, FALSE otherwise;
+   */
+  BOOL TestConstantWrapSelect( VOID )
+  {
+    const INT32 Expected = 9;
+    INT FailCount = 0;
+
+    // Optimization folds constants before native code compiler, so it's tested both enabled and disabled
+    for (UINT32 Config = 0; Config <= 2 * static_cast<UINT32>(impl::standard::bytecode_type::eNative) + 1; Config++)
+    {
+      auto Wasm = impl::standard::Create(impl::standard::settings {
+        .Bytecode = static_cast<impl::standard::bytecode_type>(Config >> 1),
+        .Optimization = (Config & 1) != 0,
+      });
+      auto ModuleSource = Wasm->CreateSource(source_info { std::span<const UINT8>(WrapSelectModule) });
+      auto Runtime = Wasm->CreateInstance(instance_info {
+        .ModuleSource = ModuleSource,
+        .ImportTable = nullptr,
+      });
+      std::optional<INT32> Result = Runtime->GetExport<INT32 ( VOID )>("run")();
+
+      if (Result != Expected)
+      {
+        std::cout << std::format("  bytecode {}, optimization {}: result {}, expected {}\n",
+          Config >> 1, Config & 1, Result ? std::to_string(*Result) : "trap", Expected);
+        FailCount++;
+      }
+
+      Wasm->DestroyInstance(Runtime);
+      Wasm->DestroySource(ModuleSource);
+      impl::standard::Destroy(Wasm);
+    }
+
+    return FailCount == 0;
+  } /* End of 'TestConstantWrapSelect' function */
+} /* end of 'watap::test' namespace */
+
+/* END OF 'watap_test_engine.cpp' FILE */
@@ -0,0 +1,103 @@
+/***
+ * Host function import tests.
+ *
+ * Host reentry test: host function gets slots placed on instance stacks, which may be moved by instance call,
+ * so host function, imported by instance, can't call it back (calls fail), and its own call isn't affected.
+ ***/
+
+#include "watap_test.h"
+
+/* Project namespace // Test namespace */
+namespace watap::test
+{
+  /* Test module:
+   *   (import "env" "cb" (func $cb (param i32) (result i32)))
+   *   (func (export "run") (param $n i32) (result i32)
+   *     (i32.add (call $cb (local.get $n)) (local.get $n)))
+   */
+  static const UINT8 HostReentryModule[]
+  {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60, 0x01, 0x7F, 0x01, 0x7F,
+    0x02, 0x0A, 0x01, 0x03, 0x65, 0x6E, 0x76, 0x02, 0x63, 0x62, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00,
+    0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6E, 0x00, 0x01, 0x0A, 0x0B, 0x01, 0x09, 0x00, 0x20, 0x00,
+    0x10, 0x00, 0x20, 0x00, 0x6A, 0x0B,
+  };
+
+  /* Host reentry test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if calls of instance by its host function fail and don't affect running call, FALSE otherwise;
+   */
+  BOOL TestHostReentry( VOID )
+  {
+    // run(n) = cb(n) + n, cb returns -1 if both its calls of 'run' fail
+    const INT32 Argument = 3000;
+    const INT32 Expected = Argument - 1;
+    const UINT32 CallCount = 3;
+    INT FailCount = 0;
+
+    // Host function is called by every engine and by optimized code (functions are tiered up on the first call)
+    for (UINT32 Bytecode = 0; Bytecode <= static_cast<UINT32>(impl::standard::bytecode_type::eNative); Bytecode++)
+      for (UINT32 TierUpCallCount : {0, 1})
+      {
+        instance *Runtime = nullptr;
+        export_function<INT32 ( INT32 )> Run;
+        UINT32 ReentryCount = 0;
+
+        auto Wasm = impl::standard::Create(impl::standard::settings {
+          .Bytecode = static_cast<impl::standard::bytecode_type>(Bytecode),
+          .TierUpCallCount = TierUpCallCount,
+        });
+        auto ModuleSource = Wasm->CreateSource(source_info { std::span<const UINT8>(HostReentryModule) });
+        auto ImportTable = Wasm->CreateImportTable(import_table_info {
+          .Functions
+          {
+            {"env", "cb", MakeHostFunction([&]( INT32 N ) -> INT32
+              {
+                const value CallArgument { .U64x2 {static_cast<UINT32>(N - 1), 0} };
+                const std::optional<INT32> HandleResult = Run(N - 1);
+                const std::optional<value> CallResult = Runtime->Call("run", std::span<const value>(&CallArgument, 1));
+
+                Runtime->Restart();
+                ReentryCount++;
+                if (HandleResult || CallResult)
+                  return HandleResult ? *HandleResult : CallResult->I32x4[0];
+                return -1;
+              })},
+          },
+        });
+        Runtime = Wasm->CreateInstance(instance_info {
+          .ModuleSource = ModuleSource,
+          .ImportTable = ImportTable,
+        });
+        Run = Runtime->GetExport<INT32 ( INT32 )>("run");
+
+        for (UINT32 i = 0; i < CallCount; i++)
+        {
+          const std::optional<INT32> Result = Run(Argument);
+
+          if (Result != Expected || Runtime->IsTrapped())
+          {
+            std::cout << std::format("  bytecode {}, tier up call count {}, call {}: result {}, expected {}\n",
+              Bytecode, TierUpCallCount, i, Result ? std::to_string(*Result) : "trap", Expected);
+            FailCount++;
+          }
+        }
+        if (ReentryCount != CallCount)
+        {
+          std::cout << std::format("  bytecode {}, tier up call count {}: host function called {} times, expected {}\n",
+            Bytecode, TierUpCallCount, ReentryCount, CallCount);
+          FailCount++;
+        }
+
+        Wasm->DestroyInstance(Runtime);
+        Wasm->DestroyImportTable(ImportTable);
+        Wasm->DestroySource(ModuleSource);
+        impl::standard::Destroy(Wasm);
+      }
+
+    return FailCount == 0;
+  } /* End of 'TestHostReentry' function */
+} /* end of 'watap::test' namespace */
+
+/* END OF 'watap_test_host.cpp' FILE */
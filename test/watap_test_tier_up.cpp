@@ -0,0 +1,154 @@
+/***
+ * Tier up (optimizing compiler) tests.
+ *
+ * Nested loop on-stack replacement test: inner loop is entered by on-stack replacement, so optimized code
+ * has no entry edge to outer loop and outer loop header is dominated by its latch. Invariant of outer loop,
+ * placed in latch, must not be hoisted (there is no preheader outside of loop).
+ *
+ * Deep recursion test: calls of optimized functions by optimized code are nested on host stack and aren't
+ * pushed to instance call stack, recursion deeper than call stack depth must trap anyway.
+ ***/
+
+#include "watap_test.h"
+
+/* Project namespace // Test namespace */
+namespace watap::test
+{
+  /* Test module:
+   *   (func (export "run") (param $n i32) (result i32) (local $j i32) (local $v f32) (local $base i32) (local $i i32)
+   *     (local.set $base (i32.mul (local.get $n) (i32.const 8)))
+   *     (loop $outer
+   *       (local.set $j (i32.const 0))
+   *       (loop $inner
+   *         (f32.store offset=4 (i32.and (local.get $base) (i32.const 0xfff8)) (local.get $v))
+   *         (local.set $v (f32.add (local.get $v) (f32.const 1)))
+   *         (br_if $inner (i32.lt_s (local.tee $j (i32.add (local.get $j) (i32.const 1))) (i32.const 100))))
+   *       (i32.store (local.get $base) (i32.add (i32.mul (i32.xor (local.get $base) (i32.const 5)) (i32.const 7)) (i32.const 3)))
+   *       (br_if $outer (i32.lt_s (local.tee $i (i32.add (local.get $i) (i32.const 1))) (local.get $n))))
+   *     (i32.add (i32.add (i32.mul (local.get $i) (i32.const 1000)) (i32.trunc_f32_s (f32.load offset=4 (local.get $base))))
+   *              (i32.load (local.get $base))))
+   *   (memory 1)
+   */
+  static const UINT8 NestedLoopModule[]
+  {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60, 0x01, 0x7F, 0x01, 0x7F,
+    0x03, 0x02, 0x01, 0x00, 0x05, 0x03, 0x01, 0x00, 0x01, 0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6E,
+    0x00, 0x00, 0x0A, 0x6D, 0x01, 0x6B, 0x03, 0x01, 0x7F, 0x01, 0x7D, 0x02, 0x7F, 0x20, 0x00, 0x41,
+    0x08, 0x6C, 0x21, 0x03, 0x03, 0x40, 0x41, 0x00, 0x21, 0x01, 0x03, 0x40, 0x20, 0x03, 0x41, 0xF8,
+    0xFF, 0x03, 0x71, 0x20, 0x02, 0x38, 0x02, 0x04, 0x20, 0x02, 0x43, 0x00, 0x00, 0x80, 0x3F, 0x92,
+    0x21, 0x02, 0x20, 0x01, 0x41, 0x01, 0x6A, 0x22, 0x01, 0x41, 0xE4, 0x00, 0x48, 0x0D, 0x00, 0x0B,
+    0x20, 0x03, 0x20, 0x03, 0x41, 0x05, 0x73, 0x41, 0x07, 0x6C, 0x41, 0x03, 0x6A, 0x36, 0x02, 0x00,
+    0x20, 0x04, 0x41, 0x01, 0x6A, 0x22, 0x04, 0x20, 0x00, 0x48, 0x0D, 0x00, 0x0B, 0x20, 0x04, 0x41,
+    0xE8, 0x07, 0x6C, 0x20, 0x03, 0x2A, 0x02, 0x04, 0xA8, 0x6A, 0x20, 0x03, 0x28, 0x02, 0x00, 0x6A,
+    0x0B,
+  };
+
+  /* Nested loop on-stack replacement test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if loop entered by on-stack replacement gives result of interpreted one, FALSE otherwise;
+   */
+  BOOL TestNestedLoopOsr( VOID )
+  {
+    // run(10): 10 * 1000 + 999 (last value stored by inner loop) + (80 ^ 5) * 7 + 3
+    const INT32 Expected = 11597;
+    INT FailCount = 0;
+
+    for (UINT32 Bytecode = 0; Bytecode <= static_cast<UINT32>(impl::standard::bytecode_type::eNative); Bytecode++)
+      for (UINT32 BackEdgeCount = 1; BackEdgeCount <= 7; BackEdgeCount++)
+      {
+        auto Wasm = impl::standard::Create(impl::standard::settings {
+          .Bytecode = static_cast<impl::standard::bytecode_type>(Bytecode),
+          .TierUpBackEdgeCount = BackEdgeCount,
+        });
+        auto ModuleSource = Wasm->CreateSource(source_info { std::span<const UINT8>(NestedLoopModule) });
+        auto Runtime = Wasm->CreateInstance(instance_info {
+          .ModuleSource = ModuleSource,
+          .ImportTable = nullptr,
+        });
+        std::optional<INT32> Result = Runtime->GetExport<INT32 ( INT32 )>("run")(10);
+
+        if (Result != Expected)
+        {
+          std::cout << std::format("  bytecode {}, back edge count {}: result {}, expected {}\n",
+            Bytecode, BackEdgeCount, Result ? std::to_string(*Result) : "trap", Expected);
+          FailCount++;
+        }
+
+        Wasm->DestroyInstance(Runtime);
+        Wasm->DestroySource(ModuleSource);
+        impl::standard::Destroy(Wasm);
+      }
+
+    return FailCount == 0;
+  } /* End of 'TestNestedLoopOsr' function */
+
+  /* Test module:
+   *   (func $rec (export "rec") (param $n i32) (result i32)
+   *     (if (result i32) (i32.eqz (local.get $n))
+   *       (then (i32.const 0))
+   *       (else (i32.add (local.get $n) (call $rec (i32.sub (local.get $n) (i32.const 1)))))))
+   */
+  static const UINT8 DeepRecursionModule[]
+  {
+    0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60, 0x01, 0x7F, 0x01, 0x7F,
+    0x03, 0x02, 0x01, 0x00, 0x07, 0x07, 0x01, 0x03, 0x72, 0x65, 0x63, 0x00, 0x00, 0x0A, 0x17, 0x01,
+    0x15, 0x00, 0x20, 0x00, 0x45, 0x04, 0x7F, 0x41, 0x00, 0x05, 0x20, 0x00, 0x20, 0x00, 0x41, 0x01,
+    0x6B, 0x10, 0x00, 0x6A, 0x0B, 0x0B,
+  };
+
+  /* Deep recursion test.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (BOOL) TRUE if recursion deeper than call stack depth traps with and without tier up, FALSE otherwise;
+   */
+  BOOL TestDeepRecursion( VOID )
+  {
+    // Call argument and result (std::nullopt if call traps), recursion depth is argument + 1
+    const std::pair<INT32, std::optional<INT32>> Calls[]
+    {
+      {1000, 500500},
+      {17000, std::nullopt},
+      {100000, std::nullopt},
+      {1000, 500500},
+    };
+    INT FailCount = 0;
+
+    for (UINT32 Bytecode = 0; Bytecode <= static_cast<UINT32>(impl::standard::bytecode_type::eNative); Bytecode++)
+      for (UINT32 CallCount : {0, 1})
+      {
+        auto Wasm = impl::standard::Create(impl::standard::settings {
+          .Bytecode = static_cast<impl::standard::bytecode_type>(Bytecode),
+          .TierUpCallCount = CallCount,
+        });
+        auto ModuleSource = Wasm->CreateSource(source_info { std::span<const UINT8>(DeepRecursionModule) });
+        auto Runtime = Wasm->CreateInstance(instance_info {
+          .ModuleSource = ModuleSource,
+          .ImportTable = nullptr,
+        });
+        auto Rec = Runtime->GetExport<INT32 ( INT32 )>("rec");
+
+        for (const auto &[Argument, Expected] : Calls)
+        {
+          std::optional<INT32> Result = Rec(Argument);
+
+          if (Result != Expected)
+          {
+            std::cout << std::format("  bytecode {}, tier up call count {}: rec({}) result {}, expected {}\n",
+              Bytecode, CallCount, Argument, Result ? std::to_string(*Result) : "trap", Expected ? std::to_string(*Expected) : "trap");
+            FailCount++;
+          }
+          if (Runtime->IsTrapped())
+            Runtime->Restart();
+        }
+
+        Wasm->DestroyInstance(Runtime);
+        Wasm->DestroySource(ModuleSource);
+        impl::standard::Destroy(Wasm);
+      }
+
+    return FailCount == 0;
+  } /* End of 'TestDeepRecursion' function */
+} /* end of 'watap::test' namespace */
+
+/* END OF 'watap_test_tier_up.cpp' FILE */